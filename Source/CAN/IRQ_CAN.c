@@ -94,24 +94,8 @@ void CAN_IRQHandler(void) {
         val_score = (CAN_RxMsg.data[2] << 8);
         val_score = val_score | CAN_RxMsg.data[3];
         
-        // Update the countdown display on the screen
-        sprintf(tmp, "%d", val_countdown);
-        GUI_Text(0, 16, (uint8_t*)"00", Black, Black);  // Clear previous countdown
-        GUI_Text(0, 16, (uint8_t*)tmp, White, Black);    // Display new countdown value
-        
-        // Update the lives display (draw yellow circles for each remaining life, max 5)
-        int c;
-        for (c = 0; c < val_lives; c++) {
-            draw_circle(58 + c * 15, 312, 5, Yellow);
-            if (c == 4) {
-                break;  // Stop drawing if 5 lives are displayed
-            }
-        }
-        
-        // Update the score display
-        sprintf(tmp, "%d", val_score);
-        GUI_Text(180, 16, (uint8_t*)tmp, Black, Black);  // Clear previous score
-        GUI_Text(180, 16, (uint8_t*)tmp, White, Black);  // Display new score
+        // Countdown, lives and score are drawn by the next frame (render.c)
+        render_post(RENDER_STATUS);
 			}
     }
 
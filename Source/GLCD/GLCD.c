@@ -26,6 +26,11 @@
 /* Private variables ---------------------------------------------------------*/
 static uint8_t LCD_Code;
 
+/* Window opened by LCD_WindowBegin(): its rectangle, the next pixel and how it is written.
+   One window at a time, like the controller's own window and GRAM address: not reentrant */
+static uint16_t Win_X, Win_Y, Win_Width, Win_Height, Win_Col, Win_Row;
+static uint8_t Win_Burst;
+
 /* Private define ------------------------------------------------------------*/
 #define  ILI9320    0  /* 0x9320 */
 #define  ILI9325    1  /* 0x9325 */
@@ -158,6 +163,70 @@ static __attribute__((always_inline)) void LCD_WriteData(uint16_t data)
 	LCD_CS(1);
 }
 
+/*******************************************************************************
+* Function Name  : LCD_WriteBurst
+* Description    : Streams pixels to GRAM after index 0x22: CS and RS are set
+*                  once, then each pixel is one bus write (address auto-increment);
+*                  a pixel the colour of the previous one is only a WR pulse
+* Input          : - pixels: colours, Count of them
+*                  - Count: pixels to write
+*                  - Stride: step between two pixels in the buffer (1: in a row,
+*                    the buffer width: down a column)
+* Output         : None
+* Return         : None
+* Attention		 : None
+*******************************************************************************/
+static void LCD_WriteBurst(const uint16_t *pixels, uint32_t Count, uint16_t Stride)
+{
+	uint16_t Color;
+
+	if( Count == 0 )
+	{
+		return;
+	}
+	LCD_CS(0);
+	LCD_RS(1);
+	Color = *pixels;
+	LCD_Send( Color );
+	while( Count-- )
+	{
+		if( *pixels != Color )
+		{
+			Color = *pixels;
+			LCD_Send( Color );          /* The bus and the latch keep it for the next pixels */
+		}
+		pixels += Stride;
+		LCD_WR(0);
+		wait_delay(1);
+		LCD_WR(1);
+	}
+	LCD_CS(1);
+}
+
+/*******************************************************************************
+* Function Name  : LCD_FillBurst
+* Description    : Streams one colour to GRAM after index 0x22: the bus and the
+*                  latch keep the colour, so each pixel is only a WR pulse
+* Input          : - Color: pixel colour
+*                  - Count: pixels to write
+* Output         : None
+* Return         : None
+* Attention		 : None
+*******************************************************************************/
+static void LCD_FillBurst(uint16_t Color, uint32_t Count)
+{
+	LCD_CS(0);
+	LCD_RS(1);
+	LCD_Send( Color );
+	while( Count-- )
+	{
+		LCD_WR(0);
+		wait_delay(1);
+		LCD_WR(1);
+	}
+	LCD_CS(1);
+}
+
 /*******************************************************************************
 * Function Name  : LCD_ReadData
 * Description    : ȡ
@@ -268,6 +337,84 @@ static void LCD_SetCursor(uint16_t Xpos,uint16_t Ypos)
   }
 }
 
+/*******************************************************************************
+* Function Name  : LCD_HasWindow
+* Description    : Tells if the controller has the ILI932x GRAM window registers
+* Input          : None
+* Output         : None
+* Return         : 1 if 0x50-0x53 set the window, 0 otherwise
+* Attention		 : None
+*******************************************************************************/
+static int LCD_HasWindow(void)
+{
+	switch( LCD_Code )
+	{
+		case SSD1298:
+		case SSD1289:
+		case HX8346A:
+		case HX8347A:
+		case HX8347D:
+		case SSD2119:
+			return 0;
+		default:	/* 0x9320 0x9325 0x9328 0x9331 0x5408 0x1505 0x0505 0x7783 0x4531 0x4535 */
+			return 1;
+	}
+}
+
+/*******************************************************************************
+* Function Name  : LCD_SetWindow
+* Description    : Opens a GRAM window on a screen rectangle, puts the cursor on
+*                  its first pixel and sends index 0x22: the pixels that follow
+*                  fill the window with address auto-increment
+* Input          : - Xpos, Ypos: top-left corner (inside the screen)
+*                  - Width, Height: size (inside the screen)
+* Output         : None
+* Return         : None
+* Attention		 : Only if LCD_HasWindow(); LCD_ResetWindow() when done.
+*                  At 90/270 degrees the window is streamed column by column,
+*                  right to left, each column top to bottom.
+*******************************************************************************/
+static void LCD_SetWindow(uint16_t Xpos, uint16_t Ypos, uint16_t Width, uint16_t Height)
+{
+    #if  ( DISP_ORIENTATION == 90 ) || ( DISP_ORIENTATION == 270 )
+
+	LCD_WriteReg(0x0050, Ypos );                    /* Horizontal GRAM start */
+	LCD_WriteReg(0x0051, Ypos + Height - 1 );       /* Horizontal GRAM end */
+	LCD_WriteReg(0x0052, MAX_X - Xpos - Width );    /* Vertical GRAM start */
+	LCD_WriteReg(0x0053, MAX_X - 1 - Xpos );        /* Vertical GRAM end */
+	LCD_WriteReg(0x0020, Ypos );
+	LCD_WriteReg(0x0021, MAX_X - Xpos - Width );
+
+	#else
+
+	LCD_WriteReg(0x0050, Xpos );                    /* Horizontal GRAM start */
+	LCD_WriteReg(0x0051, Xpos + Width - 1 );        /* Horizontal GRAM end */
+	LCD_WriteReg(0x0052, Ypos );                    /* Vertical GRAM start */
+	LCD_WriteReg(0x0053, Ypos + Height - 1 );       /* Vertical GRAM end */
+	LCD_WriteReg(0x0020, Xpos );
+	LCD_WriteReg(0x0021, Ypos );
+
+	#endif
+
+	LCD_WriteIndex(0x0022);
+}
+
+/*******************************************************************************
+* Function Name  : LCD_ResetWindow
+* Description    : Gives the whole GRAM back as the window (as after power-on)
+* Input          : None
+* Output         : None
+* Return         : None
+* Attention		 : None
+*******************************************************************************/
+static void LCD_ResetWindow(void)
+{
+	LCD_WriteReg(0x0050, 0x0000);
+	LCD_WriteReg(0x0051, 0x00ef);
+	LCD_WriteReg(0x0052, 0x0000);
+	LCD_WriteReg(0x0053, 0x013f);
+}
+
 /*******************************************************************************
 * Function Name  : LCD_Delay
 * Description    : Delay Time
@@ -387,8 +534,6 @@ void LCD_Initialization(void)
 *******************************************************************************/
 void LCD_Clear(uint16_t Color)
 {
-	uint32_t index;
-	
 	if( LCD_Code == HX8347D || LCD_Code == HX8347A )
 	{
 		LCD_WriteReg(0x02,0x00);                                                  
@@ -409,16 +554,11 @@ void LCD_Clear(uint16_t Color)
 	}	
 
 	LCD_WriteIndex(0x0022);
-	for( index = 0; index < MAX_X * MAX_Y; index++ )
-	{
-		LCD_WriteData(Color);
-	}
+	LCD_FillBurst(Color, MAX_X * MAX_Y);
 }
 
 void LCD_Clear_HH(uint16_t Color1, uint16_t Color2)
 {
-	uint32_t index;
-	
 	if( LCD_Code == HX8347D || LCD_Code == HX8347A )
 	{
 		LCD_WriteReg(0x02,0x00);                                                  
@@ -439,14 +579,8 @@ void LCD_Clear_HH(uint16_t Color1, uint16_t Color2)
 	}	
 
 	LCD_WriteIndex(0x0022);
-	for( index = 0; index < MAX_X * MAX_Y/2; index++ )
-	{
-		LCD_WriteData(Color1);
-	}
-	for( index = 0; index < MAX_X * MAX_Y/2; index++ )
-	{
-		LCD_WriteData(Color2);
-	}
+	LCD_FillBurst(Color1, MAX_X * MAX_Y/2);
+	LCD_FillBurst(Color2, MAX_X * MAX_Y/2);
 }
 
 
@@ -537,6 +671,210 @@ void LCD_SetPoint(uint16_t Xpos,uint16_t Ypos,uint16_t point)
 	LCD_WriteReg(0x0022,point);
 }
 
+/******************************************************************************
+* Function Name  : LCD_FillRect
+* Description    : Fills a rectangle with one colour: the window is set once and
+*                  every pixel is a single WR pulse
+* Input          : - Xpos, Ypos: top-left corner
+*                  - Width, Height: size in pixels
+*                  - Color: fill colour
+* Output         : None
+* Return         : None
+* Attention		 : Clipped to the screen
+*******************************************************************************/
+void LCD_FillRect(uint16_t Xpos, uint16_t Ypos, uint16_t Width, uint16_t Height, uint16_t Color)
+{
+	uint16_t i, j;
+
+	if( Xpos >= MAX_X || Ypos >= MAX_Y || Width == 0 || Height == 0 )
+	{
+		return;
+	}
+	if( Width > MAX_X - Xpos )
+	{
+		Width = MAX_X - Xpos;
+	}
+	if( Height > MAX_Y - Ypos )
+	{
+		Height = MAX_Y - Ypos;
+	}
+
+	if( !LCD_HasWindow() )
+	{
+		for( j = 0; j < Height; j++ )
+		{
+			for( i = 0; i < Width; i++ )
+			{
+				LCD_SetPoint(Xpos + i, Ypos + j, Color);
+			}
+		}
+		return;
+	}
+
+    #if  ( DISP_ORIENTATION == 90 ) || ( DISP_ORIENTATION == 270 )
+	if( Width == 1 )
+	#else
+	if( Height == 1 )
+	#endif
+	{
+		/* A single GRAM line: the full window already streams along it, only the cursor moves */
+		LCD_SetCursor(Xpos, Ypos);
+		LCD_WriteIndex(0x0022);
+		LCD_FillBurst(Color, (uint32_t)Width * Height);
+		return;
+	}
+	LCD_SetWindow(Xpos, Ypos, Width, Height);
+	LCD_FillBurst(Color, (uint32_t)Width * Height);
+	LCD_ResetWindow();
+}
+
+/******************************************************************************
+* Function Name  : LCD_WriteWindow
+* Description    : Copies a block of pixels to a rectangle: the window is set
+*                  once and every pixel is a single bus write
+* Input          : - Xpos, Ypos: top-left corner
+*                  - Width, Height: size in pixels
+*                  - pixels: Width * Height colours, row by row
+* Output         : None
+* Return         : None
+* Attention		 : Clipped to the screen (pixels keeps its Width stride)
+*******************************************************************************/
+void LCD_WriteWindow(uint16_t Xpos, uint16_t Ypos, uint16_t Width, uint16_t Height, const uint16_t *pixels)
+{
+	uint16_t i, j, w = Width, h = Height;
+
+	if( Xpos >= MAX_X || Ypos >= MAX_Y || Width == 0 || Height == 0 )
+	{
+		return;
+	}
+	if( w > MAX_X - Xpos )
+	{
+		w = MAX_X - Xpos;
+	}
+	if( h > MAX_Y - Ypos )
+	{
+		h = MAX_Y - Ypos;
+	}
+
+	if( !LCD_HasWindow() )
+	{
+		for( j = 0; j < h; j++ )
+		{
+			for( i = 0; i < w; i++ )
+			{
+				LCD_SetPoint(Xpos + i, Ypos + j, pixels[j * Width + i]);
+			}
+		}
+		return;
+	}
+	LCD_SetWindow(Xpos, Ypos, w, h);
+
+    #if  ( DISP_ORIENTATION == 90 ) || ( DISP_ORIENTATION == 270 )
+
+	for( i = w; i-- > 0; )                 /* Columns right to left, one burst each */
+	{
+		LCD_WriteBurst(&pixels[i], h, Width);
+	}
+
+	#else
+
+	if( w == Width )
+	{
+		LCD_WriteBurst(pixels, (uint32_t)w * h, 1);  /* Rows back to back */
+	}
+	else
+	{
+		for( j = 0; j < h; j++ )
+		{
+			LCD_WriteBurst(&pixels[j * Width], w, 1);
+		}
+	}
+
+	#endif
+
+	LCD_ResetWindow();
+}
+
+/******************************************************************************
+* Function Name  : LCD_WindowBegin
+* Description    : Opens a window to stream pixels into with LCD_WindowPixels(),
+*                  row by row, for pictures too big to hold in RAM
+* Input          : - Xpos, Ypos: top-left corner
+*                  - Width, Height: size in pixels
+* Output         : None
+* Return         : None
+* Attention		 : The window must lie inside the screen. Close it with
+*                  LCD_WindowEnd(). Without the ILI932x window registers, or at
+*                  90/270 degrees, the pixels are written one LCD_SetPoint() each.
+*                  Not reentrant: the window is kept in file-static state (and in
+*                  the controller), so nothing else may draw until it is closed;
+*                  PutChar() uses it, so draw from one context only.
+*******************************************************************************/
+void LCD_WindowBegin(uint16_t Xpos, uint16_t Ypos, uint16_t Width, uint16_t Height)
+{
+	Win_X = Xpos;
+	Win_Y = Ypos;
+	Win_Width = Width;
+	Win_Height = Height;
+	Win_Col = 0;
+	Win_Row = 0;
+
+    #if  ( DISP_ORIENTATION == 90 ) || ( DISP_ORIENTATION == 270 )
+	Win_Burst = 0;                         /* GRAM runs down the screen columns */
+	#else
+	Win_Burst = LCD_HasWindow();
+	#endif
+
+	if( Win_Burst )
+	{
+		LCD_SetWindow(Xpos, Ypos, Width, Height);
+	}
+}
+
+/******************************************************************************
+* Function Name  : LCD_WindowPixels
+* Description    : Streams the next pixels of the window opened by LCD_WindowBegin()
+* Input          : - pixels: colours, Count of them
+*                  - Count: pixels to write
+* Output         : None
+* Return         : None
+* Attention		 : None
+*******************************************************************************/
+void LCD_WindowPixels(const uint16_t *pixels, uint16_t Count)
+{
+	if( Win_Burst )
+	{
+		LCD_WriteBurst(pixels, Count, 1);
+		return;
+	}
+	while( Count-- && Win_Row < Win_Height )
+	{
+		LCD_SetPoint(Win_X + Win_Col, Win_Y + Win_Row, *pixels++);
+		if( ++Win_Col == Win_Width )
+		{
+			Win_Col = 0;
+			Win_Row++;
+		}
+	}
+}
+
+/******************************************************************************
+* Function Name  : LCD_WindowEnd
+* Description    : Closes the window opened by LCD_WindowBegin()
+* Input          : None
+* Output         : None
+* Return         : None
+* Attention		 : None
+*******************************************************************************/
+void LCD_WindowEnd(void)
+{
+	if( Win_Burst )
+	{
+		LCD_ResetWindow();
+		Win_Burst = 0;
+	}
+}
+
 /******************************************************************************
 * Function Name  : LCD_DrawLine
 * Description    : Bresenham's line algorithm
@@ -572,22 +910,12 @@ void LCD_DrawLine( uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1 , uint16_t
 
     if( dx == 0 )     /* Xû ֱ */ 
     {
-        do
-        { 
-            LCD_SetPoint(x0, y0, color);   /* ʾ 费ֱ */
-            y0++;
-        }
-        while( y1 >= y0 ); 
+        LCD_FillRect(x0, y0, 1, y1 - y0 + 1, color);   /* one window, one burst */
 		return; 
     }
     if( dy == 0 )     /* Yû ˮƽֱ */ 
     {
-        do
-        {
-            LCD_SetPoint(x0, y0, color);   /* ʾ ˮƽ */
-            x0++;
-        }
-        while( x1 >= x0 ); 
+        LCD_FillRect(x0, y0, x1 - x0 + 1, 1, color);   /* one window, one burst */
 		return;
     }
 	/* ɭķ(Bresenham)㷨 */
@@ -645,24 +973,41 @@ void LCD_DrawLine( uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1 , uint16_t
 *******************************************************************************/
 void PutChar( uint16_t Xpos, uint16_t Ypos, uint8_t ASCI, uint16_t charColor, uint16_t bkColor )
 {
-	uint16_t i, j;
+	uint16_t i, j, w = 8, h = 16;
     uint8_t buffer[16], tmp_char;
+    uint16_t row[8];            /* one line of the glyph (the stack is only 1 KB) */
+
+    if( Xpos >= MAX_X || Ypos >= MAX_Y )
+    {
+        return;
+    }
+    if( w > MAX_X - Xpos )
+    {
+        w = MAX_X - Xpos;
+    }
+    if( h > MAX_Y - Ypos )
+    {
+        h = MAX_Y - Ypos;
+    }
     GetASCIICode(buffer,ASCI);  /* ȡģ */
-    for( i=0; i<16; i++ )
+    LCD_WindowBegin( Xpos, Ypos, w, h );  /* one window for the whole glyph */
+    for( i=0; i<h; i++ )
     {
         tmp_char = buffer[i];
         for( j=0; j<8; j++ )
         {
             if( ((tmp_char >> (7 - j)) & 0x01) == 0x01 )
             {
-                LCD_SetPoint( Xpos + j, Ypos + i, charColor );  /* ַɫ */
+                row[j] = charColor;  /* ַɫ */
             }
             else
             {
-                LCD_SetPoint( Xpos + j, Ypos + i, bkColor );  /* ɫ */
+                row[j] = bkColor;  /* ɫ */
             }
         }
+        LCD_WindowPixels( row, w );
     }
+    LCD_WindowEnd();
 }
 
 /******************************************************************************
@@ -92,6 +92,11 @@ void LCD_Clear(uint16_t Color);
 void LCD_Clear_HH(uint16_t Color1, uint16_t Color2);
 uint16_t LCD_GetPoint(uint16_t Xpos,uint16_t Ypos);
 void LCD_SetPoint(uint16_t Xpos,uint16_t Ypos,uint16_t point);
+void LCD_FillRect(uint16_t Xpos, uint16_t Ypos, uint16_t Width, uint16_t Height, uint16_t Color);
+void LCD_WriteWindow(uint16_t Xpos, uint16_t Ypos, uint16_t Width, uint16_t Height, const uint16_t *pixels);
+void LCD_WindowBegin(uint16_t Xpos, uint16_t Ypos, uint16_t Width, uint16_t Height);
+void LCD_WindowPixels(const uint16_t *pixels, uint16_t Count);
+void LCD_WindowEnd(void);
 void LCD_DrawLine( uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1 , uint16_t color );
 void PutChar( uint16_t Xpos, uint16_t Ypos, uint8_t ASCI, uint16_t charColor, uint16_t bkColor );
 void GUI_Text(uint16_t Xpos, uint16_t Ypos, uint8_t *str,uint16_t Color, uint16_t bkColor);
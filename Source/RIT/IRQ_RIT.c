@@ -123,7 +123,10 @@ void RIT_IRQHandler(void)
     {
         /* Joystick SELECT pressed */
         select++;
-        // Do nothing for now on SELECT press
+        if (select == 1)
+        {
+            autopilot_toggle(); // Hand Pac-Man to the autopilot, or take him back
+        }
     }
     else
     {
@@ -212,9 +215,8 @@ void RIT_IRQHandler(void)
                 disable_timer(1);
                 disable_timer(2);
                 disable_timer(3);
-                LCD_Clear(Black);
-								draw_start_menu();
-                GUI_Text(105, 160, (uint8_t *)"PAUSE", Black, White);
+                render_discard();              // The game screen goes away
+                render_post(RENDER_PAUSE);     // The next frame draws the pause screen
                 pause = 1;
             }
             else if (pause && !music && !endgame)
@@ -235,33 +237,28 @@ void RIT_IRQHandler(void)
         }
     } // End INT0
 
-    // The following sections for KEY1 and KEY2 are commented out.
-    // If required, they can be uncommented for handling other button presses.
+    /*************************KEY1***************************/
+    // Switches the ghost AI between the planned paths and the arcade steering
+    if (down_1 != 0)
+    {
+        down_1++;
+        if ((LPC_GPIO2->FIOPIN & (1 << 11)) == 0)
+        {
+            if (down_1 == 2)
+            {
+                arcade_steering_toggle();
+            }
+        }
+        else
+        { /* Button released */
+            down_1 = 0;
+            NVIC_EnableIRQ(EINT1_IRQn); // Enable external interrupt for KEY1
+            LPC_PINCON->PINSEL4 |= (1 << 22); /* External interrupt 1 pin selection */
+        }
+    } // End KEY1
 
-    // /*************************KEY1***************************/
-    // if (down_1 != 0) {
-    //   down_1++;
-    //   if ((LPC_GPIO2->FIOPIN & (1 << 11)) == 0) {
-    //     switch (down_1) {
-    //       case 2:
-    //         if (position == 7) {
-    //           LED_On(0);
-    //           LED_Off(7);
-    //           position = 0;
-    //         } else {
-    //           LED_Off(position);
-    //           LED_On(--position);
-    //         }
-    //         break;
-    //       default:
-    //         break;
-    //     }
-    //   } else {
-    //     down_1 = 0;
-    //     NVIC_EnableIRQ(EINT1_IRQn); // Enable external interrupt for KEY1
-    //     LPC_PINCON->PINSEL4 |= (1 << 22); /* External interrupt 1 pin selection */
-    //   }
-    // }
+    // The following section for KEY2 is commented out.
+    // If required, it can be uncommented for handling other button presses.
 
     // /*************************KEY2***************************/
     // if (down_2 != 0) {
@@ -288,6 +285,9 @@ void RIT_IRQHandler(void)
     //   }
     // }
 
+    /*************************FRAME***************************/
+    job_post(JOB_RENDER); // The main loop draws what the game changed since the last frame (20 frames per second)
+
     /*************************ADC***************************/
     ADC_start_conversion(); // Start ADC conversion
 
@@ -37,6 +37,7 @@ extern int pause;
  *----------------------------------------------------------------------------*/
 int main (void) {
 	SystemInit();  												/* System Initialization (i.e., PLL)  */
+	cycle_counter_init();									/* DWT cycle counter for profiling    */
   //LED_init();                         /* LED Initialization                 */
   CAN_Init();
 	BUTTON_init();												/* BUTTON Initialization              */
@@ -53,6 +54,9 @@ int main (void) {
 	LCD_Initialization();
 	TP_Init();
 	LCD_Clear(Black);
+	junction_graph_init();								/* Ghost pathfinding graph            */
+	wavefront_init();											/* Walkable row masks                 */
+	hpa_init();													/* HPA* cluster entrances            */
 
 	/******************TIMER INIT**********************/
 	/* Counter = Period [s] * Frequency [Hz]      */
@@ -76,7 +80,14 @@ int main (void) {
 	LPC_GPIO0->FIODIR |= (1<<26);						/* Set P0.26 with Output Mode */
 		
   while (1) {                           	/* Loop forever                       */	
-		__ASM("wfi");
+		if (jobs_service()) {									/* Pathfinding slice still running    */
+			continue;
+		}
+		__disable_irq();											/* Sleep only if no ISR posted a job  */
+		if (jobs_pending == 0) {							/* meanwhile (a pending IRQ still     */
+			__ASM("wfi");												/* wakes the core while masked)       */
+		}
+		__enable_irq();
   }
 
 }
\ No newline at end of file
@@ -23,9 +23,6 @@ extern char c_str[3];                            /* String for displaying countd
 
 // Local variables
 static int c = 0;                                /* General-purpose counter */
-static int num_moves = 0;                        /* Counter for Blinky's moves */
-static int blinky_respawn_timer = 3;             /* Timer for Blinky's respawn */
-static int power_mode_countdown = 10;            /* Countdown for power mode */
 static uint16_t SinTable[45] = {                 /* Sine wave lookup table for DAC output */
     410, 467, 523, 576, 627, 673, 714, 749, 778,
     799, 813, 819, 817, 807, 789, 764, 732, 694,
@@ -47,6 +44,7 @@ void TIMER0_IRQHandler(void)
     // Check if the interrupt was caused by Match Register 0
     if(LPC_TIM0->IR & 1) {
         if(!music) {
+            autopilot_tick();                      // The autopilot steers, when it is on
             move_pacman();                         // Move Pacman
         } else {
             static int sineticks = 0;             // Sine wave table tick counter
@@ -91,41 +89,7 @@ void TIMER1_IRQHandler(void)
 {
     // Check if the interrupt was caused by Match Register 0
     if(LPC_TIM1->IR & 1) {
-        countdown--;                               // Decrement countdown timer
-        if(countdown == 0) {
-            disable_timer(0);                      // Disable all timers on game over
-            disable_timer(1);
-            disable_timer(2);
-            gameover();                             // End the game
-        }
-        
-        // Manage power mode and Blinky's respawn timer
-        if(is_power_mode) {
-            if(is_blinky_eaten) {
-                blinky_respawn_timer--;
-                if(blinky_respawn_timer == 0) {
-                    blinky_respawn_timer = 3;      // Reset respawn timer
-                    power_mode_countdown = 10;
-                    is_power_mode = PM_OFF;       // Exit power mode
-                    is_blinky_eaten = 0;           // Reset Blinky status
-                    find_path();                   // Recalculate Blinky's path
-                    init_timer(2, 0, 0, 3, 0.25 * 25000000); // Reinitialize Timer 2
-                    enable_timer(2);
-                }
-            } else {
-                power_mode_countdown--;
-                if(power_mode_countdown == 0) {
-                    power_mode_countdown = 10;    // Reset power mode timer
-                    disable_timer(2);
-                    reset_timer(2);                // Reset Timer 2
-                    is_power_mode = PM_OFF;       // Exit power mode
-                    find_path();                   // Recalculate Blinky's path
-                    init_timer(2, 0, 0, 3, 0.25 * 25000000);
-                    enable_timer(2);
-                }
-            }
-        }
-
+        game_second();                             // Countdown, power mode and respawn
         LPC_TIM1->IR = 1;                          // Clear interrupt flag for MR0
     }
     // Handle other match registers (MR1, MR2, MR3) if necessary
@@ -154,13 +118,9 @@ void TIMER2_IRQHandler(void)
 {
     // Check if the interrupt was caused by Match Register 0
     if(LPC_TIM2->IR & 1) {
-        move_blinky();                             // Move Blinky along its path
-        num_moves++;                               // Increment move counter
-
-        if(num_moves == 3) {                       // Recalculate path every 3 moves
-            num_moves = 0;
-            find_path();
-        }
+        move_ghosts();                             // Move the ghosts along their paths
+        replan_tick();                             // Ask for the new paths the governor deems worth it
+        job_post(JOB_TICK);                        // New planning budget for the main loop
         LPC_TIM2->IR = 1;                          // Clear interrupt flag for MR0
     }
     // Handle other match registers (MR1, MR2, MR3) if necessary
@@ -0,0 +1,260 @@
+/*********************************************************************************************************
+**--------------File Info---------------------------------------------------------------------------------
+** File name:          autopilot.c
+** Last modified Date:
+** Last Version:
+** Descriptions:       Pac-Man autopilot, for soak tests on the bench and the attract mode. On every Timer 0
+**                     tick it sets command, as the joystick poll of the RIT does, from a danger-weighted search
+**                     over game_map: a cell costs more the closer a chasing ghost is, cells a ghost reaches
+**                     first are never entered, and the cheapest pill (or frightened ghost) wins. Each decision
+**                     stops after AUTOPILOT_BUDGET cells or AUTOPILOT_CYCLES cycles, whichever comes first.
+**--------------------------------------------------------------------------------------------------------
+*********************************************************************************************************/
+
+#include "functions.h"
+
+#define AUTOPILOT_FAR 0xFF                       // autopilot_danger of the cells no ghost is near
+#define AUTOPILOT_HEAP (AUTOPILOT_BUDGET * 4 + 4)  // Every expansion queues at most four neighbours
+
+atomic_int autopilot = USE_AUTOPILOT;    // Set while the autopilot drives Pac-Man
+uint32_t autopilot_cycles = 0;           // Cycles spent in the last decision
+uint32_t autopilot_cycles_max = 0;       // Worst decision since power-on
+uint32_t autopilot_decisions = 0;        // Decisions taken since power-on
+int autopilot_expansions = 0;            // Cells expanded by the last decision
+
+// Steps from the nearest chasing ghost to each cell, up to AUTOPILOT_DANGER_RADIUS (AUTOPILOT_FAR beyond)
+uint8_t autopilot_danger[ROWS][COLS];
+
+// Search state. A cell's entries are only meaningful when its stamp matches autopilot_gen.
+static uint16_t autopilot_gen = 0;
+static uint16_t cell_stamp[ROWS][COLS];  // Generation that last reached each cell
+static uint16_t cell_cost[ROWS][COLS];   // Best danger-weighted cost from Pac-Man
+static uint8_t cell_steps[ROWS][COLS];   // Steps from Pac-Man along that route
+static uint8_t cell_first[ROWS][COLS];   // First move (DIR_*) of that route
+static struct {
+    uint16_t cost;
+    uint8_t x, y;
+} heap[AUTOPILOT_HEAP];                  // Cells to expand, binary min-heap on cost
+static int heap_count = 0;
+
+static const char command_of[4] = {'D', 'R', 'U', 'L'};  // command letter of each DIR_*
+
+// Function to build autopilot_danger with one wave from every chasing ghost at once (frightened ghosts and
+// eyes are harmless)
+static void danger_update() {
+    Wavefront wave;
+    int i, x, y;
+
+    memset(autopilot_danger, AUTOPILOT_FAR, sizeof(autopilot_danger));
+    wave_begin(&wave, ghost_walk_mask, -1, -1);  // Empty: the ghosts are added below
+    for (i = 0; i < NUM_GHOSTS; i++) {
+        x = ghosts[i].x;
+        y = ghosts[i].y;
+        if (ghosts[i].mode != GHOST_CHASE || !(ghost_walk_mask[y] & (1u << x))) {
+            continue;
+        }
+        wave.frontier[y] |= 1u << x;
+        wave.visited[y] |= 1u << x;
+        if (wave.lo > wave.hi) {
+            wave.lo = wave.hi = y;
+        } else if (y < wave.lo) {
+            wave.lo = y;
+        } else if (y > wave.hi) {
+            wave.hi = y;
+        }
+    }
+
+    while (wave.lo <= wave.hi && wave.layer < AUTOPILOT_DANGER_RADIUS) {
+        for (y = wave.lo; y <= wave.hi; y++) {
+            uint32_t row = wave.frontier[y];
+            while (row) {
+                x = 31 - __CLZ(row);
+                row &= ~(1u << x);
+                autopilot_danger[y][x] = wave.layer;
+            }
+        }
+        wave_step(&wave);
+    }
+}
+
+// Function to check if Pac-Man wants a cell: a pill, or a frightened ghost to eat
+static int is_prize(int x, int y) {
+    Ghost *ghost;
+
+    if (game_map[y][x] == PILL || game_map[y][x] == POWER_PILL) {
+        return 1;
+    }
+    ghost = ghost_at(x, y, 0);
+    return ghost && ghost->mode == GHOST_FRIGHTENED;
+}
+
+// Function to queue a cell reached with cost, steps and first move, if that beats what it already has
+static void autopilot_push(int x, int y, int cost, int steps, int first) {
+    int c, p;
+
+    if (cell_stamp[y][x] == autopilot_gen && cell_cost[y][x] <= cost) {
+        return;
+    }
+    if (heap_count >= AUTOPILOT_HEAP) {
+        return;  // Cannot happen within the budget, but never write past the heap
+    }
+    cell_stamp[y][x] = autopilot_gen;
+    cell_cost[y][x] = cost;
+    cell_steps[y][x] = steps > 255 ? 255 : steps;
+    cell_first[y][x] = first;
+
+    // Sift up
+    c = heap_count++;
+    while (c > 0 && heap[p = (c - 1) / 2].cost > cost) {
+        heap[c] = heap[p];
+        c = p;
+    }
+    heap[c].cost = cost;
+    heap[c].x = x;
+    heap[c].y = y;
+}
+
+// Function to pop the cheapest queued cell into (*x, *y); returns its cost
+static int autopilot_pop(int *x, int *y) {
+    int cost = heap[0].cost, c = 0;
+
+    *x = heap[0].x;
+    *y = heap[0].y;
+    heap_count--;
+
+    // Sift the last entry down from the root
+    while (1) {
+        int l = 2 * c + 1, best = heap_count;
+        if (l < heap_count && heap[l].cost < heap[best].cost) {
+            best = l;
+        }
+        if (l + 1 < heap_count && heap[l + 1].cost < heap[best].cost) {
+            best = l + 1;
+        }
+        if (best == heap_count) {
+            break;
+        }
+        heap[c] = heap[best];
+        c = best;
+    }
+    heap[c] = heap[heap_count];
+    return cost;
+}
+
+// Function to pick Pac-Man's next move (DIR_*), -1 if he cannot move. Dijkstra from Pac-Man where entering a
+// cell costs 1 plus AUTOPILOT_DANGER_WEIGHT per step a chasing ghost is inside AUTOPILOT_DANGER_RADIUS of it;
+// a cell a ghost reaches no later than Pac-Man is never entered.
+int autopilot_direction() {
+    int px = pacman_x, py = pacman_y;
+    int fallback = -1, fallback_danger = -1, fallback_steps = -1;
+    int start_heading = -1;
+    uint32_t start_cycles = DWT->CYCCNT;
+    int i, x, y;
+
+    danger_update();
+    autopilot_expansions = 0;
+    heap_count = 0;
+    if (++autopilot_gen == 0) {
+        memset(cell_stamp, 0, sizeof(cell_stamp));  // Generation wrapped: forget every stamp
+        autopilot_gen = 1;
+    }
+
+    // Keep the heading on ties: its neighbour is queued first
+    for (i = 0; i < 4; i++) {
+        if (command == command_of[i]) {
+            start_heading = i;
+        }
+    }
+
+    // The first moves, each one the root of its own branch
+    for (i = 0; i < 4; i++) {
+        int dir = start_heading >= 0 ? (start_heading + i) & 3 : i;
+        int danger;
+        x = px;
+        y = py;
+        ghost_move(&x, &y, dir);
+        if (x < 0 || x >= COLS || y < 0 || y >= ROWS || !(pacman_walk_mask[y] & (1u << x))) {
+            continue;
+        }
+        // Last resort if every branch is unsafe: the move farthest from the ghosts
+        danger = autopilot_danger[y][x];
+        if (danger > fallback_danger) {
+            fallback = dir;
+            fallback_danger = danger;
+            fallback_steps = 0;
+        }
+        if (danger <= 1) {
+            continue;  // A ghost is there, or steps there on its next move
+        }
+        autopilot_push(x, y, 1 + (danger < AUTOPILOT_DANGER_RADIUS ?
+                                  AUTOPILOT_DANGER_WEIGHT * (AUTOPILOT_DANGER_RADIUS - danger) : 0), 1, dir);
+    }
+
+    while (heap_count > 0 && autopilot_expansions < AUTOPILOT_BUDGET) {
+        int cost = autopilot_pop(&x, &y);
+        int steps;
+
+        if (cost > cell_cost[y][x]) {
+            continue;  // Stale entry of a cell reached again more cheaply
+        }
+        autopilot_expansions++;
+        if (is_prize(x, y)) {
+            fallback = cell_first[y][x];
+            break;
+        }
+
+        // Without a prize in reach, head for the safest cell seen, the farthest one on ties
+        steps = cell_steps[y][x];
+        if (autopilot_danger[y][x] > fallback_danger ||
+            (autopilot_danger[y][x] == fallback_danger && steps > fallback_steps)) {
+            fallback = cell_first[y][x];
+            fallback_danger = autopilot_danger[y][x];
+            fallback_steps = steps;
+        }
+
+        // Out of cycles (checked every 16 cells: the DWT read is cheap, but not free)
+        if ((autopilot_expansions & 15) == 0 && DWT->CYCCNT - start_cycles > AUTOPILOT_CYCLES) {
+            break;
+        }
+
+        for (i = 0; i < 4; i++) {
+            int nx = x, ny = y, danger;
+            ghost_move(&nx, &ny, i);
+            if (nx < 0 || nx >= COLS || ny < 0 || ny >= ROWS || !(pacman_walk_mask[ny] & (1u << nx))) {
+                continue;
+            }
+            danger = autopilot_danger[ny][nx];
+            if (danger <= steps + 1) {
+                continue;  // A ghost gets there first
+            }
+            autopilot_push(nx, ny, cost + 1 + (danger < AUTOPILOT_DANGER_RADIUS ?
+                                               AUTOPILOT_DANGER_WEIGHT * (AUTOPILOT_DANGER_RADIUS - danger) : 0),
+                           steps + 1, cell_first[y][x]);
+        }
+    }
+
+    autopilot_cycles = DWT->CYCCNT - start_cycles;
+    if (autopilot_cycles > autopilot_cycles_max) {
+        autopilot_cycles_max = autopilot_cycles;
+    }
+    autopilot_decisions++;
+    return fallback;
+}
+
+// Function to steer Pac-Man for this Timer 0 tick, before move_pacman() reads command
+void autopilot_tick() {
+    int dir;
+
+    if (!autopilot) {
+        return;
+    }
+    dir = autopilot_direction();
+    if (dir >= 0) {
+        command = command_of[dir];
+    }
+}
+
+// Function to hand Pac-Man to the autopilot or back to the joystick (joystick SELECT)
+void autopilot_toggle() {
+    autopilot = !autopilot;
+}
@@ -1,45 +1,286 @@
 #include "../functions.h"
 
+#if !USE_NEXTHOP_TABLE
 // Lists for nodes to explore (open_list) and already explored (closed_list)
-Node open_list[MAX_NODE];    // Nodes to explore
+Node open_list[MAX_NODE];    // Nodes to explore, kept as a binary min-heap on F
 Node closed_list[MAX_NODE];  // Nodes already explored
 int open_list_counter = 0;         // Number of nodes in open_list
 int closed_list_counter = 0;       // Number of nodes in closed_list
 
+// Per-cell search state. A cell's entries are only meaningful when its stamp matches
+// search_gen, so starting a new search just bumps the generation instead of clearing.
+static uint16_t search_gen = 0;       // Generation of the current search
+uint16_t cell_gen[ROWS][COLS];        // Generation that last reached each cell
+uint16_t best_g[ROWS][COLS];          // Best g found for each cell in that generation
+int16_t open_index[ROWS][COLS];       // Slot of each cell inside the open_list heap (-1 if not queued)
+uint32_t closed_map[ROWS];            // Visited bitmap, one bit per column
+uint16_t closed_gen[ROWS];            // Generation of each closed_map row
+#endif
+
 // Direction vectors for exploring neighbors (right, down, left, up)
 int dx[] = {0, 1, 0, -1};  // X-axis direction changes
 int dy[] = {1, 0, -1, 0};  // Y-axis direction changes
 
-// Path storage
-PathStep path[MAX_NODE];  // Steps in the calculated path
-int path_counter = 0;        // Number of steps in the path
-int current_step = 0;      // Current step in the path
+// Ghosts. Each one walks its own path (the start cell, then one 2-bit direction per step);
+// the search state below is shared and serves them one at a time.
+Ghost ghosts[NUM_GHOSTS];
+
+// Spawn cell, chase rule and colour of Blinky, Pinky, Inky and Clyde
+static const struct {
+    uint8_t x, y;
+    uint8_t target_rule;
+    uint16_t color;
+} ghost_setup[4] = {
+    {HOME_X, HOME_Y, TARGET_PACMAN, Red},
+    {13, 19, TARGET_AHEAD, Magenta},
+    {15, 19, TARGET_FLANK, Cyan},
+    {16, 19, TARGET_SHY, RGB565CONVERT(255, 184, 82)},
+};
+
+#define GHOST_BIT(g) (1u << ((g) - ghosts))    // Bit of a ghost in plan_pending
 
-// Blinky destination
+// Search in progress (main loop). It fills its own buffer, copied to the ghost's path only once complete,
+// so the ghost keeps following its last finished path while the next one is computed.
+static PackedPath plan_path;               // Path found by the running search (length 0: no route)
+static int plan_running = 0;               // Set while a search still needs slices
+static Ghost *plan_ghost = 0;              // Ghost the running search is for
+static uint32_t plan_pending = 0;          // One bit per ghost waiting for a new path
+static int plan_turn = 0;                  // Ghost looked at first for the next search (round-robin)
+static atomic_uint plan_requests = 0;      // Ghosts asked to replan by interrupt handlers, taken by plan_restart()
+static int (*plan_resume)(int budget);     // Continues the running search, returns 1 once done
+static int plan_field = -1;                // Baked field walked down by static_resume()
+
+// Destination of the search in progress
 int dest_x = 0, dest_y = 0;
 
 int overflow = 0;
 int race_condition = 0;
+int astar_expansions = 0;  // Cells expanded by the last A* search
+int open_list_peak = 0;    // Largest open_list_counter of the last A* search
+
+// Pathfinding cost, measured with the DWT cycle counter
+uint32_t find_path_cycles = 0;      // Cycles spent in the last planning slice
+uint32_t find_path_cycles_max = 0;  // Worst case since power-on
+uint32_t plan_tick_cycles = 0;      // Cycles spent planning since the last ghost tick
+uint32_t plan_tick_cycles_max = 0;  // Worst ghost tick since power-on
+uint32_t plan_tick_cycles_last = 0; // Last complete ghost tick
+uint64_t plan_cycles_total = 0;     // Every planning cycle since power-on
+uint32_t plan_searches = 0;         // Searches completed since power-on
+
+// Replan governor (TIMER2), see replan_governor_wants()
+atomic_int replan_governor = USE_REPLAN_GOVERNOR;
+uint32_t replans_triggered = 0;
+uint32_t replans_skipped = 0;
+uint32_t replan_cycles_saved = 0;
+static uint32_t replan_seconds = 0;   // Seconds of play seen by replan_second()
+static int replan_moves = 0;          // Ghost ticks since the last replan of every ghost (no governor)
+static int governor_pacman_x = -1;    // Pac-Man's cell at the previous ghost tick
+static int governor_pacman_y = -1;
 
 atomic_int find_lock = 0;  // Locks to prevent concurrent access
 atomic_int move_lock = 0;
 atomic_int eat_lock = 0;
 
-char previous_cell = EMPTY;  // Stores the previous cell Blinky occupied
+// Ghost AI selected at runtime (KEY1), see arcade_direction()
+atomic_int arcade_steering = USE_ARCADE_STEERING;
+static uint32_t arcade_seed = 1;  // Pseudo-random exits of frightened ghosts
+
+// Function to enable the Cortex-M3 DWT cycle counter used for profiling
+void cycle_counter_init() {
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;  // Enable the trace/debug blocks
+    DWT->CYCCNT = 0;                                 // Restart counting from zero
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;             // Start the cycle counter
+}
 
 // Function to calculate Manhattan distance between two points
 int distance(int x1, int y1, int x2, int y2) {
     return abs(x1 - x2) + abs(y1 - y2);  // Return the sum of the absolute differences in x and y coordinates
 }
 
-// Adds a node to the open_list
+// Function to calculate the shortest Manhattan distance for a ghost: straight, or through the tunnel
+// (one step from one end to the other). Never more than the real route, so A* stays optimal.
+int ghost_distance(int x1, int y1, int x2, int y2) {
+    int direct = distance(x1, y1, x2, y2);
+    int left = distance(x1, y1, TUNNEL_LEFT_X, TUNNEL_ROW) + 1 + distance(TUNNEL_RIGHT_X, TUNNEL_ROW, x2, y2);
+    int right = distance(x1, y1, TUNNEL_RIGHT_X, TUNNEL_ROW) + 1 + distance(TUNNEL_LEFT_X, TUNNEL_ROW, x2, y2);
+
+    if (left < direct) {
+        direct = left;
+    }
+    return right < direct ? right : direct;
+}
+
+// Function to calculate the lower bound of a ghost route used by the searches: the Manhattan bound, raised by
+// the landmarks. For any landmark L the route is at least |d(L, target) - d(L, start)| (triangle inequality).
+int ghost_heuristic(int x1, int y1, int x2, int y2) {
+    int h = ghost_distance(x1, y1, x2, y2);
+#if USE_LANDMARKS
+    uint16_t from = maze_cell_index[y1][x1];
+    uint16_t to = maze_cell_index[y2][x2];
+    int i;
+
+    if (from != MAZE_NO_CELL && to != MAZE_NO_CELL) {
+        for (i = 0; i < LANDMARK_COUNT; i++) {
+            int d = landmark_dist[from][i] - landmark_dist[to][i];
+            if (d < 0) {
+                d = -d;
+            }
+            if (d > h) {
+                h = d;
+            }
+        }
+    }
+#endif
+    return h;
+}
+
+// Function to check if a ghost may stand on a cell (inside the board and not a wall)
+int is_ghost_cell(int x, int y) {
+    if (x < 0 || x >= COLS || y < 0 || y >= ROWS ||
+        game_map[y][x] == '#' || game_map[y][x] == '=' || game_map[y][x] == '|') {
+        return 0;  // Invalid position
+    }
+
+    // The tunnel openings lead off the board: ghosts never step on them
+    if (game_map[y][x] == TELEPORT_LEFT || game_map[y][x] == TELEPORT_RIGHT) {
+        return 0;
+    }
+
+    return 1;
+}
+
+// Function to move a cell one step in direction dir (DIR_*), wrapping through the tunnel like Pac-Man does
+void ghost_move(int *x, int *y, int dir) {
+    *x += dx[dir];
+    *y += dy[dir];
+    if (*x >= 0 && *x < COLS && *y >= 0 && *y < ROWS) {
+        // Only walking into an opening wraps; from outside the board it stays a wall
+        if (dir == DIR_LEFT && game_map[*y][*x] == TELEPORT_LEFT) {
+            *x = TUNNEL_RIGHT_X;
+        } else if (dir == DIR_RIGHT && game_map[*y][*x] == TELEPORT_RIGHT) {
+            *x = TUNNEL_LEFT_X;
+        }
+    }
+}
+
+// Function to check if a ghost on (x, y) may take one step in direction dir (DIR_*)
+int ghost_can_move(int x, int y, int dir) {
+    ghost_move(&x, &y, dir);
+    return is_ghost_cell(x, y);
+}
+
+#if !USE_NEXTHOP_TABLE
+// Returns 1 if the node in slot a must leave the heap before the node in slot b
+static int heap_before(int a, int b) {
+    if (open_list[a].f != open_list[b].f) {
+        return open_list[a].f < open_list[b].f;  // Lowest F first
+    }
+    return open_list[a].f - open_list[a].g < open_list[b].f - open_list[b].g;  // On ties prefer the node closer to the goal
+}
+
+// Swaps two heap slots and keeps open_index in sync
+static void heap_swap(int a, int b) {
+    Node tmp = open_list[a];
+    open_list[a] = open_list[b];
+    open_list[b] = tmp;
+    open_index[open_list[a].y][open_list[a].x] = a;
+    open_index[open_list[b].y][open_list[b].x] = b;
+}
+
+// Moves the node in slot i up until its parent has a lower F
+static void heap_sift_up(int i) {
+    while (i > 0) {
+        int parent = (i - 1) / 2;
+        if (!heap_before(i, parent)) {
+            break;
+        }
+        heap_swap(i, parent);
+        i = parent;
+    }
+}
+
+// Moves the node in slot i down until both children have a higher F
+static void heap_sift_down(int i) {
+    while (1) {
+        int left = 2 * i + 1;
+        int right = left + 1;
+        int smallest = i;
+
+        if (left < open_list_counter && heap_before(left, smallest)) {
+            smallest = left;
+        }
+        if (right < open_list_counter && heap_before(right, smallest)) {
+            smallest = right;
+        }
+        if (smallest == i) {
+            break;
+        }
+        heap_swap(i, smallest);
+        i = smallest;
+    }
+}
+
+// Starts a new search generation, invalidating the per-cell state of the previous one
+static void new_search_generation() {
+    search_gen++;
+    if (search_gen == 0) {
+        // The stamp wrapped around: old stamps could alias, so clear them once
+        memset(cell_gen, 0, sizeof(cell_gen));
+        memset(closed_gen, 0, sizeof(closed_gen));
+        search_gen = 1;
+    }
+}
+
+// Returns 1 if the cell has already been expanded in the current search
+static int is_closed(int x, int y) {
+    return closed_gen[y] == search_gen && (closed_map[y] & (1u << x));
+}
+
+// Marks the cell as expanded in the current search
+static void mark_closed(int x, int y) {
+    if (closed_gen[y] != search_gen) {
+        closed_gen[y] = search_gen;  // First cell closed on this row in this search
+        closed_map[y] = 0;
+    }
+    closed_map[y] |= 1u << x;
+}
+
+// Adds a node to the open_list, or lowers its cost if the cell is already queued (decrease-key)
 void add_open_list(Node node) {
+    int slot;
+
+    if (cell_gen[node.y][node.x] == search_gen) {
+        if (node.g >= best_g[node.y][node.x]) {
+            return;  // Dominated: the cell was already reached at the same or lower cost
+        }
+        best_g[node.y][node.x] = node.g;
+        slot = open_index[node.y][node.x];
+    } else {
+        cell_gen[node.y][node.x] = search_gen;  // First time this search reaches the cell
+        best_g[node.y][node.x] = node.g;
+        open_index[node.y][node.x] = -1;  // Drop the slot left over from an older search
+        slot = -1;
+    }
+
+    if (slot >= 0) {
+        open_list[slot].g = node.g;  // Shorter route found: update the queued entry in place
+        open_list[slot].f = node.f;
+        open_list[slot].previous_index = node.previous_index;
+        heap_sift_up(slot);
+        return;
+    }
+
     if (open_list_counter >= MAX_NODE) {
 				overflow++;
         return;  // Prevent adding beyond the maximum limit
     }
-    open_list[open_list_counter] = node;  // Store the node in the open_list
+    open_list[open_list_counter] = node;  // Store the node in the last heap slot
+    open_index[node.y][node.x] = open_list_counter;
     open_list_counter++;  // Increment the open list counter
+    heap_sift_up(open_list_counter - 1);  // Restore the heap order
+    if (open_list_counter > open_list_peak) {
+        open_list_peak = open_list_counter;
+    }
 }
 
 // Adds a node to the closed_list
@@ -48,29 +289,24 @@ void add_closed_list(Node node) {
 				overflow++;
         return;  // Prevent adding beyond the maximum limit
     }
+    mark_closed(node.x, node.y);  // Record the cell in the visited bitmap
     closed_list[closed_list_counter] = node;  // Store the node in the closed_list
     closed_list_counter++;  // Increment the closed list counter
 }
 
-// Extracts the node with the lowest F value from the open_list
+// Extracts the node with the lowest F value from the open_list (heap root)
 Node pop_lowest_f() {
-    int min_index = 0;  // Index of the node with the lowest F value
-    int i, j;
+    Node node = open_list[0];  // The root always holds the lowest F value
 
-    // Find the node with the lowest F value in the open_list
-    for (i = 1; i < open_list_counter; i++) {
-        if (open_list[i].f < open_list[min_index].f) {
-            min_index = i;
-        }
-    }
-
-    Node node = open_list[min_index];  // Extract the node with the lowest F value
+    open_index[node.y][node.x] = -1;  // The cell is no longer queued
+    open_list_counter--;  // Decrease the open list counter
 
-    // Remove the node from open_list by shifting the remaining elements
-    for (j = min_index; j < open_list_counter - 1; j++) {
-        open_list[j] = open_list[j + 1];
+    if (open_list_counter > 0) {
+        // Move the last node to the root and let it sink to its place
+        open_list[0] = open_list[open_list_counter];
+        open_index[open_list[0].y][open_list[0].x] = 0;
+        heap_sift_down(0);
     }
-    open_list_counter--;  // Decrease the open list counter
 
     return node;
 }
@@ -81,8 +317,7 @@ Node createNode(int x, int y, int g, int previous_index) {
     node.x = x;  // Set x-coordinate
     node.y = y;  // Set y-coordinate
     node.g = g;  // Set the g value (cost from the start node)
-    node.h = distance(x, y, dest_x, dest_y);  // Set the h value (heuristic distance to the goal)
-    node.f = g + node.h;  // Set the f value (sum of g and h)
+    node.f = g + ghost_heuristic(x, y, dest_x, dest_y);  // Set the f value (g plus the heuristic distance to the goal)
     node.previous_index = previous_index;  // Set the index of the previous node
 
     return node;  // Return the created node
@@ -90,111 +325,234 @@ Node createNode(int x, int y, int g, int previous_index) {
 
 // Function to check if a position is valid and not in closed_list
 int isValidPosition(int x, int y) {
-    int j;
+    return is_ghost_cell(x, y) && !is_closed(x, y);  // Constant-time visited check
+}
+#endif
 
-    if (x < 0 || x >= COLS || y < 0 || y >= ROWS ||
-        game_map[y][x] == '#' || game_map[y][x] == '=' || game_map[y][x] == '|') {
-        return 0;  // Invalid position
+
+// Function to get the cell up to steps cells ahead of Pac-Man along his heading (stops before a wall)
+static void pacman_ahead(int steps, int *x, int *y) {
+    int dir;
+
+    *x = pacman_x;
+    *y = pacman_y;
+    switch (command) {
+    case 'D': dir = DIR_DOWN; break;
+    case 'R': dir = DIR_RIGHT; break;
+    case 'U': dir = DIR_UP; break;
+    case 'L': dir = DIR_LEFT; break;
+    default: return;  // Not moving yet
+    }
+    while (steps-- > 0 && ghost_can_move(*x, *y, dir)) {
+        ghost_move(x, y, dir);
     }
+}
 
-    // Check if the position is already in the closed_list
-    for (j = 0; j < closed_list_counter; j++) {
-        if (j >= MAX_NODE) {  // Safety check for overflow
-            break;
+// Function to calculate the chase target of a ghost from its target rule (O(1): safe from TIMER2)
+static void chase_target(const Ghost *ghost, int *tx, int *ty) {
+    int x, y;
+
+    *tx = pacman_x;  // TARGET_PACMAN, and the fallback of the other rules
+    *ty = pacman_y;
+    switch (ghost->target_rule) {
+    case TARGET_AHEAD:
+        pacman_ahead(4, tx, ty);
+        break;
+    case TARGET_FLANK:
+        pacman_ahead(2, &x, &y);
+        x = 2 * x - ghosts[GHOST_BLINKY].x;  // Blinky's cell mirrored around it
+        y = 2 * y - ghosts[GHOST_BLINKY].y;
+        if (is_ghost_cell(x, y)) {
+            *tx = x;
+            *ty = y;
         }
-        if (closed_list[j].x == x && closed_list[j].y == y) {
-            return 0;  // Position is in closed_list, not valid
+        break;
+    case TARGET_SHY:
+        if (ghost_distance(ghost->x, ghost->y, pacman_x, pacman_y) <= 8) {
+            *tx = CORNER_LEFT_X;  // Too close: back off to the bottom-left corner
+            *ty = CORNER_BOTTOM_Y;
         }
+        break;
+    default:
+        break;
     }
-
-    return 1;  // Valid position
 }
 
-
-// Function to calculate the destination of the path based on power mode
-void compute_destination() {
-    switch (is_power_mode) {
-    case PM_OFF:
-        dest_x = pacman_x;  // If power mode is off, set Blinky's destination to Pacman's current position
-        dest_y = pacman_y;
+// Function to calculate the destination of a ghost's path based on its mode.
+// Returns 1 if the destination is where fleeing up the distance field ends (the route needs no search).
+static int compute_destination(const Ghost *ghost) {
+    switch (ghost->mode) {
+    case GHOST_CHASE:
+        chase_target(ghost, &dest_x, &dest_y);
+        break;
+    case GHOST_EATEN:
+        dest_x = HOME_X;  // The eyes go back to the ghost house and wait there until it respawns
+        dest_y = HOME_Y;
         break;
-    case PM_ON:
-        // If power mode is on, set a predefined destination based on Pacman's position
+    case GHOST_FRIGHTENED:
+        // Climb the distance field away from Pac-Man (rebuilt only when he changed cell)
+        flow_field_update();
+        if (flow_field_flee_target(ghost->x, ghost->y, &dest_x, &dest_y)) {
+            return 1;
+        }
+        // Pac-Man is off the ghost cells (tunnel opening): set a predefined destination based on his position
         if (pacman_x <= COLS / 2 && pacman_y <= ROWS / 2) {
-            dest_x = 27;
-            dest_y = 33;
+            dest_x = CORNER_RIGHT_X;
+            dest_y = CORNER_BOTTOM_Y;
         } else if (pacman_x <= COLS / 2 && pacman_y >= ROWS / 2) {
-            dest_x = 27;
-            dest_y = 6;
+            dest_x = CORNER_RIGHT_X;
+            dest_y = CORNER_TOP_Y;
         } else if (pacman_x >= COLS / 2 && pacman_y <= ROWS / 2) {
-            dest_x = 2;
-            dest_y = 33;
+            dest_x = CORNER_LEFT_X;
+            dest_y = CORNER_BOTTOM_Y;
         } else if (pacman_x >= COLS / 2 && pacman_y >= ROWS / 2) {
-            dest_x = 2;
-            dest_y = 6;
+            dest_x = CORNER_LEFT_X;
+            dest_y = CORNER_TOP_Y;
         }
         break;
     default:
-        dest_x = pacman_x;  // Default fallback destination if no power mode is set
+        dest_x = pacman_x;  // Default fallback destination if no mode is set
         dest_y = pacman_y;
         break;
     }
+    return 0;
 }
 
-// Function to find the shortest path to the destination using A* algorithm
-void find_path() {
-    if (find_lock) {
-				race_condition = 1;
-        return;  // Prevent concurrent access to this function
+// Function to check that a ghost still stands where its path expects it
+// (a lost life or an eaten ghost moves it back to the spawn point before the new path is ready)
+static int path_at_ghost(const Ghost *ghost) {
+    return ghost->cursor.cell.x == ghost->x && ghost->cursor.cell.y == ghost->y;
+}
+
+// Function to get the next cell of a ghost's path and consume it (call only while steps are left)
+static PathStep path_next(Ghost *ghost) {
+    ghost->heading = path_iter_next(&ghost->cursor);
+    return ghost->cursor.cell;
+}
+
+// Fills plan_path by following next_direction() from the plan start until it returns -1 (no search involved)
+static void follow_directions(int (*next_direction)(int x, int y)) {
+    int x = plan_path.start.x, y = plan_path.start.y;
+    int dir;
+
+    // Walk the route from the start, one lookup per step
+    path_begin(&plan_path, x, y);
+    while ((dir = next_direction(x, y)) >= 0 && path_append(&plan_path, dir)) {
+        ghost_move(&x, &y, dir);
     }
-    find_lock = LOCK_ACQUIRED;  // Acquire lock
+    if (x != dest_x || y != dest_y) {
+        path_clear(&plan_path);  // The directions ran out before the destination: no route
+    }
+}
 
-    int i;
-    compute_destination();  // Compute the destination for Blinky
+// Fills plan_path by climbing the distance field away from Pac-Man (one lookup per step: always done in one slice)
+static int flee_resume(int budget) {
+    (void)budget;  // One-shot: the lookups are not counted against the slice
+    follow_directions(flow_field_flee_direction);
+    return 1;
+}
+
+// Next step toward (dest_x, dest_y) down its baked field
+static int static_direction(int x, int y) {
+    return static_field_direction(plan_field, x, y);
+}
 
-    // Reset global variables
-    path_counter = 0;
+// Fills plan_path by walking down the baked field of a fixed target (one lookup per step: always done in one slice)
+static int static_resume(int budget) {
+    (void)budget;  // One-shot: the lookups are not counted against the slice
+    follow_directions(static_direction);
+    return 1;
+}
+
+#if USE_NEXTHOP_TABLE
+// Returns the first direction (DIR_*) of a shortest route from (x, y) to (tx, ty), -1 if there is none
+int nexthop_direction(int x, int y, int tx, int ty) {
+    uint16_t from = maze_cell_index[y][x];
+    uint16_t to = maze_cell_index[ty][tx];
+
+    if (from == MAZE_NO_CELL || to == MAZE_NO_CELL || from == to) {
+        return -1;  // Not a ghost cell, or already there
+    }
+    return (nexthop_table[from][to >> 2] >> ((to & 3) * 2)) & 3;
+}
+
+// Next step toward (dest_x, dest_y) according to the next-hop table
+static int table_direction(int x, int y) {
+    return nexthop_direction(x, y, dest_x, dest_y);
+}
+
+// Fills plan_path by following the next-hop table (one lookup per step: always done in one slice)
+static int table_resume(int budget) {
+    (void)budget;  // One-shot: the lookups are not counted against the slice
+    follow_directions(table_direction);
+    return 1;
+}
+#else
+// Starts an A* search from the plan start to (dest_x, dest_y)
+static void astar_begin() {
     open_list_counter = 0;
     closed_list_counter = 0;
-    current_step = 0;
+    astar_expansions = 0;
+    open_list_peak = 0;
+    new_search_generation();  // Forget the previous search without clearing the grids
 
-    // Add starting node (Blinkys position) to open_list
-    add_open_list(createNode(blinky_x, blinky_y, 0, -1));
+    // Add starting node (Blinky's position) to open_list
+    add_open_list(createNode(plan_path.start.x, plan_path.start.y, 0, NO_PARENT));
+}
+
+// Runs the A* search for at most budget expansions; returns 1 once plan_path holds the result
+static int astar_resume(int budget) {
+    int i;
 
     // While there are nodes to explore in the open_list
     while (open_list_counter > 0) {
+        if (budget-- <= 0) {
+            return 0;  // Slice used up: the open and closed lists carry over to the next one
+        }
+
         // Extract the node with the lowest F value
         Node current = pop_lowest_f();
+        astar_expansions++;
 
         // If the target node is reached, reconstruct the path
         if (current.x == dest_x && current.y == dest_y) {
             add_closed_list(current);  // Add the target node to the closed_list
 
-            // Reconstruct the path from the destination to the start node
+            // The path has one cell per node on the chain back to the start node
             int current_index = closed_list_counter - 1;  // Index of the last added node
 
-            while (current_index != -1) {
-                PathStep step;  // Create a temporary path step
-                step.x = closed_list[current_index].x;
-                step.y = closed_list[current_index].y;
-
-                path[path_counter++] = step;  // Insert the step into the path
-
-                // Move to the previous node in the closed_list
+            plan_path.length = 0;
+            while (current_index != NO_PARENT) {
+                plan_path.length++;
                 current_index = closed_list[current_index].previous_index;
             }
 
-            current_step = path_counter - 1;  // Set the current step to the last step in the path
-            find_lock = LOCK_RELEASED;  // Release the lock
-            return;  // Path found, exit the function
+            // Walk the chain again, writing the directions from the last step back to the first
+            current_index = closed_list_counter - 1;
+            for (i = plan_path.length - 2; i >= 0; i--) {
+                Node *to = &closed_list[current_index];
+                Node *from = &closed_list[to->previous_index];
+                int dir;
+
+                for (dir = 0; dir < 4; dir++) {
+                    int x = from->x, y = from->y;
+                    ghost_move(&x, &y, dir);
+                    if (x == to->x && y == to->y) {
+                        break;  // The tunnel counts: its two ends are one step apart
+                    }
+                }
+                path_put(&plan_path, i, dir);
+                current_index = to->previous_index;
+            }
+            return 1;  // Path found
         }
 
         add_closed_list(current);  // Add the current node to the closed_list
 
         // Explore neighbors (right, down, left, up)
         for (i = 0; i < 4; i++) {
-            int new_x = current.x + dx[i];
-            int new_y = current.y + dy[i];
+            int new_x = current.x, new_y = current.y;
+            ghost_move(&new_x, &new_y, i);  // Through the tunnel too
 
             // Check if the neighbor position is valid
             if (isValidPosition(new_x, new_y)) {
@@ -203,101 +561,593 @@ void find_path() {
             }
         }
     }
+
+    path_clear(&plan_path);  // No route: Blinky stays where he is
+    return 1;
 }
 
-// Moves Blinky along the calculated path
-void move_blinky() {
-		if (move_lock) {
-				race_condition = 1;
-				return;
-		}
-		move_lock = LOCK_ACQUIRED;
-		
-		if (current_step < 0) {
-        move_lock = LOCK_RELEASED;
-        return;  // Non ci sono pi passi nel percorso
-    }
-		
-    int x_current = blinky_x * CELL_SIZE;
-    int y_current = blinky_y * CELL_SIZE;
-		
-		game_map[blinky_y][blinky_x] = previous_cell;
-
-    // Coordinates of the next step
-    int x_next = path[current_step].x * CELL_SIZE;
-    int y_next = path[current_step].y * CELL_SIZE;
-
-    // Erase Blinky's current position
-    switch (previous_cell) {
-        case PILL:
-            x_current += 4;
-            y_current += 4;
-            draw_circle(x_current, y_current, 4, Black);
-            LCD_DrawLine(x_current, y_current, x_current, y_current+1, White);
-            x_current += 1;
-            LCD_DrawLine(x_current, y_current, x_current, y_current+1, White);
-            break;
+// Function to run the cell A* from (sx, sy) to (tx, ty) to the end into path, whatever planner plan_begin() would
+// pick for that target (host benchmarks: never while a search is running). Returns the route length, -1 if none.
+int astar_route(int sx, int sy, int tx, int ty, PackedPath *path) {
+    path_begin(path, sx, sy);
+    path_clear(path);
+    if (plan_running || !is_ghost_cell(sx, sy) || !is_ghost_cell(tx, ty)) {
+        return -1;
+    }
+    dest_x = tx;
+    dest_y = ty;
+    path_begin(&plan_path, sx, sy);
+    astar_begin();
+    astar_resume(PLAN_UNBOUNDED);
+    path_copy(path, &plan_path);
+    return path->length - 1;
+}
 
-        case POWER_PILL:
-            draw_circle(x_current+4, y_current+4, 4, Black);
-            draw_circle(x_current+4, y_current+4, 3, White);
-            break;
+#if USE_HPA
+// Fills plan_path from a route planned on the HPA* entrances (~80 nodes, a few cluster BFS: always done in one slice)
+static int hpa_resume(int budget) {
+    (void)budget;  // One-shot: hpa_plan() is not resumable, its entrance search is not counted against the slice
+    if (!hpa_plan(plan_path.start.x, plan_path.start.y, dest_x, dest_y)) {
+        path_clear(&plan_path);
+        return 1;  // No route: the ghost stays where it is
+    }
+    follow_directions(hpa_route_direction);
+    return 1;
+}
+#endif
+#if USE_JUNCTION_GRAPH
+// Searches the junction graph for at most budget node expansions; returns 1 once plan_path holds the route
+// (the junction turns only: the ghost walks the corridors in between as it moves)
+static int junction_resume(int budget) {
+    return junction_search(budget, &plan_path);
+}
+#endif
 
-        case DOOR:
-            draw_circle(x_current+4, y_current+4, 4, Black);
-            y_current += 5;
-            LCD_DrawLine(x_current, y_current, x_current+8, y_current, Magenta);
-            break;
+#if USE_DSTAR_LITE
+// Repairs the incremental search toward Pac-Man for at most budget expansions, then fills plan_path
+static int dstar_resume(int budget) {
+    if (!dstar_compute(budget)) {
+        return 0;  // Repair not finished: it carries over to the next slice
+    }
+    follow_directions(dstar_direction);
+    return 1;
+}
+#else
+// Rebuilds the shared distance field toward Pac-Man for at most budget BFS layers, then fills plan_path from it
+static int flow_field_resume(int budget) {
+    if (!flow_field_step(budget)) {
+        return 0;  // Rebuild not finished (Pac-Man changed cell): it carries over to the next slice
+    }
+    flow_field_root(&dest_x, &dest_y);  // Where Pac-Man was when the rebuild started: he may have moved since
+    follow_directions(flow_field_direction);
+    return 1;
+}
+#endif
+#endif
+
+// Function to stop any search in progress and start planning from a ghost's current cell
+static void plan_begin(Ghost *ghost) {
+    int x = ghost->x, y = ghost->y;
+    int fleeing = compute_destination(ghost);  // Compute the destination for the ghost
+
+    plan_ghost = ghost;
+    path_begin(&plan_path, x, y);
+    path_clear(&plan_path);  // No route until the search gives one
 
+    if (!is_ghost_cell(x, y) || !is_ghost_cell(dest_x, dest_y)) {
+        plan_resume = 0;  // Nothing to search: publish "no route" right away
+        return;
+    }
+    if (fleeing) {
+        plan_resume = flee_resume;  // Frightened: the field gives every step, whatever the planner
+        return;
+    }
+    plan_field = static_field_find(dest_x, dest_y);
+    if (plan_field >= 0) {
+        plan_resume = static_resume;  // Ghost house or corner: walk down the field baked into flash
+        return;
+    }
+#if USE_NEXTHOP_TABLE
+    plan_resume = table_resume;
+#else
+    if (dest_x == pacman_x && dest_y == pacman_y) {
+#if USE_DSTAR_LITE
+        dstar_update(ghost - ghosts, x, y, dest_x, dest_y);  // Chasing: repair the ghost's previous search
+        plan_resume = dstar_resume;
+#else
+        plan_resume = flow_field_resume;  // Chasing: share the distance field toward Pac-Man
+#endif
+    } else {
+#if USE_HPA
+        if (!hpa_overflow) {
+            plan_resume = hpa_resume;  // Other targets: search the cluster entrances, refine block by block
+            return;
+        }
+#endif
+#if USE_JUNCTION_GRAPH
+        if (!junction_overflow) {
+            junction_begin(x, y, dest_x, dest_y);
+            plan_resume = junction_resume;  // Other targets: search the junction graph
+            return;
+        }
+#endif
+        astar_begin();
+        plan_resume = astar_resume;
+    }
+#endif
+}
+
+// Function to hand the finished plan to its ghost; returns 0 if the ghost left the planned route meanwhile
+static int plan_publish() {
+    Ghost *ghost = plan_ghost;
+    int gx = ghost->x, gy = ghost->y;  // TIMER2 may move it while we look: checked again below
+    int published = 0, found;
+    PathIter it;
+
+    // The ghost kept walking its previous path while the search ran: find its cell along the new one
+    path_iter_begin(&it, &plan_path);
+    found = path_iter_seek(&it, gx, gy);
+
+    __disable_irq();  // move_ghosts (TIMER2) must never see a half-copied path
+    if (plan_path.length == 0) {
+        path_clear(&ghost->path);
+        path_iter_begin(&ghost->cursor, &ghost->path);  // No route: the ghost stays where it is
+        published = 1;
+    } else if (found && ghost->x == gx && ghost->y == gy) {
+        path_copy(&ghost->path, &plan_path);
+        ghost->cursor = it;                  // The next cell is the one after the ghost's
+        ghost->cursor.path = &ghost->path;
+        ghost->dest_x = dest_x;
+        ghost->dest_y = dest_y;
+        published = 1;
+    }
+    __enable_irq();
+    return published;
+}
+
+// Function to start the search of the next ghost waiting for a path, in turn; returns 0 if none is waiting
+static int plan_next() {
+    int i;
+
+    for (i = 0; i < NUM_GHOSTS; i++) {
+        Ghost *ghost = &ghosts[(plan_turn + i) % NUM_GHOSTS];
+
+        if (plan_pending & GHOST_BIT(ghost)) {
+            plan_pending &= ~GHOST_BIT(ghost);
+            plan_turn = (ghost - ghosts + 1) % NUM_GHOSTS;  // The next ghost goes first next time
+            plan_begin(ghost);
+            plan_running = 1;
+            return 1;
+        }
+    }
+    return 0;
+}
+
+// Function to ask for new paths for all the ghosts (safe from interrupt handlers: the searches run in the main loop)
+void request_replan() {
+    atomic_fetch_or(&plan_requests, (1u << NUM_GHOSTS) - 1);
+    job_post(JOB_REPLAN);
+}
+
+// Function to ask for new paths for some of the ghosts only (one GHOST_BIT per ghost)
+static void request_replan_ghosts(uint32_t ghost_bits) {
+    atomic_fetch_or(&plan_requests, ghost_bits);
+    job_post(JOB_REPLAN);
+}
+
+// Function to run one slice of at most budget expansions; returns 1 while searches are still in progress or waiting
+int plan_slice(int budget) {
+    int done = 1;
+
+    if (find_lock) {
+        race_condition = 1;
+        return plan_busy();  // Somebody else is planning: try again on the next pass
+    }
+    find_lock = LOCK_ACQUIRED;  // Acquire lock
+
+    uint32_t start_cycles = DWT->CYCCNT;
+
+    if (plan_running || plan_next()) {
+        if (plan_resume) {
+            done = plan_resume(budget);
+        }
+        if (done) {
+            plan_running = 0;
+            plan_searches++;
+            if (!plan_publish()) {
+                plan_pending |= GHOST_BIT(plan_ghost);  // It left the planned route meanwhile: plan again
+            }
+        }
+    }
+
+    // Track the cost of the slice (the counter wraps, unsigned math handles it)
+    find_path_cycles = DWT->CYCCNT - start_cycles;
+    if (find_path_cycles > find_path_cycles_max) {
+        find_path_cycles_max = find_path_cycles;
+    }
+    plan_tick_cycles += find_path_cycles;
+    plan_cycles_total += find_path_cycles;
+
+    find_lock = LOCK_RELEASED;  // Release the lock, also when no path exists
+    return plan_busy();
+}
+
+// Function to check if a search is running or a ghost is waiting for one
+int plan_busy() {
+    return plan_running || plan_pending != 0;
+}
+
+// Function to queue a new search for every ghost (called by the job loop when a replan was requested).
+// A search already running is finished first, so a steady stream of requests cannot starve it.
+void plan_restart() {
+    uint32_t requests = atomic_exchange(&plan_requests, 0);
+
+    if (!arcade_steering) {
+        plan_pending |= requests;  // Steering ghosts need no path
+    }
+}
+
+// Function to close the planning account of a ghost tick (called by the job loop on JOB_TICK)
+void plan_tick() {
+    if (plan_tick_cycles > plan_tick_cycles_max) {
+        plan_tick_cycles_max = plan_tick_cycles;
+    }
+    plan_tick_cycles_last = plan_tick_cycles;
+    plan_tick_cycles = 0;
+}
+
+// Function to find the shortest paths of all the ghosts right away, without slicing
+void find_path() {
+    atomic_fetch_or(&plan_requests, (1u << NUM_GHOSTS) - 1);
+    plan_restart();
+    while (plan_slice(PLAN_UNBOUNDED)) {
+    }
+}
+
+// Function to find the shortest path of one ghost right away, without slicing
+void ghost_find_path(Ghost *ghost) {
+    plan_pending |= GHOST_BIT(ghost);
+    while (plan_slice(PLAN_UNBOUNDED)) {
+    }
+}
+
+// Function to put a ghost on a cell of the map, keeping what lies under it
+static void ghost_place(Ghost *ghost, int x, int y) {
+    Ghost *other = ghost_at(x, y, ghost);
+
+    ghost->x = x;
+    ghost->y = y;
+    ghost->previous_cell = other ? other->previous_cell : game_map[y][x];  // Another ghost already covers it
+    path_clear(&ghost->path);
+    path_iter_begin(&ghost->cursor, &ghost->path);  // No path until the next search
+    ghost->heading = DIR_UP;   // Out of the ghost house
+    game_map[y][x] = BLINKY;
+    render_mark(x, y);
+}
+
+// Function to take a ghost off the map, giving back what lay under it unless another ghost still stands there
+static void ghost_lift(Ghost *ghost) {
+    Ghost *other = ghost_at(ghost->x, ghost->y, ghost);
+
+    if (other) {
+        other->previous_cell = ghost->previous_cell;
+    } else {
+        game_map[ghost->y][ghost->x] = ghost->previous_cell;
+    }
+    render_mark(ghost->x, ghost->y);  // The ghost below, or what lay under it, shows again
+}
+
+// Function to set up the ghosts in the ghost house (first game start)
+void ghosts_init() {
+    int i;
+
+    for (i = 0; i < NUM_GHOSTS; i++) {
+        ghosts[i].x = -1;  // Not on the board yet: ghost_at() must not find them
+        ghosts[i].y = -1;
+    }
+    for (i = 0; i < NUM_GHOSTS; i++) {
+        Ghost *ghost = &ghosts[i];
+
+        ghost->spawn_x = ghost_setup[i].x;
+        ghost->spawn_y = ghost_setup[i].y;
+        ghost->target_rule = ghost_setup[i].target_rule;
+        ghost->color = ghost_setup[i].color;
+        ghost->mode = GHOST_CHASE;
+        ghost_place(ghost, ghost->spawn_x, ghost->spawn_y);
+        if (ghost->previous_cell == BLINKY) {
+            ghost->previous_cell = EMPTY;  // Blinky's spawn is marked in the game_map literal
+        }
+    }
+}
+
+// Function to send every ghost back to the ghost house (lost life)
+void ghosts_reset() {
+    int i;
+
+    // Lift them all first, so that two ghosts sharing a cell give back what lies under them
+    for (i = NUM_GHOSTS - 1; i >= 0; i--) {
+        ghost_lift(&ghosts[i]);
+        ghosts[i].x = -1;
+        ghosts[i].y = -1;
+    }
+    for (i = 0; i < NUM_GHOSTS; i++) {
+        ghosts[i].mode = GHOST_CHASE;
+        ghost_place(&ghosts[i], ghosts[i].spawn_x, ghosts[i].spawn_y);
+    }
+}
+
+// Function to start (on = 1) or end (on = 0) the frightened mode of the ghosts; ending it also respawns eaten ones
+void ghosts_frighten(int on) {
+    int i;
+
+    for (i = 0; i < NUM_GHOSTS; i++) {
+        if (on && ghosts[i].mode != GHOST_EATEN) {
+            ghosts[i].mode = GHOST_FRIGHTENED;
+        } else if (!on) {
+            ghosts[i].mode = GHOST_CHASE;
+        }
+        render_mark(ghosts[i].x, ghosts[i].y);  // New colour on the next frame
+    }
+}
+
+// Function to find the ghost standing on a cell other than except, 0 if there is none
+Ghost *ghost_at(int x, int y, const Ghost *except) {
+    int i;
+
+    for (i = 0; i < NUM_GHOSTS; i++) {
+        if (&ghosts[i] != except && ghosts[i].x == x && ghosts[i].y == y) {
+            return &ghosts[i];
+        }
+    }
+    return 0;
+}
+
+// Function to get the sprite (SPRITE_*) a ghost is drawn with
+int ghost_sprite(const Ghost *ghost) {
+    if (ghost->mode == GHOST_EATEN) {
+        return SPRITE_EYES;
+    }
+    return ghost->mode == GHOST_FRIGHTENED ? SPRITE_FRIGHTENED : SPRITE_GHOST + (ghost - ghosts);
+}
+
+// Function to pick the next step (DIR_*) of a ghost the arcade way, -1 to stay: no search, at a junction it
+// takes the exit closest in straight line to its target and it never turns back unless at a dead end
+static int arcade_direction(Ghost *ghost) {
+    static const uint8_t order[4] = {DIR_UP, DIR_LEFT, DIR_DOWN, DIR_RIGHT};  // Arcade tie-break
+    int x = ghost->x, y = ghost->y;
+    int exits = ghost_exits[y][x];
+    int tx, ty, i, best = -1, best_d = 0;
+
+    if (exits & ~(1 << ((ghost->heading + 2) & 3))) {
+        exits &= ~(1 << ((ghost->heading + 2) & 3));  // No turning back
+    }
+    if ((exits & (exits - 1)) == 0) {
+        return exits ? (int)(31 - __CLZ(exits)) : -1;  // Corridor or dead end: a single way on
+    }
+
+    switch (ghost->mode) {
+    case GHOST_EATEN:
+        if (x == HOME_X && y == HOME_Y) {
+            return -1;  // The eyes are home: wait there
+        }
+        tx = HOME_X;
+        ty = HOME_Y;
+        break;
+    case GHOST_FRIGHTENED:
+        arcade_seed = arcade_seed * 1103515245 + 12345;  // Any exit but the way back
+        for (i = (arcade_seed >> 16) & 3; !(exits & (1 << i)); i = (i + 1) & 3) {
+        }
+        return i;
+    default:
+        chase_target(ghost, &tx, &ty);
+        break;
+    }
+
+    // Exit whose next cell is the closest to the target (squared distance, straight line)
+    for (i = 0; i < 4; i++) {
+        int dir = order[i], nx = x, ny = y, d;
+
+        if (exits & (1 << dir)) {
+            ghost_move(&nx, &ny, dir);  // Through the tunnel too, as the mover will take it
+            d = (nx - tx) * (nx - tx) + (ny - ty) * (ny - ty);
+            if (best < 0 || d < best_d) {
+                best = dir;
+                best_d = d;
+            }
+        }
+    }
+    return best;
+}
+
+// Function to switch the ghost AI between the planned paths and the arcade steering (KEY1)
+void arcade_steering_toggle() {
+    arcade_steering = !arcade_steering;
+    request_replan();  // Back to the paths: plan them from where the ghosts stand
+}
+
+// Moves a ghost along its calculated path (or steers it, see arcade_direction()); returns 1 if it ran into Pac-Man
+static int move_ghost(Ghost *ghost) {
+    Ghost *other;
+    PathStep next;
+
+    if (arcade_steering) {
+        int dir = arcade_direction(ghost), x = ghost->x, y = ghost->y;
+
+        if (dir < 0) {
+            return 0;
+        }
+        ghost->heading = dir;
+        ghost_move(&x, &y, dir);
+        next.x = x;
+        next.y = y;
+    } else {
+        if (path_iter_left(&ghost->cursor) <= 0 || !path_at_ghost(ghost)) {
+            return 0;  // Non ci sono pi passi nel percorso
+        }
+        next = path_next(ghost);  // Coordinates of the next step
+    }
+
+    // Take the ghost off its cell (the next frame shows what it was covering)
+    ghost_lift(ghost);
+
+    // Move the ghost to the next step
+    other = ghost_at(next.x, next.y, ghost);
+    ghost->x = next.x;
+    ghost->y = next.y;
+    ghost->previous_cell = other ? other->previous_cell : game_map[next.y][next.x];
+    game_map[next.y][next.x] = BLINKY;
+
+    // Draw the ghost in the new position on the next frame
+    render_mark(ghost->x, ghost->y);
+
+    return ghost->x == pacman_x && ghost->y == pacman_y;
+}
+
+// Function to handle a ghost and Pac-Man meeting on the same cell
+void ghost_collision(Ghost *ghost) {
+    char under;
+
+    if (eat_lock) {
+        return;
+    }
+    if (ghost->mode == GHOST_EATEN) {
+        // Eyes are harmless: Pac-Man eats what lay under them and gets the cell back once they leave
+        under = ghost->previous_cell;
+        ghost->previous_cell = PACMAN;
+        game_map[pacman_y][pacman_x] = under;
+        compute_score(pacman_x, pacman_y);
+        game_map[pacman_y][pacman_x] = PACMAN;
+        return;
+    }
+    eat_lock = LOCK_ACQUIRED;
+
+    // Handle Pacman's interaction with the ghost based on its mode
+    switch (ghost->mode) {
+        case GHOST_FRIGHTENED:
+            ghost->previous_cell = PACMAN;  // The eyes stay on his cell: he shows again once they leave
+            eat_ghost(ghost);  // Eat ghost if in power mode
+            break;
+        case GHOST_CHASE:
+            ghost->previous_cell = EMPTY;  // Pac-Man is moved back to his start cell
+            lose_life();  // Lose life if not in power mode
+            break;
         default:
-            draw_circle(x_current+4, y_current+4, 4, Black);
             break;
     }
 
-    // Move Blinky to the next step
-    blinky_x = path[current_step].x;
-    blinky_y = path[current_step].y;
-		
-		previous_cell = game_map[blinky_y][blinky_x];
-		game_map[blinky_y][blinky_x] = BLINKY;
-
-    // Draw Blinky in the new position
-		switch (is_power_mode) {
-			case PM_ON:
-					draw_circle(x_next+4, y_next+4, 4, Blue);
-					break;
-			case PM_OFF:
-					draw_circle(x_next+4, y_next+4, 4, Red);
-					break;
-			default:
-					draw_circle(x_next+4, y_next+4, 4, Red);
-					break;
-		}
-		
-		// Increment the current step
-    current_step--;
-		
-		move_lock = LOCK_RELEASED;
-		
-		// Check for collision with Blinky
-    if (blinky_x == pacman_x && blinky_y == pacman_y && !eat_lock) {
-				eat_lock = LOCK_ACQUIRED;
-        previous_cell = EMPTY;  // Clear previous cell
-        // Handle Pacman's interaction with Blinky based on power mode
-        switch (is_power_mode) {
-            case PM_ON:
-                eat_ghost();  // Eat ghost if in power mode
-                break;
-            case PM_OFF:
-                lose_life();  // Lose life if not in power mode
-                break;
-            default:
-                is_power_mode = PM_OFF;  // Reset power mode
-                break;
+    request_replan();
+
+    eat_lock = LOCK_RELEASED;
+}
+
+// Moves every ghost one step along its path (TIMER2)
+void move_ghosts() {
+    Ghost *caught = 0;
+    int i;
+
+    if (move_lock) {
+        race_condition = 1;
+        return;
+    }
+    move_lock = LOCK_ACQUIRED;
+
+    for (i = 0; i < NUM_GHOSTS; i++) {
+        if (move_ghost(&ghosts[i]) && (!caught || caught->mode == GHOST_EATEN)) {
+            caught = &ghosts[i];  // Ran into Pac-Man (a ghost that can hurt or be eaten goes before eyes)
+        }
+    }
+
+    move_lock = LOCK_RELEASED;
+
+    // Check for collision with the ghosts (one only: a lost life resets them all)
+    if (caught) {
+        ghost_collision(caught);
+    }
+}
+
+// Function to decide whether a ghost needs a new path on this tick, from cheap signals only: did its target
+// move, how close is Pac-Man, has it any choice where it stands, and is the planner keeping up
+static int replan_governor_wants(Ghost *ghost, int pacman_moved, int overloaded) {
+    int exits = ghost_exits[ghost->y][ghost->x];
+    int tx, ty, moved;
+
+    if (!path_at_ghost(ghost)) {
+        return 1;  // Sent back to the ghost house: its path leads nowhere
+    }
+
+    // Did the target leave the end of the current path?
+    switch (ghost->mode) {
+    case GHOST_FRIGHTENED:
+        moved = pacman_moved;  // The flight is planned away from Pac-Man
+        break;
+    case GHOST_EATEN:
+        moved = ghost->dest_x != HOME_X || ghost->dest_y != HOME_Y;
+        break;
+    default:
+        chase_target(ghost, &tx, &ty);
+        moved = ghost->dest_x != tx || ghost->dest_y != ty;
+        break;
+    }
+    if (!moved) {
+        return 0;  // The current path still ends on the target
+    }
+    if (path_iter_left(&ghost->cursor) <= 0) {
+        return 1;  // Arrived (or no route): nothing else to walk
+    }
+
+    // Overloaded planner, a corridor with no choice to make, or Pac-Man far away: the path may lag a bit
+    exits &= exits - 1;
+    if (overloaded || (exits & (exits - 1)) == 0 ||
+        ghost_distance(ghost->x, ghost->y, pacman_x, pacman_y) > GOVERNOR_NEAR) {
+        return ghost->plan_age >= GOVERNOR_FAR_TICKS;
+    }
+    return 1;  // Close to Pac-Man at a junction: follow him every tick
+}
+
+// Function to request the replans of a ghost tick (TIMER2, after the ghosts moved)
+void replan_tick() {
+    uint32_t wanted = 0;
+    int pacman_moved = pacman_x != governor_pacman_x || pacman_y != governor_pacman_y;
+    int overloaded = plan_busy() || plan_tick_cycles_last > GOVERNOR_BUSY_CYCLES;
+    int i;
+
+    governor_pacman_x = pacman_x;
+    governor_pacman_y = pacman_y;
+    if (arcade_steering) {
+        return;  // No paths to keep up to date
+    }
+    if (!replan_governor) {
+        if (++replan_moves >= REPLAN_INTERVAL) {  // Every ghost every REPLAN_INTERVAL moves
+            replan_moves = 0;
+            request_replan();
         }
-				
-				find_path();
-				
-				eat_lock = LOCK_RELEASED;
+        return;
+    }
+
+    for (i = 0; i < NUM_GHOSTS; i++) {
+        Ghost *ghost = &ghosts[i];
+
+        if (ghost->plan_age < 255) {
+            ghost->plan_age++;
+        }
+        if (replan_governor_wants(ghost, pacman_moved, overloaded)) {
+            wanted |= GHOST_BIT(ghost);
+            ghost->plan_age = 0;
+            replans_triggered++;
+        } else {
+            replans_skipped++;
+        }
+    }
+    if (wanted) {
+        request_replan_ghosts(wanted);
+    }
+}
+
+// Function to update replan_cycles_saved (TIMER1, once per second of play): every skipped replan is
+// counted at the average cost of a search
+void replan_second() {
+    replan_seconds++;
+    if (plan_searches > 0) {
+        replan_cycles_saved = (uint32_t)(plan_cycles_total / plan_searches * replans_skipped / replan_seconds);
     }
 }
@@ -0,0 +1,289 @@
+/*********************************************************************************************************
+**--------------File Info---------------------------------------------------------------------------------
+** File name:          dstar.c
+** Last modified Date:
+** Last Version:
+** Descriptions:       Incremental chase planner (D* Lite). Every ghost has its own search, run backward from
+**                     Pac-Man's cell, which keeps its g/rhs values between calls: when Pac-Man changes cell
+**                     only the two cells whose goal status changed are updated, and the repair stops as soon
+**                     as the ghost's cell is consistent again. The ghost moving is absorbed by the key
+**                     modifier km, which only grows by that ghost's own steps. The state is indexed by
+**                     maze_cell_index, so a search takes about 3 KB.
+**--------------------------------------------------------------------------------------------------------
+*********************************************************************************************************/
+
+#include "functions.h"
+
+#if !USE_NEXTHOP_TABLE && USE_DSTAR_LITE
+
+#define DSTAR_INF 0xFF           // g/rhs of cells with no known route to Pac-Man
+#define DSTAR_KM_LIMIT 0x3000    // Restart the search before the 16-bit keys can overflow
+
+// Entry of the priority queue
+typedef struct {
+    uint16_t k1;                 // min(g, rhs) + h + km
+    uint16_t k2;                 // min(g, rhs)
+    uint8_t x, y;                // Cell
+} DStarEntry;
+
+// Search state of one ghost, kept between calls (cells in maze_cell_index order)
+typedef struct {
+    uint8_t g[MAZE_CELLS];               // Distance to Pac-Man found so far
+    uint8_t rhs[MAZE_CELLS];             // One-step lookahead of g
+    int16_t index[MAZE_CELLS];           // Slot of each queued cell (-1 if not queued)
+    DStarEntry heap[MAZE_CELLS];         // Min-heap on (k1, k2): a cell is queued at most once
+    int heap_count;
+    int start_x, start_y;                // The ghost's cell (the search ends there)
+    int last_x, last_y;                  // The ghost's cell when km was last updated
+    int goal_x, goal_y;                  // Pac-Man's cell (the search starts there)
+    int ready;                           // Set once the search has been started
+    uint16_t km;                         // Sum of the heuristic shifts caused by the ghost's moves
+} DStarSearch;
+
+static DStarSearch ds_searches[NUM_GHOSTS];  // One per ghost
+static DStarSearch *ds = &ds_searches[0];    // Search picked by the last dstar_update()
+
+#define DS_CELL(x, y) maze_cell_index[y][x]  // Slot of a ghost cell in the search arrays
+
+// Statistics
+int dstar_expansions = 0;                  // Cells expanded since the last dstar_update()
+uint32_t dstar_restarts = 0;               // Searches rebuilt from scratch
+
+// Returns 1 if entry a must leave the heap before entry b
+static int ds_before(const DStarEntry *a, const DStarEntry *b) {
+    if (a->k1 != b->k1) {
+        return a->k1 < b->k1;
+    }
+    return a->k2 < b->k2;
+}
+
+// Swaps two heap slots and keeps the index in sync
+static void ds_swap(int a, int b) {
+    DStarEntry tmp = ds->heap[a];
+    ds->heap[a] = ds->heap[b];
+    ds->heap[b] = tmp;
+    ds->index[DS_CELL(ds->heap[a].x, ds->heap[a].y)] = a;
+    ds->index[DS_CELL(ds->heap[b].x, ds->heap[b].y)] = b;
+}
+
+// Moves the entry in slot i up or down until the heap order holds again
+static void ds_fix(int i) {
+    while (i > 0 && ds_before(&ds->heap[i], &ds->heap[(i - 1) / 2])) {
+        ds_swap(i, (i - 1) / 2);
+        i = (i - 1) / 2;
+    }
+    while (1) {
+        int left = 2 * i + 1;
+        int right = left + 1;
+        int smallest = i;
+
+        if (left < ds->heap_count && ds_before(&ds->heap[left], &ds->heap[smallest])) {
+            smallest = left;
+        }
+        if (right < ds->heap_count && ds_before(&ds->heap[right], &ds->heap[smallest])) {
+            smallest = right;
+        }
+        if (smallest == i) {
+            break;
+        }
+        ds_swap(i, smallest);
+        i = smallest;
+    }
+}
+
+// Function to compute the queue key of a cell
+static DStarEntry ds_key(int x, int y) {
+    DStarEntry e;
+    uint16_t c = DS_CELL(x, y);
+    uint8_t m = ds->g[c] < ds->rhs[c] ? ds->g[c] : ds->rhs[c];
+
+    e.k2 = m;
+    e.k1 = (m == DSTAR_INF) ? 0xFFFF : m + ghost_distance(x, y, ds->start_x, ds->start_y) + ds->km;
+    e.x = x;
+    e.y = y;
+    return e;
+}
+
+// Function to queue a cell with its current key, or move it if it is already queued
+static void ds_queue(int x, int y) {
+    uint16_t c = DS_CELL(x, y);
+    int slot = ds->index[c];
+
+    if (slot < 0) {
+        if (ds->heap_count >= MAZE_CELLS) {
+            return;  // Cannot happen: a cell is queued at most once
+        }
+        slot = ds->heap_count++;
+        ds->index[c] = slot;
+    }
+    ds->heap[slot] = ds_key(x, y);
+    ds_fix(slot);
+}
+
+// Function to remove a cell from the queue
+static void ds_dequeue(int x, int y) {
+    uint16_t c = DS_CELL(x, y);
+    int slot = ds->index[c];
+
+    if (slot < 0) {
+        return;
+    }
+    ds->index[c] = -1;
+    ds->heap_count--;
+    if (slot < ds->heap_count) {
+        ds->heap[slot] = ds->heap[ds->heap_count];  // Fill the hole with the last entry
+        ds->index[DS_CELL(ds->heap[slot].x, ds->heap[slot].y)] = slot;
+        ds_fix(slot);
+    }
+}
+
+// Function to recompute rhs of a cell from its neighbours and queue it if it became inconsistent
+static void ds_update_vertex(int x, int y) {
+    uint16_t c = DS_CELL(x, y);
+    int i;
+
+    if (x != ds->goal_x || y != ds->goal_y) {
+        uint8_t best = DSTAR_INF;
+        for (i = 0; i < 4; i++) {
+            int new_x = x, new_y = y;
+            ghost_move(&new_x, &new_y, i);  // Through the tunnel too
+            if (is_ghost_cell(new_x, new_y) && ds->g[DS_CELL(new_x, new_y)] < best - 1) {
+                best = ds->g[DS_CELL(new_x, new_y)] + 1;
+            }
+        }
+        ds->rhs[c] = best;
+    }
+
+    if (ds->g[c] != ds->rhs[c]) {
+        ds_queue(x, y);
+    } else {
+        ds_dequeue(x, y);
+    }
+}
+
+// Function to update the neighbours of a cell whose g changed
+static void ds_update_neighbours(int x, int y) {
+    int i;
+
+    for (i = 0; i < 4; i++) {
+        int new_x = x, new_y = y;
+        ghost_move(&new_x, &new_y, i);
+        if (is_ghost_cell(new_x, new_y)) {
+            ds_update_vertex(new_x, new_y);
+        }
+    }
+}
+
+// Function to expand at most budget cells toward a consistent route from the ghost's cell.
+// Returns 1 once the ghost's cell is consistent and nothing cheaper is left in the queue, 0 if the budget ran
+// out first (the queue is kept, so the next call carries on).
+int dstar_compute(int budget) {
+    uint16_t start = DS_CELL(ds->start_x, ds->start_y);
+
+    while (ds->heap_count > 0) {
+        DStarEntry start_key = ds_key(ds->start_x, ds->start_y);
+        DStarEntry top = ds->heap[0];
+        DStarEntry key;
+        int x = top.x, y = top.y;
+        uint16_t c = DS_CELL(x, y);
+
+        if (!ds_before(&top, &start_key) && ds->g[start] == ds->rhs[start]) {
+            break;  // The route from the ghost's cell is settled
+        }
+        if (budget-- <= 0) {
+            return 0;
+        }
+
+        dstar_expansions++;
+        key = ds_key(x, y);
+        if (ds_before(&top, &key)) {
+            ds->heap[0] = key;  // Stale key (the ghost moved since it was queued): requeue with the new one
+            ds_fix(0);
+        } else if (ds->g[c] > ds->rhs[c]) {
+            ds->g[c] = ds->rhs[c];  // Overconsistent: settle the cell
+            ds_dequeue(x, y);
+            ds_update_neighbours(x, y);
+        } else {
+            ds->g[c] = DSTAR_INF;  // Underconsistent: its old route is gone, recompute it and its neighbours
+            ds_update_vertex(x, y);
+            ds_update_neighbours(x, y);
+        }
+    }
+    return 1;
+}
+
+// Function to forget the previous search and start a new one rooted at Pac-Man's cell
+static void ds_restart(int gx, int gy) {
+    memset(ds->g, DSTAR_INF, sizeof(ds->g));
+    memset(ds->rhs, DSTAR_INF, sizeof(ds->rhs));
+    memset(ds->index, 0xFF, sizeof(ds->index));
+    ds->heap_count = 0;
+    ds->km = 0;
+    ds->last_x = ds->start_x;
+    ds->last_y = ds->start_y;
+    ds->goal_x = gx;
+    ds->goal_y = gy;
+    ds->rhs[DS_CELL(gx, gy)] = 0;
+    ds_queue(gx, gy);
+    ds->ready = 1;
+    dstar_restarts++;
+}
+
+// Function to tell the search of ghost number ghost that it is at (sx, sy) and Pac-Man at (gx, gy);
+// dstar_compute() and dstar_direction() then work on that search. Returns 0 if either cell is not a ghost cell.
+int dstar_update(int ghost, int sx, int sy, int gx, int gy) {
+    if (!is_ghost_cell(sx, sy) || !is_ghost_cell(gx, gy) ||
+        DS_CELL(sx, sy) == MAZE_NO_CELL || DS_CELL(gx, gy) == MAZE_NO_CELL) {
+        return 0;
+    }
+
+    ds = &ds_searches[ghost];
+    ds->start_x = sx;
+    ds->start_y = sy;
+    dstar_expansions = 0;
+
+    if (!ds->ready || ds->km > DSTAR_KM_LIMIT) {
+        ds_restart(gx, gy);
+    } else {
+        // The ghost moved: shift every queued key down by the distance it covered since its last update
+        ds->km += ghost_distance(ds->last_x, ds->last_y, sx, sy);
+        ds->last_x = sx;
+        ds->last_y = sy;
+
+        // Pac-Man moved: only the old and the new goal cells change their rhs
+        if (gx != ds->goal_x || gy != ds->goal_y) {
+            int old_x = ds->goal_x, old_y = ds->goal_y;
+            ds->goal_x = gx;
+            ds->goal_y = gy;
+            ds->rhs[DS_CELL(gx, gy)] = 0;
+            ds_update_vertex(gx, gy);
+            ds_update_vertex(old_x, old_y);
+        }
+    }
+
+    return 1;
+}
+
+// Function to get the next step (DIR_*) toward Pac-Man from (x, y), -1 if already there or unreachable
+int dstar_direction(int x, int y) {
+    int i, best_dir = -1;
+    uint8_t best = ds->g[DS_CELL(x, y)];
+
+    if (best == 0 || best == DSTAR_INF) {
+        return -1;
+    }
+
+    // Pick the neighbour one step closer to Pac-Man
+    for (i = 0; i < 4; i++) {
+        int new_x = x, new_y = y;
+        ghost_move(&new_x, &new_y, i);
+
+        if (is_ghost_cell(new_x, new_y) && ds->g[DS_CELL(new_x, new_y)] < best) {
+            best = ds->g[DS_CELL(new_x, new_y)];
+            best_dir = i;
+        }
+    }
+    return best_dir;
+}
+
+#endif /* !USE_NEXTHOP_TABLE && USE_DSTAR_LITE */
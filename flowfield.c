@@ -0,0 +1,178 @@
+/*********************************************************************************************************
+**--------------File Info---------------------------------------------------------------------------------
+** File name:          flowfield.c
+** Last modified Date:
+** Last Version:
+** Descriptions:       Shared BFS distance field toward Pac-Man. The field is rebuilt only when Pac-Man
+**                     changes cell, a few wavefront layers per planning slice; any number of chasing
+**                     ghosts then read their next step from it by
+**                     comparing the distances of the neighbouring cells, and frightened ghosts flee by
+**                     climbing it instead. Targets that never move (ghost house, corners) have their
+**                     fields baked into flash by tools/gen_maze_tables.py.
+**--------------------------------------------------------------------------------------------------------
+*********************************************************************************************************/
+
+#include "functions.h"
+
+// Distance field
+uint8_t pacman_field[ROWS][COLS];        // Steps from each ghost cell to Pac-Man (FIELD_UNREACHABLE elsewhere)
+static int field_x = -1, field_y = -1;   // Pac-Man cell the field was built for (-1: not valid)
+static Wavefront build_wave;             // BFS of the rebuild in progress (a whole row per step, see wavefront.c)
+static int build_x = -1, build_y = -1;   // Pac-Man cell of the rebuild in progress (-1: none)
+
+// Statistics
+uint32_t flow_field_builds = 0;          // Number of BFS rebuilds
+uint32_t flow_field_reuses = 0;          // Number of requests served by the cached field
+int flow_field_expansions = 0;           // Cells written by the last flow_field_step() (0 if the field was reused)
+
+// Function to bring the field up to date, advancing the BFS by at most budget layers (a layer is one pass over
+// the rows of the frontier, about the cost of one A* expansion). Returns 1 once a field is complete, 0 if the
+// rebuild carries over to the next call.
+// A rebuild runs to the end for the cell it started from even if Pac-Man moves meanwhile, and the field
+// it leaves may then be a few steps behind him: restarting on every move would starve it while he runs.
+int flow_field_step(int budget) {
+    int cells = 0, layers = 0;
+
+    if (build_x < 0) {
+        if (pacman_x == field_x && pacman_y == field_y) {
+            flow_field_expansions = 0;
+            flow_field_reuses++;
+            return 1;  // Same cell as the last build: the field is still valid
+        }
+        // Pac-Man changed cell: start over from his cell, the field is not valid until the end
+        build_x = pacman_x;
+        build_y = pacman_y;
+        field_x = field_y = -1;
+        memset(pacman_field, FIELD_UNREACHABLE, sizeof(pacman_field));
+        wave_begin(&build_wave, ghost_walk_mask, build_x, build_y);
+    }
+
+    while (build_wave.lo <= build_wave.hi && build_wave.layer < FIELD_UNREACHABLE) {
+        if (layers >= budget) {
+            flow_field_expansions = cells;
+            return 0;  // Out of budget: the next call carries on from this layer
+        }
+        cells += wave_write_layer(&build_wave, pacman_field);
+        wave_step(&build_wave);
+        layers++;
+    }
+    field_x = build_x;
+    field_y = build_y;
+    build_x = build_y = -1;
+    flow_field_builds++;
+    flow_field_expansions = cells;
+    return 1;
+}
+
+// Function to get the cell the field leads to: Pac-Man's cell when its last rebuild started
+void flow_field_root(int *x, int *y) {
+    *x = field_x;
+    *y = field_y;
+}
+
+// Function to bring the field up to date in one call (BFS only if Pac-Man moved since the last build)
+void flow_field_update() {
+    if (build_x >= 0) {
+        flow_field_step(PLAN_UNBOUNDED);  // Finish the rebuild in progress first: it may be for an older cell
+    }
+    flow_field_step(PLAN_UNBOUNDED);
+}
+
+// Function to get the next step (DIR_*) toward Pac-Man from (x, y), -1 if already there or unreachable
+int flow_field_direction(int x, int y) {
+    int i, best_dir = -1;
+    uint8_t best = pacman_field[y][x];
+
+    if (best == 0 || best == FIELD_UNREACHABLE) {
+        return -1;
+    }
+
+    // Pick the neighbour one step closer to Pac-Man
+    for (i = 0; i < 4; i++) {
+        int new_x = x, new_y = y;
+        ghost_move(&new_x, &new_y, i);
+
+        if (is_ghost_cell(new_x, new_y) && pacman_field[new_y][new_x] < best) {
+            best = pacman_field[new_y][new_x];
+            best_dir = i;
+        }
+    }
+    return best_dir;
+}
+
+// Function to get the step (DIR_*) from (x, y) that gets farthest from Pac-Man, -1 if no neighbour is farther
+int flow_field_flee_direction(int x, int y) {
+    int i, best_dir = -1;
+    uint8_t best = pacman_field[y][x];
+
+    if (best == FIELD_UNREACHABLE) {
+        return -1;
+    }
+
+    // Pick the neighbour one step farther from Pac-Man
+    for (i = 0; i < 4; i++) {
+        int new_x = x, new_y = y;
+        ghost_move(&new_x, &new_y, i);
+
+        if (is_ghost_cell(new_x, new_y) && pacman_field[new_y][new_x] != FIELD_UNREACHABLE
+            && pacman_field[new_y][new_x] > best) {
+            best = pacman_field[new_y][new_x];
+            best_dir = i;
+        }
+    }
+    return best_dir;
+}
+
+// Function to find where fleeing from (x, y) ends: the first cell with no neighbour farther from Pac-Man.
+// Returns 0 (and leaves *tx, *ty alone) if Pac-Man cannot be reached from (x, y).
+int flow_field_flee_target(int x, int y, int *tx, int *ty) {
+    int dir;
+
+    if (!is_ghost_cell(x, y) || pacman_field[y][x] == FIELD_UNREACHABLE) {
+        return 0;
+    }
+    // Every step is one cell farther from Pac-Man, so the climb ends after at most MAX_NODE steps
+    while ((dir = flow_field_flee_direction(x, y)) >= 0) {
+        ghost_move(&x, &y, dir);
+    }
+    *tx = x;
+    *ty = y;
+    return 1;
+}
+
+// Function to find the baked field of a fixed target, -1 if (x, y) has none
+int static_field_find(int x, int y) {
+    int i;
+
+    for (i = 0; i < STATIC_FIELDS; i++) {
+        if (static_field_target[i][0] == x && static_field_target[i][1] == y) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+// Function to get the next step (DIR_*) from (x, y) down the baked field, -1 if already there or unreachable
+int static_field_direction(int field, int x, int y) {
+    const uint8_t *steps = static_fields[field];
+    uint16_t cell = maze_cell_index[y][x];
+    int i;
+
+    if (cell == MAZE_NO_CELL || steps[cell] == 0) {
+        return -1;
+    }
+
+    // Pick the first neighbour one step closer to the target
+    for (i = 0; i < 4; i++) {
+        int new_x = x, new_y = y;
+        ghost_move(&new_x, &new_y, i);
+
+        if (new_x >= 0 && new_x < COLS && new_y >= 0 && new_y < ROWS) {
+            uint16_t next = maze_cell_index[new_y][new_x];
+            if (next != MAZE_NO_CELL && steps[next] < steps[cell]) {
+                return i;
+            }
+        }
+    }
+    return -1;
+}
@@ -62,25 +62,191 @@
 // Other game constants
 #define MAX_NODE 500                // Maximum nodes manageable
 #define UNREACHABLE 99999999        // Cost for unreachable nodes
+#define FIELD_UNREACHABLE 0xFF      // Distance-field value of cells a ghost cannot reach
+
+// Fixed ghost targets: tools/gen_maze_tables.py bakes a distance field toward each of them
+#define HOME_X 14                   // Ghost house cell the eaten ghosts return to
+#define HOME_Y 19
+#define CORNER_LEFT_X 2             // Corners of the maze
+#define CORNER_RIGHT_X 27
+#define CORNER_TOP_Y 6
+#define CORNER_BOTTOM_Y 33
+
+// Tunnel: a move onto TELEPORT_LEFT/TELEPORT_RIGHT lands on the cell next to the opposite opening
+#define TUNNEL_ROW 19               // Row of the two openings in game_map
+#define TUNNEL_LEFT_X 2             // Left end of the tunnel (reached through TELEPORT_RIGHT)
+#define TUNNEL_RIGHT_X (COLS - 3)   // Right end of the tunnel (reached through TELEPORT_LEFT)
+
+// Movement directions, in the order of the dx/dy tables
+#define DIR_DOWN 0
+#define DIR_RIGHT 1
+#define DIR_UP 2
+#define DIR_LEFT 3
+
+// Pathfinding configuration (the USE_* switches can be overridden on the compiler command line)
+#ifndef USE_NEXTHOP_TABLE
+#define USE_NEXTHOP_TABLE 1         // 1: follow the precomputed next-hop table (maze_tables.c), 0: search at runtime
+#endif
+#ifndef USE_JUNCTION_GRAPH
+#define USE_JUNCTION_GRAPH 1        // Runtime search: 1 on the junction graph (junctions.c), 0 on the cell grid
+#endif
+#define MAX_JUNCTIONS 80            // Maximum nodes of the junction graph
+#ifndef USE_HPA
+#define USE_HPA 0                   // Runtime search: 1 on the cluster abstraction (hpa.c) before the junction graph
+#endif
+#define HPA_CLUSTER 10              // Side of an HPA* cluster in cells
+#define MAX_HPA_NODES 96            // Maximum entrances of the HPA* abstract graph
+#define HPA_MAX_EDGES 12            // Maximum edges leaving one entrance
+#ifndef USE_DSTAR_LITE
+#define USE_DSTAR_LITE 1            // Runtime chase: 1 incremental D* Lite (dstar.c), 0 shared distance field
+#endif
+#ifndef USE_LANDMARKS
+#define USE_LANDMARKS 1             // Runtime search: 1 landmark (ALT) lower bounds in the heuristic, 0 Manhattan only
+#endif
+#define LANDMARK_COUNT 8            // Landmarks picked by tools/gen_maze_tables.py (distances in maze_tables.c)
+#define REPLAN_INTERVAL 1           // Without the governor: ghost moves between two replans of every ghost (1: every tick)
+#define USE_REPLAN_GOVERNOR 1       // 1: the governor picks which ghosts replan on each tick, 0: all every REPLAN_INTERVAL
+#define GOVERNOR_NEAR 8             // Ghosts closer than this to Pac-Man replan as soon as their target moves
+#define GOVERNOR_FAR_TICKS 4        // Ticks a far ghost, one in a corridor or an overloaded planner may lag behind
+#define GOVERNOR_BUSY_CYCLES 20000  // Planning cycles in the last tick above which the planner counts as overloaded
+#define PLAN_BUDGET 32              // Node expansions per planning slice in the main loop
+#define PLAN_TICK_SLICES 4          // Planning slices per ghost tick, shared round-robin by all the ghosts
+#define PLAN_UNBOUNDED 0x7FFFFFFF   // Budget of find_path() and of the blocking planner calls: run to completion
+#define USE_ARCADE_STEERING 0       // Default ghost AI: 0 walk the planned paths, 1 arcade steering (KEY1 toggles it)
+
+// Pac-Man autopilot (soak tests and attract mode)
+#define USE_AUTOPILOT 0             // 1: the autopilot plays Pac-Man from power-on (joystick SELECT toggles it)
+#define AUTOPILOT_BUDGET 160        // Cells the autopilot may expand per decision
+#define AUTOPILOT_CYCLES 200000     // Cycles per decision (2 ms at 100 MHz) after which it keeps the best move so far
+#define AUTOPILOT_DANGER_RADIUS 6   // Ghost distance below which a cell costs the autopilot extra
+#define AUTOPILOT_DANGER_WEIGHT 4   // Extra cost per step a chasing ghost is inside that radius
+
+// Ghosts (Blinky, Pinky, Inky, Clyde: the first NUM_GHOSTS are on the board)
+#ifndef NUM_GHOSTS
+#define NUM_GHOSTS 1                // 1 to 4 (can be overridden on the compiler command line)
+#endif
+#define GHOST_BLINKY 0
+#define GHOST_PINKY 1
+#define GHOST_INKY 2
+#define GHOST_CLYDE 3
+
+// Ghost modes
+#define GHOST_CHASE 0               // Heading for its chase target
+#define GHOST_FRIGHTENED 1          // Power mode: running to a corner away from Pac-Man
+#define GHOST_EATEN 2               // Waiting in the ghost house to respawn
+
+// Chase target rules
+#define TARGET_PACMAN 0             // Pac-Man's cell (Blinky)
+#define TARGET_AHEAD 1              // Up to four cells ahead of Pac-Man (Pinky)
+#define TARGET_FLANK 2              // Blinky mirrored around the cell two ahead of Pac-Man (Inky)
+#define TARGET_SHY 3                // Pac-Man when far, the bottom-left corner when within 8 cells (Clyde)
+
+// Background jobs posted by the interrupt handlers (bit numbers in jobs_pending)
+#define JOB_REPLAN 0                // Recompute the ghosts' paths
+#define JOB_TICK 1                  // The ghosts moved: a new planning budget starts
+#define JOB_RENDER 2                // Draw the next frame (posted by the RIT every 50 ms)
+
+// Screen updates posted for the next frame (bit numbers in render_pending)
+#define RENDER_BOARD 0              // The whole board and its labels
+#define RENDER_SCORE 1              // The score
+#define RENDER_LIVES 2              // Erase the life just lost
+#define RENDER_STATUS 3             // Countdown, lives and score received over CAN (val_*)
+#define RENDER_PAUSE 4              // The pause screen, in place of the game
+#define RENDER_GAMEOVER 5           // The game over screen
+#define RENDER_VICTORY 6            // The victory screen
+
+#include "maze_tables.h"            // Generated by tools/gen_maze_tables.py
+#include "sprites.h"                // Generated by tools/gen_sprites.py
 
 /*-------------------------------------------------------------------------------------------------------
  * Data Structures: Types for storing game-related data.
  *-----------------------------------------------------------------------------------------------------*/
 
-// Node for A* pathfinding algorithm
+// Node for A* pathfinding algorithm (the heuristic is f - g)
 typedef struct {
-    int x, y;                  // Node's coordinates
-    int g;                     // Cost from start node to current node
-    int h;                     // Heuristic cost to the end node
-    int f;                     // Total cost (g + h)
-    int previous_index;        // Index of the previous node
+    uint8_t x, y;              // Node's coordinates
+    uint16_t g;                // Cost from start node to current node
+    uint16_t f;                // Total cost (g + heuristic)
+    uint16_t previous_index;   // closed_list index of the previous node (NO_PARENT for the start)
 } Node;
 
 // Steps in a path
 typedef struct {
-    int x, y;                  // Coordinates of the path step
+    uint8_t x, y;              // Coordinates of the path step
 } PathStep;
 
+#define NO_PARENT 0xFFFF                     // previous_index of the start node
+#define PATH_BYTES ((MAX_NODE + 3) / 4)      // Packed path: one 2-bit direction per step
+
+// Path packed as its start cell plus one 2-bit direction per step (path.c), or per corridor when turns is set:
+// the corridors between two junctions have a single way on, so they are walked without stored directions
+typedef struct {
+    PathStep start;            // Cell the path starts from
+    uint16_t length;           // Cells in the path, start included (0: no route)
+    uint16_t turns;            // Directions stored when taken only at the start and at junctions (0: one per step)
+    uint8_t dirs[PATH_BYTES];  // Direction (DIR_*) of each step (or turn), four per byte, in walking order
+} PackedPath;
+
+// Position of a walker along a PackedPath (path_iter_*)
+typedef struct {
+    const PackedPath *path;    // Path walked
+    PathStep cell;             // Cell reached
+    uint16_t step;             // Steps taken from the start
+    uint16_t turn;             // Turns read so far (paths with turns only)
+    uint8_t dir;               // Direction (DIR_*) of the last step
+} PathIter;
+
+// Ghost: position, behaviour and the path it is walking
+typedef struct {
+    atomic_int x, y;           // Cell
+    char previous_cell;        // Map content under the ghost
+    uint8_t mode;              // GHOST_*
+    uint8_t target_rule;       // TARGET_* used in GHOST_CHASE
+    uint8_t heading;           // Direction (DIR_*) of its last step
+    uint8_t plan_age;          // Ghost ticks since its last replan request (saturates at 255)
+    uint16_t color;            // Colour when not frightened
+    uint8_t spawn_x, spawn_y;  // Cell in the ghost house it restarts from
+    uint8_t dest_x, dest_y;    // Destination of its current path
+    PackedPath path;           // Path it is walking
+    PathIter cursor;           // Its position along path (the cell it should stand on)
+} Ghost;
+
+_Static_assert(sizeof(Node) == 8, "Node must stay packed in 8 bytes");
+_Static_assert(sizeof(PathStep) == 2, "PathStep must stay packed in 2 bytes");
+_Static_assert(sizeof(PackedPath) == ((6 + PATH_BYTES + 1) & ~1), "PackedPath must stay 6 bytes plus its directions");
+_Static_assert(COLS <= 256 && ROWS <= 256, "cell coordinates must fit in uint8_t");
+_Static_assert(MAX_NODE < NO_PARENT, "closed_list indices must fit in previous_index");
+_Static_assert(MAX_NODE <= 0xFFFF, "path lengths must fit in PackedPath.length");
+_Static_assert(NUM_GHOSTS >= 1 && NUM_GHOSTS <= 4, "NUM_GHOSTS must be between 1 and 4");
+
+// Node of the junction graph: an intersection or dead end with the corridors leaving it
+typedef struct {
+    uint8_t x, y;              // Cell of the junction
+    uint8_t edge_count;        // Number of corridors leaving it
+    uint8_t to[4];             // Junction at the other end of each corridor
+    uint8_t cost[4];           // Corridor length in steps
+    uint8_t dir[4];            // Direction (DIR_*) taken to enter each corridor
+} Junction;
+
+// Entrance of the HPA* abstract graph: a cell on a cluster border with the routes leaving it
+typedef struct {
+    uint8_t x, y;              // Cell of the entrance
+    uint8_t edge_count;        // Number of edges leaving it
+    uint8_t to[HPA_MAX_EDGES];   // Entrance at the other end of each edge
+    uint8_t cost[HPA_MAX_EDGES]; // Steps along each edge (1 across the border, inside the cluster otherwise)
+} HpaNode;
+_Static_assert(MAX_HPA_NODES < 0xFF && HPA_CLUSTER <= 16, "HPA* entrances and cluster steps must fit in uint8_t");
+
+// Bit-parallel BFS in progress (wavefront.c): bit x of a row mask is column x
+typedef struct {
+    const uint32_t *walk;      // Walkable cells the wave spreads over (ROWS masks)
+    uint32_t frontier[ROWS];   // Cells reached by the last step, all at distance layer
+    uint32_t visited[ROWS];    // Cells reached so far
+    int layer;                 // Distance of the frontier from the start
+    int lo, hi;                // Rows holding the frontier (lo > hi once it is empty)
+} Wavefront;
+_Static_assert(COLS <= 32, "a game_map row must fit in a uint32_t mask");
+
 /*-------------------------------------------------------------------------------------------------------
  * Global Variables: Externally accessible variables for game state management.
  *-----------------------------------------------------------------------------------------------------*/
@@ -88,11 +254,13 @@ typedef struct {
 // Game map
 extern char game_map[ROWS][COLS]; 
 
-// Pac-Man and Blinky positions
+// Pac-Man position
 extern atomic_int pacman_x; 
 extern atomic_int pacman_y;
-extern atomic_int blinky_x;
-extern atomic_int blinky_y;
+
+// Ghosts
+extern Ghost ghosts[NUM_GHOSTS];       // Blinky first
+extern int dest_x, dest_y;             // Cell the search in progress heads for
 
 // Game status variables
 extern char command;                   // Current movement direction (U, D, L, R)
@@ -106,25 +274,94 @@ extern char s_str[8];                  // Score buffer (string)
 extern char c_str[3];                  // Countdown buffer (string)
 
 // Pathfinding lists and counters
+#if !USE_NEXTHOP_TABLE
 extern Node open_list[MAX_NODE];       // Open list for A* algorithm
 extern Node closed_list[MAX_NODE];     // Closed list for A* algorithm
 extern int open_list_counter;          // Count of nodes in open list
 extern int closed_list_counter;        // Count of nodes in closed list
+extern int16_t open_index[ROWS][COLS]; // Heap slot of each queued cell (-1 if not queued)
+extern uint16_t cell_gen[ROWS][COLS];  // Search generation that last reached each cell
+extern uint16_t best_g[ROWS][COLS];    // Best g per cell, valid when cell_gen is current
+extern uint32_t closed_map[ROWS];      // Visited bitmap of the current search (one bit per column)
+extern uint16_t closed_gen[ROWS];      // Search generation of each closed_map row
+#endif
+
+// Shared distance field toward Pac-Man
+extern uint8_t pacman_field[ROWS][COLS]; // BFS steps from each ghost cell to Pac-Man
+extern uint32_t flow_field_builds;     // Field rebuilds (Pac-Man changed cell)
+extern uint32_t flow_field_reuses;     // Requests served without a rebuild
+extern int flow_field_expansions;      // Cells written by the last flow_field_step() (0 if reused)
 
-// Path and steps
-extern PathStep path[MAX_NODE]; 
-extern int path_counter;               // Total steps in path
-extern int current_step;               // Current step in path
+// Junction graph
+extern Junction junctions[MAX_JUNCTIONS]; // Intersections and dead ends of the maze
+extern int junction_count;             // Nodes in the junction graph
+extern int junction_overflow;          // Set if the maze has more than MAX_JUNCTIONS nodes
+extern int junction_expansions;        // Nodes expanded by the last junction search
+extern HpaNode hpa_nodes[MAX_HPA_NODES]; // Entrances of the HPA* clusters
+extern int hpa_node_count;             // Entrances in the abstract graph
+extern int hpa_overflow;               // Set if the maze needs more than MAX_HPA_NODES entrances or HPA_MAX_EDGES edges
+extern int hpa_expansions;             // Entrances expanded by the last HPA* search
+extern int hpa_cells;                  // Cells visited inside clusters by the last HPA* search and its refinement
+extern uint32_t ghost_walk_mask[ROWS];  // Ghost cells, one bit per column
+extern uint32_t pacman_walk_mask[ROWS]; // Cells Pac-Man can walk on, one bit per column
+extern int astar_expansions;           // Cells expanded by the last cell A* search
+extern int open_list_peak;             // Largest open_list_counter of the last cell A* search
+extern int overflow;                   // Nodes dropped because open_list was full
+
+// Incremental chase planner
+extern int dstar_expansions;           // Cells expanded by the last D* Lite update
+extern uint32_t dstar_restarts;        // D* Lite searches rebuilt from scratch
+
+// Pathfinding profiling (DWT cycle counter)
+extern uint32_t find_path_cycles;      // Cycles spent in the last planning slice
+extern uint32_t find_path_cycles_max;  // Worst-case planning slice cycles
+extern uint32_t draw_board_cycles;     // Cycles spent in the last full board redraw
+extern uint32_t draw_board_cycles_max; // Worst board redraw since power-on
+extern uint32_t plan_tick_cycles;      // Planning cycles spent since the last ghost tick
+extern uint32_t plan_tick_cycles_max;  // Worst-case planning cycles in one ghost tick
+extern uint32_t plan_tick_cycles_last; // Planning cycles of the last complete ghost tick
+extern uint64_t plan_cycles_total;     // Planning cycles since power-on
+extern uint32_t plan_searches;         // Searches completed since power-on
+extern atomic_int replan_governor;     // Set while the governor decides the replans (USE_REPLAN_GOVERNOR at power-on)
+extern uint32_t replans_triggered;     // Ghost ticks the governor asked for a new path
+extern uint32_t replans_skipped;       // Ghost ticks the governor kept the current path
+extern uint32_t replan_cycles_saved;   // Planning cycles saved per second of play (average)
+
+// Pac-Man autopilot
+extern uint8_t autopilot_danger[ROWS][COLS]; // Steps from the nearest chasing ghost, within AUTOPILOT_DANGER_RADIUS
+extern uint32_t autopilot_cycles;      // Cycles spent in the last autopilot decision
+extern uint32_t autopilot_cycles_max;  // Worst autopilot decision since power-on
+extern uint32_t autopilot_decisions;   // Autopilot decisions since power-on
+extern int autopilot_expansions;       // Cells expanded by the last autopilot decision
+
+// Background jobs
+extern atomic_uint jobs_pending;       // One bit per JOB_* waiting for the main loop
+
+// Frame rendering
+extern atomic_uint render_dirty[ROWS]; // Cells to redraw on the next frame, one bit per column
+extern atomic_uint render_pending;     // One bit per RENDER_* waiting for the next frame
+extern uint32_t render_marks;          // Cells marked since power-on
+extern uint32_t render_cells;          // Cells redrawn since power-on
+extern uint32_t render_runs;           // LCD windows opened for them
+extern uint32_t render_frames;         // Frames that drew something
+extern uint32_t render_cycles;         // Cycles spent in the last frame that drew something
+extern uint32_t render_cycles_max;     // Worst frame since power-on
+
+// Game status received over CAN (IRQ_CAN.c), drawn by the next frame
+extern volatile uint8_t val_countdown;
+extern volatile uint8_t val_lives;
+extern volatile uint16_t val_score;
 
 // Atomic game state flags
 extern atomic_int is_power_mode;
-extern atomic_int is_blinky_eaten;
+extern atomic_int is_ghost_eaten;      // Set while an eaten ghost waits to respawn
 extern atomic_int find_lock;
 extern atomic_int move_lock;
 extern atomic_int eat_lock;
+extern atomic_int arcade_steering;    // Set while the ghosts steer arcade-style instead of walking paths
+extern atomic_int autopilot;          // Set while the autopilot drives Pac-Man (USE_AUTOPILOT at power-on)
 
 // Miscellaneous
-extern char previous_cell;             // Previous cell state
 extern volatile int music;             // Music flag
 extern int endgame;                    // Endgame flag
 
@@ -141,17 +378,99 @@ extern void place_power_pills();
 extern void gameover();
 extern void victory();
 extern void lose_life();
+extern void game_second();
 
 // Drawing functions
 extern void draw_circle(int xpos, int ypos, int r, uint16_t Color);
 extern void draw_big_pacman(int xpos, int ypos, int r, uint16_t bodyColor, uint16_t bgColor);
+extern int cell_sprite(char cell);
+extern int board_tile(int x, int y);
+extern void draw_board();
+extern int pacman_sprite();
 extern void draw_start_menu();
 
 // Movement and logic
 extern void move_pacman();
+extern int autopilot_direction();
+extern void autopilot_tick();
+extern void autopilot_toggle();
 extern void find_path();
-extern void eat_ghost();
-extern void move_blinky();
+extern int distance(int x1, int y1, int x2, int y2);
+extern int ghost_distance(int x1, int y1, int x2, int y2);
+extern int ghost_heuristic(int x1, int y1, int x2, int y2);
+extern int is_ghost_cell(int x, int y);
+extern void ghost_move(int *x, int *y, int dir);
+extern int ghost_can_move(int x, int y, int dir);
+extern int nexthop_direction(int x, int y, int tx, int ty);
+extern int flow_field_step(int budget);
+extern void flow_field_update();
+extern void flow_field_root(int *x, int *y);
+extern int flow_field_direction(int x, int y);
+extern int flow_field_flee_direction(int x, int y);
+extern int flow_field_flee_target(int x, int y, int *tx, int *ty);
+extern int static_field_find(int x, int y);
+extern int static_field_direction(int field, int x, int y);
+extern void wavefront_init();
+extern void wave_begin(Wavefront *wave, const uint32_t *walk, int x, int y);
+extern int wave_step(Wavefront *wave);
+extern int wave_distance(const uint32_t *walk, int sx, int sy, int tx, int ty);
+extern int wave_write_layer(const Wavefront *wave, uint8_t field[ROWS][COLS]);
+extern int wave_field(const uint32_t *walk, int x, int y, uint8_t field[ROWS][COLS]);
+extern int wave_nearest(const uint32_t *walk, int x, int y, const uint32_t *targets, int *tx, int *ty);
+extern void junction_graph_init();
+extern void junction_begin(int sx, int sy, int tx, int ty);
+extern int junction_search(int budget, PackedPath *path);
+extern void hpa_init();
+extern int hpa_plan(int sx, int sy, int tx, int ty);
+extern int hpa_route_direction(int x, int y);
+extern int dstar_update(int ghost, int sx, int sy, int gx, int gy);
+extern int dstar_compute(int budget);
+extern int dstar_direction(int x, int y);
+extern void path_clear(PackedPath *path);
+extern void path_begin(PackedPath *path, int x, int y);
+extern void path_put(PackedPath *path, int step, int dir);
+extern int path_get(const PackedPath *path, int step);
+extern int path_append(PackedPath *path, int dir);
+extern int path_append_turn(PackedPath *path, int dir);
+extern void path_copy(PackedPath *to, const PackedPath *from);
+extern PathStep path_destination(const PackedPath *path);
+extern void path_iter_begin(PathIter *it, const PackedPath *path);
+extern int path_iter_left(const PathIter *it);
+extern int path_iter_next(PathIter *it);
+extern int path_iter_seek(PathIter *it, int x, int y);
+extern void eat_ghost(Ghost *ghost);
+extern void ghosts_init();
+extern void ghosts_reset();
+extern void ghosts_frighten(int on);
+extern void arcade_steering_toggle();
+extern void replan_tick();
+extern void replan_second();
+extern Ghost *ghost_at(int x, int y, const Ghost *except);
+extern void ghost_collision(Ghost *ghost);
+extern int ghost_sprite(const Ghost *ghost);
+extern void ghost_find_path(Ghost *ghost);
+#if !USE_NEXTHOP_TABLE
+extern int astar_route(int sx, int sy, int tx, int ty, PackedPath *path);
+#endif
+extern void move_ghosts();
+
+// Frame rendering
+extern void render_mark(int x, int y);
+extern void render_post(int what);
+extern void render_discard();
+extern void render_frame();
+
+// Background jobs and sliced planning
+extern void job_post(int job);
+extern int jobs_service();
+extern void request_replan();
+extern void plan_restart();
+extern int plan_slice(int budget);
+extern int plan_busy();
+extern void plan_tick();
+
+// Profiling
+extern void cycle_counter_init();
 
 #endif /* __FUNC_H */
 
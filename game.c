@@ -21,14 +21,17 @@ int endgame = 0;               // Flag to track if the game is over
 char s_str[8];                 // Buffer for score number conversion
 char c_str[3];                 // Buffer for countdown number conversion
 char command;                  // Stores the current movement direction (U, D, L, R)
+static int ghost_respawn_timer = 3;    // Seconds before an eaten ghost respawns
+static int power_mode_countdown = 10;  // Seconds of power mode left
+uint32_t draw_board_cycles = 0;        // Cycles spent in the last full board redraw
+uint32_t draw_board_cycles_max = 0;    // Worst board redraw since power-on
 
 // Game flags
-atomic_int is_blinky_eaten = 0; // Flag to track if Blinky has been eaten
+atomic_int is_ghost_eaten = 0;  // Flag to track if a ghost has been eaten
 atomic_int is_power_mode = 0;   // Flag to track if power mode is on
 
-// Coordinates for Pac-Man and Blinky
+// Coordinates for Pac-Man (the ghosts are in blinky.c)
 atomic_int pacman_x, pacman_y;  // Pac-Man's position on the map (x, y)
-atomic_int blinky_x, blinky_y;  // Blinky's position on the map (x, y)
 
 // Game map definition
 char game_map[ROWS][COLS] = {
@@ -90,9 +93,9 @@ void gameover() {
 		// Lock the movement if necessary
     move_lock = LOCK_ACQUIRED;
 
-    // Clear screen and display Game Over message
-    LCD_Clear(Black); 
-    GUI_Text(90, 150, (uint8_t*)"GAMEOVER!", Red, Black);
+    // The next frame clears the screen and displays the Game Over message
+    render_discard();  // Nothing of the game is drawn anymore
+    render_post(RENDER_GAMEOVER);
     
     // Reset countdown timer to its initial value
     countdown = 60;
@@ -117,36 +120,137 @@ void victory() {
     // Lock the movement if necessary
     move_lock = LOCK_ACQUIRED;
     
-    // Clear screen and display Victory message
-    LCD_Clear(Black);
-		draw_big_pacman(125, 100, 15, Black, Yellow);
-    GUI_Text(95, 150, (uint8_t*)"VICTORY", Yellow, Blue);
+    // The next frame clears the screen and displays the Victory message
+    render_discard();  // Nothing of the game is drawn anymore
+    render_post(RENDER_VICTORY);
     
     // Reset countdown timer to its initial value
     countdown = 60;
 }
 
-// Function to draw a filled circle on the LCD (used for Pac-Man, lives, etc.)
-void draw_circle(int xpos, int ypos, int r, uint16_t Color) {
-    int x, y;
-    
-    // Use the circle equation (x^2 + y^2 = r^2) to determine which pixels to fill
-    for (y = -r; y <= r; y++) {
-        for (x = -r; x <= r; x++) {
-            if (x * x + y * y <= r * r) {
-                TP_DrawPoint(xpos + x, ypos + y, Color);  // Draw a point at the calculated position
+// Function to run the game's one-second tick (Timer 1): countdown, power mode and the eaten ghost's respawn
+void game_second() {
+    countdown--;                               // Decrement countdown timer
+    replan_second();                           // Replan governor statistics
+    if (countdown == 0) {
+        disable_timer(0);                      // Disable all timers on game over
+        disable_timer(1);
+        disable_timer(2);
+        gameover();                            // End the game
+    }
+
+    // Manage power mode and the eaten ghost's respawn timer
+    if (is_power_mode) {
+        if (is_ghost_eaten) {
+            ghost_respawn_timer--;
+            if (ghost_respawn_timer == 0) {
+                ghost_respawn_timer = 3;       // Reset respawn timer
+                power_mode_countdown = 10;
+                is_power_mode = PM_OFF;        // Exit power mode
+                is_ghost_eaten = 0;            // Reset ghost status
+                ghosts_frighten(0);            // Every ghost chases again, the eaten ones too
+                request_replan();              // Recalculate the ghosts' paths
+                init_timer(2, 0, 0, 3, 0.25 * 25000000); // Reinitialize Timer 2
+                enable_timer(2);
+            }
+        } else {
+            power_mode_countdown--;
+            if (power_mode_countdown == 0) {
+                power_mode_countdown = 10;     // Reset power mode timer
+                disable_timer(2);
+                reset_timer(2);                // Reset Timer 2
+                is_power_mode = PM_OFF;        // Exit power mode
+                ghosts_frighten(0);            // The ghosts chase again
+                request_replan();              // Recalculate the ghosts' paths
+                init_timer(2, 0, 0, 3, 0.25 * 25000000);
+                enable_timer(2);
             }
         }
     }
 }
 
+#define CIRCLE_TABLE_R 15  // Largest radius with precomputed spans (the start menu Pac-Man)
+
+// Half-width of each row of a filled circle: the largest x with x^2 + y^2 <= r^2, by radius and |y|
+static const uint8_t circle_half_width[CIRCLE_TABLE_R + 1][CIRCLE_TABLE_R + 1] = {
+    {0},                                                               // r = 0
+    {1, 0},                                                            // r = 1
+    {2, 1, 0},                                                         // r = 2 (ghost eyes)
+    {3, 2, 2, 0},                                                      // r = 3 (power pills)
+    {4, 3, 3, 2, 0},                                                   // r = 4 (Pac-Man, ghosts)
+    {5, 4, 4, 4, 3, 0},                                                // r = 5 (lives)
+    {6, 5, 5, 5, 4, 3, 0},                                             // r = 6
+    {7, 6, 6, 6, 5, 4, 3, 0},                                          // r = 7
+    {8, 7, 7, 7, 6, 6, 5, 3, 0},                                       // r = 8
+    {9, 8, 8, 8, 8, 7, 6, 5, 4, 0},                                    // r = 9
+    {10, 9, 9, 9, 9, 8, 8, 7, 6, 4, 0},                                // r = 10
+    {11, 10, 10, 10, 10, 9, 9, 8, 7, 6, 4, 0},                         // r = 11
+    {12, 11, 11, 11, 11, 10, 10, 9, 8, 7, 6, 4, 0},                    // r = 12
+    {13, 12, 12, 12, 12, 12, 11, 10, 10, 9, 8, 6, 5, 0},               // r = 13
+    {14, 13, 13, 13, 13, 13, 12, 12, 11, 10, 9, 8, 7, 5, 0},           // r = 14
+    {15, 14, 14, 14, 14, 14, 13, 13, 12, 12, 11, 10, 9, 7, 5, 0},      // r = 15 (start menu)
+};
+
+// Function to get the half-width of row y of a filled circle of radius r
+static int circle_span(int r, int y) {
+    int x;
+
+    if (y < 0) {
+        y = -y;
+    }
+    if (r <= CIRCLE_TABLE_R) {
+        return circle_half_width[r][y];
+    }
+    for (x = r; x * x + y * y > r * r; x--) {  // Larger radii: walk in from the edge
+    }
+    return x;
+}
+
+// Function to fill a horizontal run of pixels, clipped on the left (one LCD burst)
+static void fill_span(int x, int y, int width, uint16_t Color) {
+    if (x < 0) {
+        width += x;
+        x = 0;
+    }
+    if (y >= 0 && width > 0) {
+        LCD_FillRect(x, y, width, 1, Color);
+    }
+}
+
+// Function to draw a filled circle on the LCD (used for Pac-Man, lives, etc.): one span per row
+void draw_circle(int xpos, int ypos, int r, uint16_t Color) {
+    int y;
+
+    for (y = -r; y <= r; y++) {
+        int w = circle_span(r, y);
+        fill_span(xpos - w, ypos + y, 2 * w + 1, Color);
+    }
+}
+
+// Function to get the sprite (SPRITE_*) of what a cell of game_map holds (Pac-Man and the ghosts aside)
+int cell_sprite(char cell) {
+    switch (cell) {
+        case WALL:
+            return SPRITE_WALL;
+        case HOR_WALL:
+            return SPRITE_HOR_WALL;
+        case VER_WALL:
+            return SPRITE_VER_WALL;
+        case PILL:
+            return SPRITE_PILL;
+        case POWER_PILL:
+            return SPRITE_POWER_PILL;
+        case DOOR:
+            return SPRITE_DOOR;
+        default:
+            return SPRITE_EMPTY;
+    }
+}
+
 // Function to remove a life indicator from the display (used when Pac-Man loses a life)
 void remove_life() {
     lives_counter -= 1;  // Decrease the remaining lives
-    if (lives_counter < 5) {
-        // Erase life indicator by drawing a black circle
-        draw_circle(58 + lives_counter * 15, 312, 5, Black);
-    }
+    render_post(RENDER_LIVES);  // The next frame erases its circle
 }
 
 // Function to display remaining lives (up to a maximum of 5 lives)
@@ -172,14 +276,14 @@ void compute_score(int x, int y) {
         case POWER_PILL:
             score += 50;  // Power pill (PILLs)
             
-            // Start power mode if Blinky hasn't been eaten yet
-            if (!is_blinky_eaten) {
+            // Start power mode if no ghost has been eaten yet
+            if (!is_ghost_eaten) {
                 disable_timer(2);  // Disable the power mode timer
                 reset_timer(2);    // Reset the timer
                 init_timer(2, 0, 0, 3, 0.4 * 25000000);  // Set power mode timer
                 is_power_mode = PM_ON;  // Set power mode flag
-                draw_circle(blinky_x * CELL_SIZE + 4, blinky_y * CELL_SIZE + 4, 4, Blue);  // Draw Blinky in frightened mode
-                find_path();  // Update Blinky's path
+                ghosts_frighten(1);  // The ghosts run away (and turn blue on the next frame)
+                request_replan();  // Update the ghosts' paths
                 enable_timer(2);  // Enable the power mode timer
             }
             pills_counter++;  // Increment the pill counter
@@ -225,26 +329,22 @@ void place_power_pills() {
 // Function to draw a big Pac-Man with an open mouth
 // The mouth is created by leaving out a segment of the circle
 void draw_big_pacman(int xpos, int ypos, int r, uint16_t bodyColor, uint16_t bgColor) {
-    int x, y;
-    double angle;  // For calculating the angle of each point
-    double start_angle = 30.0;  // Start angle of the mouth (in degrees)
-    double end_angle = 330.0;   // End angle of the mouth (in degrees)
+    int y;
 
-    // Iterate over the circle's area
+    // Each row of the circle is two spans: bgColor up to the mouth, bodyColor from there to the edge.
+    // The mouth is the 60 degree wedge around the +x axis: x >= 0 and |y| < x tan(30), i.e. x^2 > 3 y^2.
     for (y = -r; y <= r; y++) {
-        for (x = -r; x <= r; x++) {
-            if (x * x + y * y <= r * r) {  // Check if the point is inside the circle
-                angle = atan2(y, x) * (180.0 / M_PI);  // Calculate the angle in degrees
-                if (angle < 0) angle += 360.0;         // Convert negative angles to positive
-
-                // Draw points only outside the mouth area
-                if (angle < start_angle || angle > end_angle) {
-                    TP_DrawPoint(xpos + x, ypos + y, bodyColor);
-                } else {
-                    TP_DrawPoint(xpos + x, ypos + y, bgColor);  // Use background color for the mouth
-                }
-            }
+        int w = circle_span(r, y);
+        int mouth = 0;
+
+        while (y != 0 && mouth * mouth <= 3 * y * y) {
+            mouth++;  // First column inside the wedge
         }
+        if (mouth > w) {
+            mouth = w + 1;  // The wedge misses this row
+        }
+        fill_span(xpos - w, ypos + y, mouth + w, bgColor);
+        fill_span(xpos + mouth, ypos + y, w - mouth + 1, bodyColor);
     }
 }
 
@@ -299,121 +399,85 @@ void draw_start_menu() {
 }
 
 
-/* Function to initialize and draw the game screen */
-void draw_screen() {
-    // Clear the screen to set the initial background to black
-    LCD_Clear(Black);
-    
-    // Initialize power pills on first run
-    if (start_counter == 0) {
-        place_power_pills();  // Function to place power pills on the map
-        start_counter++;      // Mark that the game has started
+// Function to get the sprite (SPRITE_*) a cell of the board is drawn with: Pac-Man, the ghost standing there,
+// or what game_map holds
+int board_tile(int x, int y) {
+    Ghost *ghost;
+
+    switch (game_map[y][x]) {
+        case PACMAN:
+            return pacman_sprite();  // Facing where he heads
+        case BLINKY:
+            ghost = ghost_at(x, y, 0);
+            return ghost ? ghost_sprite(ghost) : SPRITE_EMPTY;
+        default:
+            return cell_sprite(game_map[y][x]);  // Walls, pills, the door, empty cells
     }
-    
-    // Draw remaining time on the screen (currently commented out)
+}
+
+// Function to draw the whole board in one LCD window, then its labels: every cell of game_map is a tile of the
+// sprite atlas, and each pixel line of a row of cells is the same line of its COLS tiles, streamed left to right
+void draw_board() {
+    uint8_t tiles[COLS];  // Sprite of each cell of the row
+    uint32_t start_cycles = DWT->CYCCNT;
+    int i, j, line;
+
+    LCD_WindowBegin(0, 0, COLS * CELL_SIZE, ROWS * CELL_SIZE);
+    for (i = 0; i < ROWS; i++) {
+        for (j = 0; j < COLS; j++) {
+            tiles[j] = board_tile(j, i);
+        }
+        for (line = 0; line < SPRITE_SIZE; line++) {
+            for (j = 0; j < COLS; j++) {
+                LCD_WindowPixels(&sprite_atlas[tiles[j]][line * SPRITE_SIZE], SPRITE_SIZE);
+            }
+        }
+    }
+    LCD_WindowEnd();
+
+    draw_board_cycles = DWT->CYCCNT - start_cycles;
+    if (draw_board_cycles > draw_board_cycles_max) {
+        draw_board_cycles_max = draw_board_cycles;
+    }
+
+    // The labels go over the blank rows of the board
     GUI_Text(0, 0, (uint8_t*)"REMAINING TIME: ", White, Black);
     /*
         sprintf(c_str, "%d", countdown);  // Convert countdown to string
         GUI_Text(0, 16, (uint8_t*)c_str, White, Black);  // Display the countdown
     */
-    
-    // Draw the score on the screen (currently commented out)
     GUI_Text(180, 0, (uint8_t*)"SCORE: ", White, Black);
-    /*
-        sprintf(s_str, "%d", score);  // Convert score to string
-        GUI_Text(180, 16, (uint8_t*)s_str, White, Black);  // Display the score
-    */
-    
-    // Initialize variables for iterating over the game map and drawing elements
-    int i, j, xpos, ypos;
-    char type;
+    GUI_Text(0, 305, (uint8_t*)"LIVES: ", White, Black);
+    //print_lives();  // Function to display the number of remaining lives (currently commented out)
+}
+
+/* Function to initialize the game screen; the next frame draws it */
+void draw_screen() {
+    int i, j;
 
-    // Iterate over the game map to draw each element
+    // Initialize power pills and ghosts on first run
+    if (start_counter == 0) {
+        place_power_pills();  // Function to place power pills on the map
+        ghosts_init();        // Put the ghosts in the ghost house
+        ghost_respawn_timer = 3;
+        power_mode_countdown = 10;
+        start_counter++;      // Mark that the game has started
+    }
+
+    // Find Pac-Man on the map
     for (i = 0; i < ROWS; i++) {
         for (j = 0; j < COLS; j++) {
-            type = game_map[i][j];    // Get the type of the current map element
-            xpos = j * CELL_SIZE;     // X position based on column index
-            ypos = i * CELL_SIZE;     // Y position based on row index
-
-            // Draw the appropriate game element based on the map type
-            switch (type) {
-                case PACMAN:
-                    // Draw Pac-Man as a yellow circle
-                    draw_circle(xpos + 4, ypos + 4, 4, Yellow);
-                    pacman_y = i;  // Set Pac-Man's Y position
-                    pacman_x = j;  // Set Pac-Man's X position
-                    break;
-
-                case BLINKY:
-                    // Draw Blinky (the red ghost) as a red circle
-                    draw_circle(xpos + 4, ypos + 4, 4, Red);
-                    blinky_y = i;  // Set Blinky's Y position
-                    blinky_x = j;  // Set Blinky's X position
-                    break;
-
-                case WALL:
-                    // Draw a corner wall piece using lines
-                    xpos += 3;
-                    ypos += 3;
-                    LCD_DrawLine(xpos, ypos, xpos + 3, ypos, Blue);  // Top line of wall
-                    xpos += 3;
-                    LCD_DrawLine(xpos, ypos, xpos, ypos + 3, Blue);  // Right line of wall
-                    ypos += 3;
-                    LCD_DrawLine(xpos, ypos, xpos - 3, ypos, Blue);  // Bottom line of wall
-                    xpos -= 3;
-                    LCD_DrawLine(xpos, ypos, xpos, ypos - 3, Blue);  // Left line of wall
-                    break;
-
-                case HOR_WALL:
-                    // Draw a horizontal wall
-                    ypos += 3;
-                    LCD_DrawLine(xpos, ypos, xpos + 8, ypos, Blue);  // Top horizontal line
-                    ypos += 2;
-                    LCD_DrawLine(xpos, ypos, xpos + 8, ypos, Blue);  // Bottom horizontal line
-                    break;
-
-                case VER_WALL:
-                    // Draw a vertical wall
-                    xpos += 3;
-                    LCD_DrawLine(xpos, ypos, xpos, ypos + 8, Blue);  // Left vertical line
-                    xpos += 2;
-                    LCD_DrawLine(xpos, ypos, xpos, ypos + 8, Blue);  // Right vertical line
-                    break;
-
-                case PILL:
-                    // Draw a regular scoring pill
-                    xpos += 4;
-                    ypos += 4;
-                    LCD_DrawLine(xpos, ypos, xpos, ypos + 1, White);  // Pill vertical line
-                    xpos += 1;
-                    LCD_DrawLine(xpos, ypos, xpos, ypos + 1, White);  // Pill vertical line
-                    break;
-
-                case POWER_PILL:
-                    // Draw a power pill
-                    draw_circle(xpos + 4, ypos + 4, 3, White);  // Power pill as a small white circle
-                    break;
-
-                case DOOR:
-                    // Draw the ghost house door as a magenta line
-                    ypos += 5;
-                    LCD_DrawLine(xpos, ypos, xpos + 8, ypos, Magenta);  // Ghost house door line
-                    break;
-
-                case EMPTY:
-                case TELEPORT_LEFT:
-                case TELEPORT_RIGHT:
-                    // No drawing needed for empty spaces or teleporters
-                    break;
+            if (game_map[i][j] == PACMAN) {
+                pacman_y = i;  // Set Pac-Man's Y position
+                pacman_x = j;  // Set Pac-Man's X position
             }
         }
     }
+
+    // Redraw the whole board (it covers the screen: no LCD_Clear() needed) and its labels
+    render_post(RENDER_BOARD);
     
-    // Draw lives display
-    GUI_Text(0, 305, (uint8_t*)"LIVES: ", White, Black);
-    //print_lives();  // Function to display the number of remaining lives (currently commented out)
-    
-    // Find path for Blinky (ghost AI pathfinding)
-    find_path();  // Function to update Blinky's path (AI for the ghost)
+    // Find paths for the ghosts (ghost AI pathfinding)
+    request_replan();  // Function to update the ghosts' paths (AI for the ghosts)
 		
 }
@@ -0,0 +1,358 @@
+/*********************************************************************************************************
+**--------------File Info---------------------------------------------------------------------------------
+** File name:          hpa.c
+** Last modified Date:
+** Last Version:
+** Descriptions:       Hierarchical pathfinding (HPA*). The grid is cut into HPA_CLUSTER x HPA_CLUSTER blocks;
+**                     the openings between two blocks become entrance nodes and the routes between the
+**                     entrances of one block are measured once at startup. A search joins the start and the
+**                     goal to the entrances of their own blocks, runs A* on the entrances only and refines
+**                     the route one block at a time, so its cost follows the number of blocks instead of
+**                     the number of cells.
+**--------------------------------------------------------------------------------------------------------
+*********************************************************************************************************/
+
+#include "functions.h"
+
+#define HPA_CLUSTERS_X ((COLS + HPA_CLUSTER - 1) / HPA_CLUSTER)
+#define HPA_CLUSTER_OF(x, y) (((y) / HPA_CLUSTER) * HPA_CLUSTERS_X + (x) / HPA_CLUSTER)
+#define HPA_FIELD(field, x, y) ((field)[(y) % HPA_CLUSTER][(x) % HPA_CLUSTER])  // Cell of its own cluster
+#define HPA_SPLIT 6                      // Openings this wide get an entrance at each end instead of one mid-way
+#define NO_HPA_NODE 0xFF                 // Parent value of the nodes reached from the start cell
+
+// Abstract graph (built once at startup)
+HpaNode hpa_nodes[MAX_HPA_NODES];        // Entrances with the routes leaving them
+int hpa_node_count = 0;                  // Number of entrances in hpa_nodes
+int hpa_overflow = 0;                    // Set if the maze needs more than MAX_HPA_NODES or HPA_MAX_EDGES
+int hpa_expansions = 0;                  // Entrances expanded by the last search
+int hpa_cells = 0;                       // Cells visited inside clusters by the last search and its refinement
+
+// Search state (indices 0..hpa_node_count-1 are entrances, hpa_node_count is the goal)
+static uint16_t h_g[MAX_HPA_NODES + 1];          // Best cost from the start
+static uint16_t h_h[MAX_HPA_NODES + 1];          // Heuristic to the goal, computed when first reached
+static uint8_t h_parent[MAX_HPA_NODES + 1];      // Previous entrance (NO_HPA_NODE: the start cell)
+static uint8_t h_state[MAX_HPA_NODES + 1];       // 0: unseen, 1: open, 2: closed
+
+// Route found by the last search: the waypoints after the start, refined one cluster at a time
+static uint8_t route_x[MAX_HPA_NODES + 1];
+static uint8_t route_y[MAX_HPA_NODES + 1];
+static int route_len = 0;                        // Number of waypoints (the goal is the last one)
+static int route_segment = 0;                    // Waypoint being walked to
+static int route_goal_x, route_goal_y;           // Last cell of the route
+static uint8_t goal_field[HPA_CLUSTER][HPA_CLUSTER];     // Steps to the goal inside its cluster
+static uint8_t segment_field[HPA_CLUSTER][HPA_CLUSTER];  // Steps to the current waypoint inside its cluster
+static uint8_t (*segment_ready)[HPA_CLUSTER] = 0;        // Field of the current waypoint (0: not built yet)
+
+// Function to write the steps from (x, y) to every cell of its cluster into field, moving inside the cluster
+// only (FIELD_UNREACHABLE elsewhere); returns the cells reached. The cluster's rows of ghost_walk_mask are
+// spread a layer at a time, as in wavefront.c, so the tunnel never leads out of the cluster.
+static int cluster_bfs(int x, int y, uint8_t field[HPA_CLUSTER][HPA_CLUSTER]) {
+    uint32_t frontier[HPA_CLUSTER], visited[HPA_CLUSTER], any;
+    int x0 = x - x % HPA_CLUSTER, y0 = y - y % HPA_CLUSTER;
+    int rows = ROWS - y0 < HPA_CLUSTER ? ROWS - y0 : HPA_CLUSTER;
+    uint32_t columns = ((1u << HPA_CLUSTER) - 1) << x0;
+    int layer = 0, cells = 0, r;
+
+    memset(field, FIELD_UNREACHABLE, HPA_CLUSTER * HPA_CLUSTER);
+    memset(frontier, 0, sizeof(frontier));
+    frontier[y - y0] = (1u << x) & ghost_walk_mask[y];
+    memcpy(visited, frontier, sizeof(visited));
+    any = frontier[y - y0];
+
+    while (any) {
+        uint32_t above = 0;
+
+        // Write the layer, then spread it one step (rows top to bottom, as wave_step() does)
+        for (r = 0; r < rows; r++) {
+            uint32_t row = frontier[r];
+            while (row) {
+                int cx = 31 - __CLZ(row);
+                row &= ~(1u << cx);
+                HPA_FIELD(field, cx, y0 + r) = layer;
+                cells++;
+            }
+        }
+        any = 0;
+        for (r = 0; r < rows; r++) {
+            uint32_t row = frontier[r];
+            uint32_t below = r + 1 < rows ? frontier[r + 1] : 0;
+            uint32_t next = (row | (row << 1) | (row >> 1) | above | below) &
+                            ghost_walk_mask[y0 + r] & columns & ~visited[r];
+            above = row;
+            frontier[r] = next;
+            visited[r] |= next;
+            any |= next;
+        }
+        layer++;
+    }
+    hpa_cells += cells;
+    return cells;
+}
+
+// Function to find the entrance standing on a cell, adding it if there is none yet (NO_HPA_NODE if full)
+static int hpa_node_add(int x, int y) {
+    int i;
+
+    for (i = 0; i < hpa_node_count; i++) {
+        if (hpa_nodes[i].x == x && hpa_nodes[i].y == y) {
+            return i;
+        }
+    }
+    if (hpa_node_count >= MAX_HPA_NODES) {
+        hpa_overflow = 1;
+        return NO_HPA_NODE;
+    }
+    hpa_nodes[hpa_node_count].x = x;
+    hpa_nodes[hpa_node_count].y = y;
+    hpa_nodes[hpa_node_count].edge_count = 0;
+    return hpa_node_count++;
+}
+
+// Function to add an edge between two entrances (once)
+static void hpa_edge_add(int from, int to, int cost) {
+    HpaNode *n = &hpa_nodes[from];
+    int i;
+
+    for (i = 0; i < n->edge_count; i++) {
+        if (n->to[i] == to) {
+            return;
+        }
+    }
+    if (n->edge_count >= HPA_MAX_EDGES) {
+        hpa_overflow = 1;
+        return;
+    }
+    n->to[n->edge_count] = to;
+    n->cost[n->edge_count] = cost;
+    n->edge_count++;
+}
+
+// Function to add the pair of entrances facing each other across a border (one step apart)
+static void hpa_entrance_add(int x1, int y1, int x2, int y2) {
+    int a = hpa_node_add(x1, y1), b = hpa_node_add(x2, y2);
+
+    if (a != NO_HPA_NODE && b != NO_HPA_NODE) {
+        hpa_edge_add(a, b, 1);
+        hpa_edge_add(b, a, 1);
+    }
+}
+
+// Function to add the entrances across one border: the cells (x, y) + k * (step_x, step_y), k < length, open
+// onto the next cluster in direction dir (DIR_RIGHT or DIR_DOWN). Each run of open cells is one opening.
+static void hpa_border_scan(int x, int y, int step_x, int step_y, int length, int dir) {
+    int ox = dir == DIR_RIGHT, oy = dir == DIR_DOWN;  // Offset of the facing cell
+    int k, run = 0;
+
+    for (k = 0; k <= length; k++) {
+        int cx = x + k * step_x, cy = y + k * step_y;
+
+        if (k < length && is_ghost_cell(cx, cy) && ghost_can_move(cx, cy, dir)) {
+            run++;
+            continue;
+        }
+        if (run >= HPA_SPLIT) {
+            cx = x + (k - run) * step_x;  // Wide opening: one entrance at each end
+            cy = y + (k - run) * step_y;
+            hpa_entrance_add(cx, cy, cx + ox, cy + oy);
+            cx = x + (k - 1) * step_x;
+            cy = y + (k - 1) * step_y;
+            hpa_entrance_add(cx, cy, cx + ox, cy + oy);
+        } else if (run > 0) {
+            cx = x + (k - (run + 1) / 2) * step_x;  // Narrow opening: one entrance mid-way
+            cy = y + (k - (run + 1) / 2) * step_y;
+            hpa_entrance_add(cx, cy, cx + ox, cy + oy);
+        }
+        run = 0;
+    }
+}
+
+// Function to build the abstract graph from game_map (walls never change, so this runs once)
+void hpa_init() {
+    static uint8_t field[HPA_CLUSTER][HPA_CLUSTER];
+    int x, y, i, j;
+
+    wavefront_init();  // The cluster BFS walks ghost_walk_mask: build it here rather than rely on the caller
+    hpa_node_count = 0;
+    hpa_overflow = 0;
+
+    // Entrances across the vertical borders, then across the horizontal ones
+    for (x = HPA_CLUSTER; x < COLS; x += HPA_CLUSTER) {
+        for (y = 0; y < ROWS; y += HPA_CLUSTER) {
+            hpa_border_scan(x - 1, y, 0, 1, ROWS - y < HPA_CLUSTER ? ROWS - y : HPA_CLUSTER, DIR_RIGHT);
+        }
+    }
+    for (y = HPA_CLUSTER; y < ROWS; y += HPA_CLUSTER) {
+        for (x = 0; x < COLS; x += HPA_CLUSTER) {
+            hpa_border_scan(x, y - 1, 1, 0, COLS - x < HPA_CLUSTER ? COLS - x : HPA_CLUSTER, DIR_DOWN);
+        }
+    }
+
+    // The tunnel joins its two ends in one step
+    x = TUNNEL_LEFT_X;
+    y = TUNNEL_ROW;
+    ghost_move(&x, &y, DIR_LEFT);
+    if (is_ghost_cell(TUNNEL_LEFT_X, TUNNEL_ROW) && x == TUNNEL_RIGHT_X && is_ghost_cell(x, y)) {
+        hpa_entrance_add(TUNNEL_LEFT_X, TUNNEL_ROW, TUNNEL_RIGHT_X, TUNNEL_ROW);
+    }
+
+    // Routes between the entrances of each cluster: one BFS per entrance, inside its cluster
+    for (i = 0; i < hpa_node_count; i++) {
+        HpaNode *n = &hpa_nodes[i];
+
+        cluster_bfs(n->x, n->y, field);
+        for (j = 0; j < hpa_node_count; j++) {
+            HpaNode *m = &hpa_nodes[j];
+            if (j != i && HPA_CLUSTER_OF(m->x, m->y) == HPA_CLUSTER_OF(n->x, n->y) &&
+                HPA_FIELD(field, m->x, m->y) != FIELD_UNREACHABLE) {
+                hpa_edge_add(i, j, HPA_FIELD(field, m->x, m->y));
+            }
+        }
+    }
+    hpa_cells = 0;
+}
+
+// Function to relax a node reached with cost g from parent
+static void hpa_relax(int node, int g, int parent) {
+    if (h_state[node] == 2 || (h_state[node] == 1 && g >= h_g[node])) {
+        return;  // Closed, or already reached at the same or lower cost
+    }
+    if (h_state[node] == 0) {
+        h_h[node] = node == hpa_node_count ? 0 : ghost_heuristic(hpa_nodes[node].x, hpa_nodes[node].y,
+                                                                 route_goal_x, route_goal_y);
+    }
+    h_g[node] = g;
+    h_parent[node] = parent;
+    h_state[node] = 1;
+}
+
+// Function to search the abstract graph from (sx, sy) to (tx, ty); returns 1 if a route was found.
+// The route is then read one step at a time through hpa_route_direction().
+int hpa_plan(int sx, int sy, int tx, int ty) {
+    static uint8_t start_field[HPA_CLUSTER][HPA_CLUSTER];
+    int goal = hpa_node_count;                       // Index of the virtual goal node
+    int start_cluster = HPA_CLUSTER_OF(sx, sy), goal_cluster = HPA_CLUSTER_OF(tx, ty);
+    int node, i;
+
+    hpa_expansions = 0;
+    hpa_cells = 0;
+    route_len = 0;
+    route_segment = 0;
+    route_goal_x = tx;
+    route_goal_y = ty;
+    segment_ready = 0;
+
+    if (hpa_overflow || !is_ghost_cell(sx, sy) || !is_ghost_cell(tx, ty)) {
+        return 0;
+    }
+    if (sx == tx && sy == ty) {
+        return 1;  // Already there: empty route
+    }
+
+    memset(h_state, 0, sizeof(h_state));
+
+    // Join the start to the entrances of its cluster, and to the goal if it is in the same cluster
+    cluster_bfs(tx, ty, goal_field);
+    cluster_bfs(sx, sy, start_field);
+    for (i = 0; i < hpa_node_count; i++) {
+        if (HPA_CLUSTER_OF(hpa_nodes[i].x, hpa_nodes[i].y) == start_cluster &&
+            HPA_FIELD(start_field, hpa_nodes[i].x, hpa_nodes[i].y) != FIELD_UNREACHABLE) {
+            hpa_relax(i, HPA_FIELD(start_field, hpa_nodes[i].x, hpa_nodes[i].y), NO_HPA_NODE);
+        }
+    }
+    if (start_cluster == goal_cluster && HPA_FIELD(start_field, tx, ty) != FIELD_UNREACHABLE) {
+        hpa_relax(goal, HPA_FIELD(start_field, tx, ty), NO_HPA_NODE);
+    }
+
+    // A* over the entrances (few enough that a linear scan beats a heap)
+    while (1) {
+        int best = -1, best_f = 0;
+
+        for (i = 0; i <= hpa_node_count; i++) {
+            if (h_state[i] == 1 && (best < 0 || h_g[i] + h_h[i] < best_f)) {
+                best = i;
+                best_f = h_g[i] + h_h[i];
+            }
+        }
+        if (best < 0) {
+            return 0;  // Open set exhausted: unreachable
+        }
+
+        h_state[best] = 2;
+        hpa_expansions++;
+        if (best == goal) {
+            break;
+        }
+
+        for (i = 0; i < hpa_nodes[best].edge_count; i++) {
+            hpa_relax(hpa_nodes[best].to[i], h_g[best] + hpa_nodes[best].cost[i], best);
+        }
+        // The goal is in this entrance's cluster
+        if (HPA_CLUSTER_OF(hpa_nodes[best].x, hpa_nodes[best].y) == goal_cluster &&
+            HPA_FIELD(goal_field, hpa_nodes[best].x, hpa_nodes[best].y) != FIELD_UNREACHABLE) {
+            hpa_relax(goal, h_g[best] + HPA_FIELD(goal_field, hpa_nodes[best].x, hpa_nodes[best].y), best);
+        }
+    }
+
+    // Rebuild the waypoints backward from the goal, then flip them into walking order
+    for (node = goal; node != NO_HPA_NODE; node = h_parent[node]) {
+        route_x[route_len] = node == goal ? tx : hpa_nodes[node].x;
+        route_y[route_len] = node == goal ? ty : hpa_nodes[node].y;
+        route_len++;
+    }
+    for (i = 0; i < route_len / 2; i++) {
+        uint8_t t;
+        t = route_x[i]; route_x[i] = route_x[route_len - 1 - i]; route_x[route_len - 1 - i] = t;
+        t = route_y[i]; route_y[i] = route_y[route_len - 1 - i]; route_y[route_len - 1 - i] = t;
+    }
+    return 1;
+}
+
+// Function to refine the planned route: next step (DIR_*) from (x, y), -1 once the goal is reached
+int hpa_route_direction(int x, int y) {
+    int wx, wy, i, d;
+
+    if (x == route_goal_x && y == route_goal_y) {
+        return -1;
+    }
+    while (route_segment < route_len && x == route_x[route_segment] && y == route_y[route_segment]) {
+        route_segment++;  // Waypoint reached (the start may stand on the first entrance)
+        segment_ready = 0;
+    }
+    if (route_segment >= route_len) {
+        return -1;
+    }
+    wx = route_x[route_segment];
+    wy = route_y[route_segment];
+
+    // Waypoint in another cluster: the single step across the border (or through the tunnel)
+    if (HPA_CLUSTER_OF(wx, wy) != HPA_CLUSTER_OF(x, y)) {
+        for (i = 0; i < 4; i++) {
+            int nx = x, ny = y;
+            ghost_move(&nx, &ny, i);
+            if (nx == wx && ny == wy) {
+                return i;
+            }
+        }
+        return -1;
+    }
+
+    // Same cluster: walk down the waypoint's field (the goal's one is already there)
+    if (!segment_ready) {
+        if (wx == route_goal_x && wy == route_goal_y) {
+            segment_ready = goal_field;
+        } else {
+            cluster_bfs(wx, wy, segment_field);
+            segment_ready = segment_field;
+        }
+    }
+    d = HPA_FIELD(segment_ready, x, y);
+    for (i = 0; i < 4; i++) {
+        int nx = x, ny = y;
+        ghost_move(&nx, &ny, i);
+        if (is_ghost_cell(nx, ny) && HPA_CLUSTER_OF(nx, ny) == HPA_CLUSTER_OF(x, y) &&
+            HPA_FIELD(segment_ready, nx, ny) < d) {
+            return i;
+        }
+    }
+    return -1;
+}
@@ -0,0 +1,44 @@
+/*********************************************************************************************************
+**--------------File Info---------------------------------------------------------------------------------
+** File name:          jobs.c
+** Last modified Date:
+** Last Version:
+** Descriptions:       Background jobs run by the main loop. Interrupt handlers only post a JOB_* bit
+**                     (requests of the same kind merge into one) and return; the main loop then runs the
+**                     work in slices of bounded length, so a long search never delays a timer interrupt.
+**                     The frames the RIT asks for are drawn here too (render.c).
+**--------------------------------------------------------------------------------------------------------
+*********************************************************************************************************/
+
+#include "functions.h"
+
+atomic_uint jobs_pending = 0;  // One bit per JOB_* waiting for the main loop
+static int tick_slices = PLAN_TICK_SLICES;  // Planning slices left in the current ghost tick
+
+// Function to post a job (safe from interrupt handlers)
+void job_post(int job) {
+    atomic_fetch_or(&jobs_pending, 1u << job);
+}
+
+// Function to run the pending jobs for one slice; returns 1 if work is left for the next call.
+// Planning gets at most PLAN_TICK_SLICES slices per ghost tick, whatever the number of ghosts: once they
+// are spent the loop sleeps until TIMER2 posts JOB_TICK, and the ghosts still waiting keep their old paths.
+int jobs_service() {
+    uint32_t jobs = atomic_exchange(&jobs_pending, 0);  // Take every posted job at once
+
+    if (jobs & (1u << JOB_TICK)) {
+        plan_tick();  // Close the cost account of the previous tick
+        tick_slices = PLAN_TICK_SLICES;
+    }
+    if (jobs & (1u << JOB_REPLAN)) {
+        plan_restart();  // Every ghost waits for a search, served in turn after the one in progress
+    }
+    if (jobs & (1u << JOB_RENDER)) {
+        render_frame();  // Out of the RIT: a long frame no longer holds the timers back
+    }
+    if (!plan_busy() || tick_slices == 0) {
+        return atomic_load(&jobs_pending) != 0;  // Nothing to plan, or this tick's budget is spent
+    }
+    tick_slices--;
+    return plan_slice(PLAN_BUDGET) || atomic_load(&jobs_pending) != 0;
+}
@@ -0,0 +1,324 @@
+/*********************************************************************************************************
+**--------------File Info---------------------------------------------------------------------------------
+** File name:          junctions.c
+** Last modified Date:
+** Last Version:
+** Descriptions:       Junction graph of the maze. Intersections, dead ends and tunnel mouths become nodes and
+**                     the one-wide corridors between them become weighted edges, so the ghost search runs on
+**                     ~60 nodes instead of ~300 cells. The search runs a few expansions per planning slice,
+**                     and the route found is stored as the direction taken at each junction: the ghost
+**                     walks the corridors in between one step per move (path_iter_next()).
+**--------------------------------------------------------------------------------------------------------
+*********************************************************************************************************/
+
+#include "functions.h"
+
+#define REVERSE_DIR(d) (((d) + 2) & 3)   // Opposite of a DIR_* direction
+#define NO_JUNCTION 0xFF                 // Parent value of the nodes reached from the start cell
+
+// Junction graph (built once at startup)
+Junction junctions[MAX_JUNCTIONS];       // Graph nodes with their outgoing corridors
+int junction_count = 0;                  // Number of nodes in junctions
+int junction_overflow = 0;               // Set if the maze has more than MAX_JUNCTIONS nodes
+
+// Search state (indices 0..junction_count-1 are junctions, junction_count is the goal)
+static uint16_t j_g[MAX_JUNCTIONS + 1];          // Best cost from the start
+static uint16_t j_f[MAX_JUNCTIONS + 1];          // g plus the heuristic, computed once per relaxation
+static uint8_t j_parent[MAX_JUNCTIONS + 1];      // Previous junction (NO_JUNCTION: the start cell)
+static uint8_t j_parent_dir[MAX_JUNCTIONS + 1];  // Direction leaving the previous node
+static uint8_t j_state[MAX_JUNCTIONS + 1];       // 0: unseen, 1: open, 2: closed
+int junction_expansions = 0;                     // Nodes expanded by the last search
+
+// Search in progress (junction_begin, then junction_search slice by slice)
+static int search_result = 0;                    // -1: running, 0: no route, 1: route found
+static int search_sx, search_sy, search_tx, search_ty;
+static int search_goal;                          // Node the search ends on (junction_count: inside a corridor)
+static int search_start;                         // Node on the start cell, NO_JUNCTION if it is in a corridor
+static int goal_from[2], goal_cost[2], goal_dir[2];  // Nodes at the ends of the goal's corridor
+static int goal_ends;
+static uint32_t reachable[ROWS];                 // Cells reachable from the spawn point (one bit per column)
+
+// Function to count the exits of a ghost cell
+static int cell_degree(int x, int y) {
+    int i, degree = 0;
+
+    for (i = 0; i < 4; i++) {
+        if (ghost_can_move(x, y, i)) {
+            degree++;
+        }
+    }
+    return degree;
+}
+
+// Function to check if a ghost cell is a graph node: intersections and dead ends. Cells with two exits,
+// corners and tunnel ends included, stay inside corridors.
+static int is_junction_cell(int x, int y) {
+    return cell_degree(x, y) != 2;
+}
+
+// Function to find the node standing on a cell, NO_JUNCTION if there is none
+static int junction_at(int x, int y) {
+    int i;
+
+    for (i = 0; i < junction_count; i++) {
+        if (junctions[i].x == x && junctions[i].y == y) {
+            return i;
+        }
+    }
+    return NO_JUNCTION;
+}
+
+// Function to follow a corridor from (x, y) leaving in direction dir until a node (or the stop cell) is reached.
+// Returns the number of steps and leaves the end cell in (*end_x, *end_y).
+static int walk_corridor(int x, int y, int dir, int stop_x, int stop_y, int *end_x, int *end_y) {
+    int i, steps = 0;
+
+    while (steps < ROWS * COLS) {  // Bound the walk in case a corridor loops without any junction
+        ghost_move(&x, &y, dir);  // The tunnel is part of its corridor
+        steps++;
+        if ((x == stop_x && y == stop_y) || is_junction_cell(x, y)) {
+            break;
+        }
+        // A corridor cell has exactly two exits: take the one we did not come from
+        for (i = 0; i < 4; i++) {
+            if (i != REVERSE_DIR(dir) && ghost_can_move(x, y, i)) {
+                dir = i;
+                break;
+            }
+        }
+    }
+    *end_x = x;
+    *end_y = y;
+    return steps;
+}
+
+// Function to mark the ghost cells reachable from Blinky's spawn point in reach (one bit per column).
+// Sweeps the grid until nothing changes: slow, but it runs once and needs no queue.
+static void mark_reachable(uint32_t reach[ROWS]) {
+    int x, y, i, changed = 1;
+
+    memset(reach, 0, ROWS * sizeof(uint32_t));
+    for (y = 0; y < ROWS; y++) {
+        for (x = 0; x < COLS; x++) {
+            if (game_map[y][x] == BLINKY) {
+                reach[y] |= 1u << x;
+            }
+        }
+    }
+
+    while (changed) {
+        changed = 0;
+        for (y = 0; y < ROWS; y++) {
+            for (x = 0; x < COLS; x++) {
+                if ((reach[y] >> x) & 1 || !is_ghost_cell(x, y)) {
+                    continue;
+                }
+                for (i = 0; i < 4; i++) {
+                    int new_x = x, new_y = y;
+                    ghost_move(&new_x, &new_y, i);
+                    if (is_ghost_cell(new_x, new_y) && (reach[new_y] >> new_x) & 1) {
+                        reach[y] |= 1u << x;
+                        changed = 1;
+                        break;
+                    }
+                }
+            }
+        }
+    }
+}
+
+// Function to derive the junction graph from game_map (walls never change, so this runs once)
+void junction_graph_init() {
+    int x, y, i, end_x, end_y;
+
+    junction_count = 0;
+    junction_overflow = 0;
+    mark_reachable(reachable);
+
+    // Nodes: every reachable ghost cell that is not a plain corridor cell
+    for (y = 0; y < ROWS; y++) {
+        for (x = 0; x < COLS; x++) {
+            if (!((reachable[y] >> x) & 1) || !is_junction_cell(x, y)) {
+                continue;
+            }
+            if (junction_count >= MAX_JUNCTIONS) {
+                junction_overflow = 1;
+                return;  // Too many nodes: callers fall back to the cell search
+            }
+            junctions[junction_count].x = x;
+            junctions[junction_count].y = y;
+            junctions[junction_count].edge_count = 0;
+            junction_count++;
+        }
+    }
+
+    // Edges: walk every corridor leaving every node
+    for (i = 0; i < junction_count; i++) {
+        Junction *j = &junctions[i];
+        int dir;
+
+        for (dir = 0; dir < 4; dir++) {
+            if (!ghost_can_move(j->x, j->y, dir)) {
+                continue;
+            }
+            j->cost[j->edge_count] = walk_corridor(j->x, j->y, dir, -1, -1, &end_x, &end_y);
+            j->to[j->edge_count] = junction_at(end_x, end_y);
+            j->dir[j->edge_count] = dir;
+            j->edge_count++;
+        }
+    }
+}
+
+// Function to relax a node reached with cost g through (parent, dir)
+static void junction_relax(int node, int g, int parent, int dir) {
+    if (j_state[node] == 2 || (j_state[node] == 1 && g >= j_g[node])) {
+        return;  // Closed, or already reached at the same or lower cost
+    }
+    j_g[node] = g;
+    j_f[node] = g + (node == junction_count ? 0 :
+                     ghost_heuristic(junctions[node].x, junctions[node].y, search_tx, search_ty));
+    j_parent[node] = parent;
+    j_parent_dir[node] = dir;
+    j_state[node] = 1;
+}
+
+// Function to start a search of the junction graph from (sx, sy) to (tx, ty), run by junction_search()
+void junction_begin(int sx, int sy, int tx, int ty) {
+    int node, i, dir, end_x, end_y, steps;
+
+    junction_expansions = 0;
+    search_sx = sx;
+    search_sy = sy;
+    search_tx = tx;
+    search_ty = ty;
+    search_goal = junction_count;
+    goal_ends = 0;
+
+    // The open areas around the maze are ghost cells too, but no node or corridor of the graph reaches them
+    if (junction_overflow || !is_ghost_cell(sx, sy) || !is_ghost_cell(tx, ty) ||
+        !((reachable[sy] >> sx) & 1) || !((reachable[ty] >> tx) & 1)) {
+        search_result = 0;
+        return;
+    }
+    if (sx == tx && sy == ty) {
+        search_result = 1;  // Already there: empty route
+        return;
+    }
+    search_result = -1;
+
+    memset(j_state, 0, sizeof(j_state));
+
+    // The goal: either a node itself or reachable from the two ends of its corridor
+    node = junction_at(tx, ty);
+    if (node != NO_JUNCTION) {
+        search_goal = node;
+    } else {
+        for (dir = 0; dir < 4; dir++) {
+            if (ghost_can_move(tx, ty, dir)) {
+                goal_cost[goal_ends] = walk_corridor(tx, ty, dir, -1, -1, &end_x, &end_y);
+                goal_from[goal_ends] = junction_at(end_x, end_y);
+                goal_dir[goal_ends] = -1;  // Resolved below, from the node side
+                goal_ends++;
+            }
+        }
+        // Direction to leave each end node toward the goal: the one whose corridor walk stops on the goal
+        for (i = 0; i < goal_ends; i++) {
+            Junction *j = &junctions[goal_from[i]];
+            int e;
+            for (e = 0; e < j->edge_count; e++) {
+                if (walk_corridor(j->x, j->y, j->dir[e], tx, ty, &end_x, &end_y) == goal_cost[i] &&
+                    end_x == tx && end_y == ty) {
+                    goal_dir[i] = j->dir[e];
+                    break;
+                }
+            }
+        }
+    }
+
+    // The start: either a node, or the two ends of its corridor (the goal may lie on that same corridor)
+    search_start = junction_at(sx, sy);
+    if (search_start != NO_JUNCTION) {
+        junction_relax(search_start, 0, NO_JUNCTION, 0);
+    } else {
+        for (dir = 0; dir < 4; dir++) {
+            if (!ghost_can_move(sx, sy, dir)) {
+                continue;
+            }
+            steps = walk_corridor(sx, sy, dir, tx, ty, &end_x, &end_y);
+            if (end_x == tx && end_y == ty) {
+                junction_relax(search_goal, steps, NO_JUNCTION, dir);  // Goal on (or ending) the start corridor
+            } else {
+                junction_relax(junction_at(end_x, end_y), steps, NO_JUNCTION, dir);
+            }
+        }
+    }
+}
+
+// Function to store the route to the goal in path: the direction taken at the start and at every junction
+static void junction_route(PackedPath *path) {
+    static uint8_t turns[MAX_JUNCTIONS + 1];  // Directions from the goal back to the start
+    int count = 0, node = search_goal;
+
+    while (1) {
+        int parent = j_parent[node];
+        turns[count++] = j_parent_dir[node];
+        if (parent == NO_JUNCTION || parent == search_start) {
+            break;
+        }
+        node = parent;
+    }
+    path_begin(path, search_sx, search_sy);
+    while (count > 0) {
+        path_append_turn(path, turns[--count]);
+    }
+    path->length = j_g[search_goal] + 1;
+}
+
+// Function to run the search for at most budget node expansions; returns 1 once it has ended, with the
+// route in path (turns at the junctions, see path_append_turn) or path cleared if there is none
+int junction_search(int budget, PackedPath *path) {
+    int i, expanded;
+
+    for (expanded = 0; search_result < 0 && expanded < budget; expanded++) {
+        int best = -1;
+
+        // A* over the nodes (few enough that a linear scan beats a heap)
+        for (i = 0; i <= junction_count; i++) {
+            if (j_state[i] == 1 && (best < 0 || j_f[i] < j_f[best])) {
+                best = i;
+            }
+        }
+        if (best < 0) {
+            search_result = 0;  // Open set exhausted: unreachable
+            break;
+        }
+
+        j_state[best] = 2;
+        junction_expansions++;
+        if (best == search_goal) {
+            search_result = 1;
+            junction_route(path);
+            return 1;
+        }
+
+        // Follow every corridor leaving the node
+        for (i = 0; i < junctions[best].edge_count; i++) {
+            junction_relax(junctions[best].to[i], j_g[best] + junctions[best].cost[i], best, junctions[best].dir[i]);
+        }
+        // The goal sits inside a corridor ending here
+        for (i = 0; i < goal_ends; i++) {
+            if (goal_from[i] == best && goal_dir[i] >= 0) {
+                junction_relax(junction_count, j_g[best] + goal_cost[i], best, goal_dir[i]);
+            }
+        }
+    }
+
+    if (search_result < 0) {
+        return 0;  // Out of budget: the search carries over to the next slice
+    }
+    path_begin(path, search_sx, search_sy);
+    if (search_result == 0) {
+        path_clear(path);  // No route
+    }
+    return 1;  // Ended here or already in junction_begin (no search to run, or already on the goal)
+}
@@ -0,0 +1,2777 @@
+/*********************************************************************************************************
+**--------------File Info---------------------------------------------------------------------------------
+** File name:           maze_tables.c
+** Descriptions:        Precomputed ghost routes for the static maze
+**                      GENERATED by tools/gen_maze_tables.py from game_map in game.c - do not edit.
+** Correlated files:    maze_tables.h, functions.h, blinky.c
+**--------------------------------------------------------------------------------------------------------
+*********************************************************************************************************/
+
+#include "functions.h"
+
+// Dense index of every ghost cell (MAZE_NO_CELL for walls and cells outside the maze)
+const uint16_t maze_cell_index[40][30] = {
+    {0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF},
+    {0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF},
+    {0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF},
+    {0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF},
+    {0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF},
+    {0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF},
+    {0xFFFF, 0xFFFF,   0,   1,   2,   3,   4,   5,   6,   7,   8,   9,  10,  11, 0xFFFF, 0xFFFF,  12,  13,  14,  15,  16,  17,  18,  19,  20,  21,  22,  23, 0xFFFF, 0xFFFF},
+    {0xFFFF, 0xFFFF,  24, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,  25, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,  26, 0xFFFF, 0xFFFF,  27, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,  28, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,  29, 0xFFFF, 0xFFFF},
+    {0xFFFF, 0xFFFF,  30, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,  31, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,  32, 0xFFFF, 0xFFFF,  33, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,  34, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,  35, 0xFFFF, 0xFFFF},
+    {0xFFFF, 0xFFFF,  36, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,  37, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,  38, 0xFFFF, 0xFFFF,  39, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,  40, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,  41, 0xFFFF, 0xFFFF},
+    {0xFFFF, 0xFFFF,  42,  43,  44,  45,  46,  47,  48,  49,  50,  51,  52,  53,  54,  55,  56,  57,  58,  59,  60,  61,  62,  63,  64,  65,  66,  67, 0xFFFF, 0xFFFF},
+    {0xFFFF, 0xFFFF,  68, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,  69, 0xFFFF, 0xFFFF,  70, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,  71, 0xFFFF, 0xFFFF,  72, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,  73, 0xFFFF, 0xFFFF},
+    {0xFFFF, 0xFFFF,  74, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,  75, 0xFFFF, 0xFFFF,  76, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,  77, 0xFFFF, 0xFFFF,  78, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,  79, 0xFFFF, 0xFFFF},
+    {0xFFFF, 0xFFFF,  80,  81,  82,  83,  84,  85, 0xFFFF, 0xFFFF,  86,  87,  88,  89, 0xFFFF, 0xFFFF,  90,  91,  92,  93, 0xFFFF, 0xFFFF,  94,  95,  96,  97,  98,  99, 0xFFFF, 0xFFFF},
+    {0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 100, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 101, 0xFFFF, 0xFFFF, 102, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 103, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF},
+    {0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 104, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 105, 0xFFFF, 0xFFFF, 106, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 107, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF},
+    {0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 108, 0xFFFF, 0xFFFF, 109, 110, 111, 112, 113, 114, 115, 116, 117, 118, 0xFFFF, 0xFFFF, 119, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF},
+    {0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 120, 0xFFFF, 0xFFFF, 121, 0xFFFF, 0xFFFF, 0xFFFF, 122, 123, 0xFFFF, 0xFFFF, 0xFFFF, 124, 0xFFFF, 0xFFFF, 125, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF},
+    {0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 126, 0xFFFF, 0xFFFF, 127, 0xFFFF, 128, 129, 130, 131, 132, 133, 0xFFFF, 134, 0xFFFF, 0xFFFF, 135, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF},
+    {0xFFFF, 0xFFFF, 136, 137, 138, 139, 140, 141, 142, 143, 144, 0xFFFF, 145, 146, 147, 148, 149, 150, 0xFFFF, 151, 152, 153, 154, 155, 156, 157, 158, 159, 0xFFFF, 0xFFFF},
+    {0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 160, 0xFFFF, 0xFFFF, 161, 0xFFFF, 162, 163, 164, 165, 166, 167, 0xFFFF, 168, 0xFFFF, 0xFFFF, 169, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF},
+    {0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 170, 0xFFFF, 0xFFFF, 171, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 172, 0xFFFF, 0xFFFF, 173, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF},
+    {0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 174, 0xFFFF, 0xFFFF, 175, 176, 177, 178, 179, 180, 181, 182, 183, 184, 0xFFFF, 0xFFFF, 185, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF},
+    {0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 186, 0xFFFF, 0xFFFF, 187, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 188, 0xFFFF, 0xFFFF, 189, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF},
+    {0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 190, 0xFFFF, 0xFFFF, 191, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 192, 0xFFFF, 0xFFFF, 193, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF},
+    {0xFFFF, 0xFFFF, 194, 195, 196, 197, 198, 199, 200, 201, 202, 203, 204, 205, 0xFFFF, 0xFFFF, 206, 207, 208, 209, 210, 211, 212, 213, 214, 215, 216, 217, 0xFFFF, 0xFFFF},
+    {0xFFFF, 0xFFFF, 218, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 219, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 220, 0xFFFF, 0xFFFF, 221, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 222, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 223, 0xFFFF, 0xFFFF},
+    {0xFFFF, 0xFFFF, 224, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 225, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 226, 0xFFFF, 0xFFFF, 227, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 228, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 229, 0xFFFF, 0xFFFF},
+    {0xFFFF, 0xFFFF, 230, 231, 232, 0xFFFF, 0xFFFF, 233, 234, 235, 236, 237, 238, 239, 240, 241, 242, 243, 244, 245, 246, 247, 248, 0xFFFF, 0xFFFF, 249, 250, 251, 0xFFFF, 0xFFFF},
+    {0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 252, 0xFFFF, 0xFFFF, 253, 0xFFFF, 0xFFFF, 254, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 255, 0xFFFF, 0xFFFF, 256, 0xFFFF, 0xFFFF, 257, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF},
+    {0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 258, 0xFFFF, 0xFFFF, 259, 0xFFFF, 0xFFFF, 260, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 261, 0xFFFF, 0xFFFF, 262, 0xFFFF, 0xFFFF, 263, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF},
+    {0xFFFF, 0xFFFF, 264, 265, 266, 267, 268, 269, 0xFFFF, 0xFFFF, 270, 271, 272, 273, 0xFFFF, 0xFFFF, 274, 275, 276, 277, 0xFFFF, 0xFFFF, 278, 279, 280, 281, 282, 283, 0xFFFF, 0xFFFF},
+    {0xFFFF, 0xFFFF, 284, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 285, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 286, 0xFFFF, 0xFFFF, 287, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 288, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 289, 0xFFFF, 0xFFFF},
+    {0xFFFF, 0xFFFF, 290, 291, 292, 293, 294, 295, 296, 297, 298, 299, 300, 301, 302, 303, 304, 305, 306, 307, 308, 309, 310, 311, 312, 313, 314, 315, 0xFFFF, 0xFFFF},
+    {0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF},
+    {0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF},
+    {0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF},
+    {0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF},
+    {0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF},
+    {0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF},
+};
+
+// Fixed targets (x, y): the ghost house, then the corners
+const uint8_t static_field_target[STATIC_FIELDS][2] = {
+    {14, 19},
+    {2, 6},
+    {27, 6},
+    {2, 33},
+    {27, 33},
+};
+
+// Steps from every ghost cell (maze_cell_index order) to each fixed target
+const uint8_t static_fields[STATIC_FIELDS][MAZE_CELLS] = {
+    { // (14, 19)
+        0x19, 0x18, 0x17, 0x16, 0x15, 0x14, 0x15, 0x16, 0x17, 0x16, 0x15, 0x14, 0x15, 0x16, 0x17, 0x18,
+        0x17, 0x16, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1A, 0x18, 0x13, 0x13, 0x14, 0x14, 0x19, 0x17, 0x12,
+        0x12, 0x13, 0x13, 0x18, 0x16, 0x11, 0x11, 0x12, 0x12, 0x17, 0x15, 0x14, 0x13, 0x12, 0x11, 0x10,
+        0x0F, 0x0E, 0x0D, 0x0E, 0x0F, 0x10, 0x11, 0x12, 0x11, 0x10, 0x0F, 0x0E, 0x0F, 0x10, 0x11, 0x12,
+        0x13, 0x14, 0x15, 0x16, 0x16, 0x11, 0x0C, 0x0D, 0x12, 0x17, 0x17, 0x12, 0x0B, 0x0C, 0x13, 0x18,
+        0x18, 0x17, 0x16, 0x15, 0x14, 0x13, 0x0A, 0x09, 0x08, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x14, 0x15,
+        0x16, 0x17, 0x18, 0x19, 0x12, 0x06, 0x07, 0x13, 0x11, 0x05, 0x06, 0x12, 0x10, 0x07, 0x06, 0x05,
+        0x04, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x11, 0x0F, 0x08, 0x02, 0x03, 0x09, 0x10, 0x0E, 0x09,
+        0x03, 0x02, 0x01, 0x02, 0x03, 0x04, 0x0A, 0x0F, 0x12, 0x11, 0x10, 0x0F, 0x0E, 0x0D, 0x0C, 0x0B,
+        0x0A, 0x02, 0x01, 0x00, 0x01, 0x02, 0x03, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x10, 0x11, 0x12, 0x13,
+        0x0E, 0x0B, 0x03, 0x02, 0x01, 0x02, 0x03, 0x04, 0x0C, 0x0F, 0x0F, 0x0C, 0x0D, 0x10, 0x10, 0x0D,
+        0x0E, 0x0F, 0x10, 0x11, 0x12, 0x11, 0x10, 0x0F, 0x0E, 0x11, 0x11, 0x0E, 0x0F, 0x12, 0x12, 0x0F,
+        0x10, 0x13, 0x18, 0x17, 0x16, 0x15, 0x14, 0x13, 0x12, 0x11, 0x10, 0x11, 0x12, 0x13, 0x14, 0x13,
+        0x12, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x19, 0x14, 0x14, 0x15, 0x15, 0x1A,
+        0x1A, 0x15, 0x15, 0x16, 0x16, 0x1B, 0x1B, 0x1C, 0x1D, 0x16, 0x17, 0x18, 0x19, 0x18, 0x17, 0x16,
+        0x17, 0x18, 0x17, 0x18, 0x19, 0x1A, 0x19, 0x18, 0x17, 0x1E, 0x1D, 0x1C, 0x1E, 0x17, 0x1A, 0x1B,
+        0x18, 0x1F, 0x1D, 0x18, 0x1B, 0x1C, 0x19, 0x1E, 0x1E, 0x1D, 0x1C, 0x1B, 0x1A, 0x19, 0x1C, 0x1D,
+        0x1E, 0x1F, 0x20, 0x1F, 0x1E, 0x1D, 0x1A, 0x1B, 0x1C, 0x1D, 0x1E, 0x1F, 0x1F, 0x1A, 0x20, 0x21,
+        0x1B, 0x20, 0x20, 0x1F, 0x1E, 0x1D, 0x1C, 0x1B, 0x1C, 0x1D, 0x1E, 0x1F, 0x20, 0x21, 0x22, 0x23,
+        0x22, 0x21, 0x20, 0x1F, 0x1E, 0x1D, 0x1C, 0x1D, 0x1E, 0x1F, 0x20, 0x21,
+    },
+    { // (2, 6)
+        0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x16, 0x17, 0x18, 0x19,
+        0x1A, 0x1B, 0x1C, 0x1D, 0x1E, 0x1F, 0x20, 0x21, 0x01, 0x06, 0x0C, 0x15, 0x1B, 0x20, 0x02, 0x07,
+        0x0D, 0x14, 0x1A, 0x1F, 0x03, 0x08, 0x0E, 0x13, 0x19, 0x1E, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09,
+        0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19,
+        0x1A, 0x1B, 0x1C, 0x1D, 0x05, 0x0A, 0x0D, 0x16, 0x19, 0x1E, 0x06, 0x0B, 0x0E, 0x17, 0x1A, 0x1F,
+        0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0F, 0x10, 0x11, 0x12, 0x1B, 0x1A, 0x19, 0x18, 0x1B, 0x1C,
+        0x1D, 0x1E, 0x1F, 0x20, 0x0D, 0x13, 0x1A, 0x1C, 0x0E, 0x14, 0x19, 0x1D, 0x0F, 0x18, 0x17, 0x16,
+        0x15, 0x16, 0x17, 0x18, 0x19, 0x1A, 0x1B, 0x1E, 0x10, 0x17, 0x17, 0x18, 0x1C, 0x1F, 0x11, 0x16,
+        0x1A, 0x19, 0x18, 0x19, 0x1A, 0x1B, 0x1D, 0x1E, 0x17, 0x16, 0x15, 0x14, 0x13, 0x12, 0x13, 0x14,
+        0x15, 0x1B, 0x1A, 0x19, 0x1A, 0x1B, 0x1C, 0x1E, 0x1F, 0x1E, 0x1D, 0x1C, 0x1B, 0x1A, 0x19, 0x18,
+        0x13, 0x16, 0x1C, 0x1B, 0x1A, 0x1B, 0x1C, 0x1D, 0x1F, 0x1E, 0x14, 0x17, 0x20, 0x1F, 0x15, 0x18,
+        0x19, 0x1A, 0x1B, 0x1C, 0x1D, 0x1E, 0x1F, 0x20, 0x21, 0x20, 0x16, 0x19, 0x22, 0x21, 0x17, 0x1A,
+        0x23, 0x22, 0x1D, 0x1C, 0x1B, 0x1A, 0x19, 0x18, 0x19, 0x1A, 0x1B, 0x1C, 0x1D, 0x1E, 0x27, 0x26,
+        0x25, 0x24, 0x25, 0x24, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x1E, 0x19, 0x1F, 0x26, 0x24, 0x29,
+        0x1F, 0x1A, 0x20, 0x25, 0x25, 0x2A, 0x20, 0x21, 0x22, 0x1B, 0x1C, 0x1D, 0x1E, 0x1F, 0x20, 0x21,
+        0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x27, 0x26, 0x2D, 0x2C, 0x2B, 0x23, 0x1C, 0x1F, 0x28,
+        0x27, 0x2E, 0x22, 0x1D, 0x20, 0x29, 0x28, 0x2D, 0x23, 0x22, 0x21, 0x20, 0x1F, 0x1E, 0x21, 0x22,
+        0x23, 0x24, 0x2B, 0x2C, 0x2B, 0x2A, 0x29, 0x2A, 0x2B, 0x2C, 0x2D, 0x2E, 0x24, 0x1F, 0x25, 0x2A,
+        0x2A, 0x2F, 0x25, 0x24, 0x23, 0x22, 0x21, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28,
+        0x29, 0x2A, 0x2B, 0x2C, 0x2D, 0x2C, 0x2B, 0x2C, 0x2D, 0x2E, 0x2F, 0x30,
+    },
+    { // (27, 6)
+        0x21, 0x20, 0x1F, 0x1E, 0x1D, 0x1C, 0x1B, 0x1A, 0x19, 0x18, 0x17, 0x16, 0x0B, 0x0A, 0x09, 0x08,
+        0x07, 0x06, 0x05, 0x04, 0x03, 0x02, 0x01, 0x00, 0x20, 0x1B, 0x15, 0x0C, 0x06, 0x01, 0x1F, 0x1A,
+        0x14, 0x0D, 0x07, 0x02, 0x1E, 0x19, 0x13, 0x0E, 0x08, 0x03, 0x1D, 0x1C, 0x1B, 0x1A, 0x19, 0x18,
+        0x17, 0x16, 0x15, 0x14, 0x13, 0x12, 0x11, 0x10, 0x0F, 0x0E, 0x0D, 0x0C, 0x0B, 0x0A, 0x09, 0x08,
+        0x07, 0x06, 0x05, 0x04, 0x1E, 0x19, 0x16, 0x0D, 0x0A, 0x05, 0x1F, 0x1A, 0x17, 0x0E, 0x0B, 0x06,
+        0x20, 0x1F, 0x1E, 0x1D, 0x1C, 0x1B, 0x18, 0x19, 0x1A, 0x1B, 0x12, 0x11, 0x10, 0x0F, 0x0C, 0x0B,
+        0x0A, 0x09, 0x08, 0x07, 0x1C, 0x1A, 0x13, 0x0D, 0x1D, 0x19, 0x14, 0x0E, 0x1E, 0x1B, 0x1A, 0x19,
+        0x18, 0x17, 0x16, 0x15, 0x16, 0x17, 0x18, 0x0F, 0x1F, 0x1C, 0x18, 0x17, 0x17, 0x10, 0x1E, 0x1D,
+        0x1B, 0x1A, 0x19, 0x18, 0x19, 0x1A, 0x16, 0x11, 0x18, 0x19, 0x1A, 0x1B, 0x1C, 0x1D, 0x1E, 0x1F,
+        0x1E, 0x1C, 0x1B, 0x1A, 0x19, 0x1A, 0x1B, 0x15, 0x14, 0x13, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17,
+        0x1E, 0x1F, 0x1D, 0x1C, 0x1B, 0x1A, 0x1B, 0x1C, 0x16, 0x13, 0x1F, 0x20, 0x17, 0x14, 0x20, 0x21,
+        0x20, 0x1F, 0x1E, 0x1D, 0x1C, 0x1B, 0x1A, 0x19, 0x18, 0x15, 0x21, 0x22, 0x19, 0x16, 0x22, 0x23,
+        0x1A, 0x17, 0x28, 0x27, 0x26, 0x25, 0x24, 0x23, 0x24, 0x25, 0x24, 0x25, 0x26, 0x27, 0x1E, 0x1D,
+        0x1C, 0x1B, 0x1A, 0x19, 0x18, 0x19, 0x1A, 0x1B, 0x1C, 0x1D, 0x29, 0x24, 0x26, 0x1F, 0x19, 0x1E,
+        0x2A, 0x25, 0x25, 0x20, 0x1A, 0x1F, 0x2B, 0x2C, 0x2D, 0x26, 0x27, 0x28, 0x27, 0x26, 0x25, 0x24,
+        0x23, 0x22, 0x21, 0x20, 0x1F, 0x1E, 0x1D, 0x1C, 0x1B, 0x22, 0x21, 0x20, 0x2E, 0x27, 0x28, 0x1F,
+        0x1C, 0x23, 0x2D, 0x28, 0x29, 0x20, 0x1D, 0x22, 0x2E, 0x2D, 0x2C, 0x2B, 0x2A, 0x29, 0x2A, 0x2B,
+        0x2C, 0x2B, 0x24, 0x23, 0x22, 0x21, 0x1E, 0x1F, 0x20, 0x21, 0x22, 0x23, 0x2F, 0x2A, 0x2A, 0x25,
+        0x1F, 0x24, 0x30, 0x2F, 0x2E, 0x2D, 0x2C, 0x2B, 0x2C, 0x2D, 0x2C, 0x2B, 0x2A, 0x29, 0x28, 0x27,
+        0x26, 0x25, 0x24, 0x23, 0x22, 0x21, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25,
+    },
+    { // (2, 33)
+        0x25, 0x24, 0x23, 0x22, 0x21, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x29, 0x2A, 0x2B, 0x2C,
+        0x2D, 0x2C, 0x2B, 0x2C, 0x2D, 0x2E, 0x2F, 0x30, 0x24, 0x1F, 0x25, 0x28, 0x2A, 0x2F, 0x23, 0x1E,
+        0x24, 0x27, 0x29, 0x2E, 0x22, 0x1D, 0x23, 0x26, 0x28, 0x2D, 0x21, 0x20, 0x1F, 0x1E, 0x1D, 0x1C,
+        0x1D, 0x1E, 0x1F, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x28, 0x27, 0x28,
+        0x29, 0x2A, 0x2B, 0x2C, 0x20, 0x1B, 0x20, 0x27, 0x26, 0x2B, 0x1F, 0x1A, 0x21, 0x26, 0x25, 0x2A,
+        0x1E, 0x1D, 0x1C, 0x1B, 0x1A, 0x19, 0x22, 0x21, 0x20, 0x1F, 0x22, 0x23, 0x24, 0x25, 0x24, 0x25,
+        0x26, 0x27, 0x28, 0x29, 0x18, 0x1E, 0x21, 0x23, 0x17, 0x1D, 0x20, 0x22, 0x16, 0x19, 0x1A, 0x1B,
+        0x1C, 0x1D, 0x1E, 0x1F, 0x20, 0x21, 0x22, 0x21, 0x15, 0x18, 0x1E, 0x1F, 0x21, 0x20, 0x14, 0x17,
+        0x21, 0x20, 0x1F, 0x20, 0x21, 0x22, 0x20, 0x1F, 0x18, 0x17, 0x16, 0x15, 0x14, 0x13, 0x14, 0x15,
+        0x16, 0x22, 0x21, 0x20, 0x21, 0x22, 0x23, 0x1F, 0x20, 0x1F, 0x1E, 0x1D, 0x1C, 0x1B, 0x1A, 0x19,
+        0x12, 0x15, 0x23, 0x22, 0x21, 0x22, 0x23, 0x24, 0x1E, 0x1F, 0x11, 0x14, 0x1D, 0x20, 0x10, 0x13,
+        0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1A, 0x1B, 0x1C, 0x1F, 0x0F, 0x12, 0x1B, 0x1E, 0x0E, 0x11,
+        0x1A, 0x1D, 0x0C, 0x0D, 0x0E, 0x0F, 0x0E, 0x0D, 0x0E, 0x0F, 0x10, 0x11, 0x12, 0x13, 0x16, 0x17,
+        0x18, 0x19, 0x1A, 0x1B, 0x1C, 0x1D, 0x1E, 0x1F, 0x20, 0x21, 0x0B, 0x0C, 0x12, 0x15, 0x1B, 0x20,
+        0x0A, 0x0B, 0x11, 0x14, 0x1A, 0x1F, 0x09, 0x08, 0x07, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x10,
+        0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1C, 0x1D, 0x1E, 0x06, 0x09, 0x0E, 0x15,
+        0x18, 0x1B, 0x05, 0x08, 0x0F, 0x14, 0x17, 0x1A, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x10, 0x0F,
+        0x0E, 0x0D, 0x10, 0x11, 0x12, 0x13, 0x16, 0x17, 0x18, 0x19, 0x1A, 0x1B, 0x01, 0x06, 0x0C, 0x0F,
+        0x15, 0x1A, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D,
+        0x0E, 0x0F, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19,
+    },
+    { // (27, 33)
+        0x30, 0x2F, 0x2E, 0x2D, 0x2C, 0x2B, 0x2C, 0x2D, 0x2C, 0x2B, 0x2A, 0x29, 0x26, 0x25, 0x24, 0x23,
+        0x22, 0x21, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x2F, 0x2A, 0x28, 0x25, 0x1F, 0x24, 0x2E, 0x29,
+        0x27, 0x24, 0x1E, 0x23, 0x2D, 0x28, 0x26, 0x23, 0x1D, 0x22, 0x2C, 0x2B, 0x2A, 0x29, 0x28, 0x27,
+        0x28, 0x29, 0x28, 0x27, 0x26, 0x25, 0x24, 0x23, 0x22, 0x21, 0x20, 0x1F, 0x1E, 0x1D, 0x1C, 0x1D,
+        0x1E, 0x1F, 0x20, 0x21, 0x2B, 0x26, 0x27, 0x20, 0x1B, 0x20, 0x2A, 0x25, 0x26, 0x21, 0x1A, 0x1F,
+        0x29, 0x28, 0x27, 0x26, 0x25, 0x24, 0x25, 0x24, 0x23, 0x22, 0x1F, 0x20, 0x21, 0x22, 0x19, 0x1A,
+        0x1B, 0x1C, 0x1D, 0x1E, 0x23, 0x21, 0x1E, 0x18, 0x22, 0x20, 0x1D, 0x17, 0x21, 0x22, 0x21, 0x20,
+        0x1F, 0x1E, 0x1D, 0x1C, 0x1B, 0x1A, 0x19, 0x16, 0x20, 0x21, 0x1F, 0x1E, 0x18, 0x15, 0x1F, 0x20,
+        0x22, 0x21, 0x20, 0x1F, 0x20, 0x21, 0x17, 0x14, 0x19, 0x1A, 0x1B, 0x1C, 0x1D, 0x1E, 0x1F, 0x20,
+        0x1F, 0x23, 0x22, 0x21, 0x20, 0x21, 0x22, 0x16, 0x15, 0x14, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18,
+        0x1F, 0x1E, 0x24, 0x23, 0x22, 0x21, 0x22, 0x23, 0x15, 0x12, 0x20, 0x1D, 0x14, 0x11, 0x1F, 0x1C,
+        0x1B, 0x1A, 0x19, 0x18, 0x17, 0x16, 0x15, 0x14, 0x13, 0x10, 0x1E, 0x1B, 0x12, 0x0F, 0x1D, 0x1A,
+        0x11, 0x0E, 0x21, 0x20, 0x1F, 0x1E, 0x1D, 0x1C, 0x1B, 0x1A, 0x19, 0x18, 0x17, 0x16, 0x13, 0x12,
+        0x11, 0x10, 0x0F, 0x0E, 0x0D, 0x0E, 0x0F, 0x0E, 0x0D, 0x0C, 0x20, 0x1B, 0x15, 0x12, 0x0C, 0x0B,
+        0x1F, 0x1A, 0x14, 0x11, 0x0B, 0x0A, 0x1E, 0x1D, 0x1C, 0x19, 0x18, 0x17, 0x16, 0x15, 0x14, 0x13,
+        0x12, 0x11, 0x10, 0x0F, 0x0E, 0x0D, 0x0C, 0x0B, 0x0A, 0x07, 0x08, 0x09, 0x1B, 0x18, 0x15, 0x0E,
+        0x09, 0x06, 0x1A, 0x17, 0x14, 0x0F, 0x08, 0x05, 0x1B, 0x1A, 0x19, 0x18, 0x17, 0x16, 0x13, 0x12,
+        0x11, 0x10, 0x0D, 0x0E, 0x0F, 0x10, 0x07, 0x06, 0x05, 0x04, 0x03, 0x02, 0x1A, 0x15, 0x0F, 0x0C,
+        0x06, 0x01, 0x19, 0x18, 0x17, 0x16, 0x15, 0x14, 0x13, 0x12, 0x11, 0x10, 0x0F, 0x0E, 0x0D, 0x0C,
+        0x0B, 0x0A, 0x09, 0x08, 0x07, 0x06, 0x05, 0x04, 0x03, 0x02, 0x01, 0x00,
+    },
+};
+
+#if USE_LANDMARKS
+
+// Landmarks (x, y), picked by farthest-point sampling from the ghost house
+const uint8_t landmark_cell[8][2] = {
+    {15, 33},
+    {13, 6},
+    {14, 22},
+    {27, 6},
+    {17, 20},
+    {2, 13},
+    {27, 27},
+    {2, 28},
+};
+
+// Steps from every ghost cell (maze_cell_index order) to each landmark
+const uint8_t landmark_dist[MAZE_CELLS][8] = {
+    { 40,  11,  28,  33,  29,   7,  42,  32}, // 0: (2, 6)
+    { 39,  10,  27,  32,  28,   8,  41,  31}, // 1: (3, 6)
+    { 38,   9,  26,  31,  27,   9,  40,  30}, // 2: (4, 6)
+    { 37,   8,  25,  30,  26,  10,  39,  29}, // 3: (5, 6)
+    { 36,   7,  24,  29,  25,  11,  38,  28}, // 4: (6, 6)
+    { 35,   6,  23,  28,  24,  12,  37,  27}, // 5: (7, 6)
+    { 36,   5,  24,  27,  25,  13,  38,  28}, // 6: (8, 6)
+    { 37,   4,  25,  26,  26,  14,  39,  29}, // 7: (9, 6)
+    { 38,   3,  26,  25,  27,  15,  38,  30}, // 8: (10, 6)
+    { 39,   2,  27,  24,  26,  16,  37,  31}, // 9: (11, 6)
+    { 40,   1,  28,  23,  25,  17,  36,  32}, // 10: (12, 6)
+    { 41,   0,  29,  22,  24,  18,  35,  33}, // 11: (13, 6)
+    { 40,  11,  30,  11,  23,  21,  32,  36}, // 12: (16, 6)
+    { 39,  12,  29,  10,  24,  22,  31,  37}, // 13: (17, 6)
+    { 38,  13,  28,   9,  25,  23,  30,  38}, // 14: (18, 6)
+    { 37,  14,  27,   8,  26,  24,  29,  39}, // 15: (19, 6)
+    { 36,  15,  26,   7,  25,  25,  28,  40}, // 16: (20, 6)
+    { 35,  16,  25,   6,  24,  26,  27,  39}, // 17: (21, 6)
+    { 34,  17,  24,   5,  23,  27,  26,  38}, // 18: (22, 6)
+    { 35,  18,  25,   4,  24,  28,  27,  39}, // 19: (23, 6)
+    { 36,  19,  26,   3,  25,  29,  28,  40}, // 20: (24, 6)
+    { 37,  20,  27,   2,  26,  30,  29,  41}, // 21: (25, 6)
+    { 38,  21,  28,   1,  27,  31,  30,  42}, // 22: (26, 6)
+    { 39,  22,  29,   0,  28,  32,  31,  43}, // 23: (27, 6)
+    { 39,  12,  27,  32,  28,   6,  41,  31}, // 24: (2, 7)
+    { 34,   7,  22,  27,  23,  11,  36,  26}, // 25: (7, 7)
+    { 40,   1,  28,  21,  23,  17,  34,  32}, // 26: (13, 7)
+    { 39,  10,  29,  12,  22,  20,  31,  35}, // 27: (16, 7)
+    { 33,  16,  23,   6,  22,  26,  25,  37}, // 28: (22, 7)
+    { 38,  21,  28,   1,  27,  31,  30,  42}, // 29: (27, 7)
+    { 38,  13,  26,  31,  27,   5,  40,  30}, // 30: (2, 8)
+    { 33,   8,  21,  26,  22,  10,  35,  25}, // 31: (7, 8)
+    { 39,   2,  27,  20,  22,  16,  33,  31}, // 32: (13, 8)
+    { 38,   9,  28,  13,  21,  19,  30,  34}, // 33: (16, 8)
+    { 32,  15,  22,   7,  21,  25,  24,  36}, // 34: (22, 8)
+    { 37,  20,  27,   2,  26,  30,  29,  41}, // 35: (27, 8)
+    { 37,  14,  25,  30,  26,   4,  39,  29}, // 36: (2, 9)
+    { 32,   9,  20,  25,  21,   9,  34,  24}, // 37: (7, 9)
+    { 38,   3,  26,  19,  21,  15,  32,  30}, // 38: (13, 9)
+    { 37,   8,  27,  14,  20,  18,  29,  33}, // 39: (16, 9)
+    { 31,  14,  21,   8,  20,  24,  23,  35}, // 40: (22, 9)
+    { 36,  19,  26,   3,  25,  29,  28,  40}, // 41: (27, 9)
+    { 36,  15,  24,  29,  25,   3,  38,  28}, // 42: (2, 10)
+    { 35,  14,  23,  28,  24,   4,  37,  27}, // 43: (3, 10)
+    { 34,  13,  22,  27,  23,   5,  36,  26}, // 44: (4, 10)
+    { 33,  12,  21,  26,  22,   6,  35,  25}, // 45: (5, 10)
+    { 32,  11,  20,  25,  21,   7,  34,  24}, // 46: (6, 10)
+    { 31,  10,  19,  24,  20,   8,  33,  23}, // 47: (7, 10)
+    { 32,   9,  20,  23,  19,   9,  34,  24}, // 48: (8, 10)
+    { 33,   8,  21,  22,  18,  10,  35,  25}, // 49: (9, 10)
+    { 34,   7,  22,  21,  17,  11,  34,  26}, // 50: (10, 10)
+    { 35,   6,  23,  20,  18,  12,  33,  27}, // 51: (11, 10)
+    { 36,   5,  24,  19,  19,  13,  32,  28}, // 52: (12, 10)
+    { 37,   4,  25,  18,  20,  14,  31,  29}, // 53: (13, 10)
+    { 38,   5,  26,  17,  21,  15,  30,  30}, // 54: (14, 10)
+    { 37,   6,  27,  16,  20,  16,  29,  31}, // 55: (15, 10)
+    { 36,   7,  26,  15,  19,  17,  28,  32}, // 56: (16, 10)
+    { 35,   8,  25,  14,  18,  18,  27,  33}, // 57: (17, 10)
+    { 34,   9,  24,  13,  17,  19,  26,  34}, // 58: (18, 10)
+    { 33,  10,  23,  12,  16,  20,  25,  35}, // 59: (19, 10)
+    { 32,  11,  22,  11,  17,  21,  24,  36}, // 60: (20, 10)
+    { 31,  12,  21,  10,  18,  22,  23,  35}, // 61: (21, 10)
+    { 30,  13,  20,   9,  19,  23,  22,  34}, // 62: (22, 10)
+    { 31,  14,  21,   8,  20,  24,  23,  35}, // 63: (23, 10)
+    { 32,  15,  22,   7,  21,  25,  24,  36}, // 64: (24, 10)
+    { 33,  16,  23,   6,  22,  26,  25,  37}, // 65: (25, 10)
+    { 34,  17,  24,   5,  23,  27,  26,  38}, // 66: (26, 10)
+    { 35,  18,  25,   4,  24,  28,  27,  39}, // 67: (27, 10)
+    { 35,  16,  23,  30,  26,   2,  37,  27}, // 68: (2, 11)
+    { 30,  11,  18,  25,  21,   7,  32,  22}, // 69: (7, 11)
+    { 35,   8,  21,  22,  16,  12,  33,  27}, // 70: (10, 11)
+    { 34,  11,  22,  13,  15,  21,  26,  34}, // 71: (19, 11)
+    { 29,  14,  19,  10,  20,  24,  21,  33}, // 72: (22, 11)
+    { 34,  19,  24,   5,  25,  29,  26,  38}, // 73: (27, 11)
+    { 34,  17,  22,  31,  27,   1,  36,  26}, // 74: (2, 12)
+    { 29,  12,  17,  26,  22,   6,  31,  21}, // 75: (7, 12)
+    { 36,   9,  20,  23,  15,  13,  32,  28}, // 76: (10, 12)
+    { 35,  12,  21,  14,  14,  22,  27,  33}, // 77: (19, 12)
+    { 28,  15,  18,  11,  21,  25,  20,  32}, // 78: (22, 12)
+    { 33,  20,  23,   6,  26,  30,  25,  37}, // 79: (27, 12)
+    { 33,  18,  21,  32,  28,   0,  35,  25}, // 80: (2, 13)
+    { 32,  17,  20,  31,  27,   1,  34,  24}, // 81: (3, 13)
+    { 31,  16,  19,  30,  26,   2,  33,  23}, // 82: (4, 13)
+    { 30,  15,  18,  29,  25,   3,  32,  22}, // 83: (5, 13)
+    { 29,  14,  17,  28,  24,   4,  31,  21}, // 84: (6, 13)
+    { 28,  13,  16,  27,  23,   5,  30,  20}, // 85: (7, 13)
+    { 37,  10,  19,  24,  14,  14,  31,  29}, // 86: (10, 13)
+    { 36,  11,  18,  25,  13,  15,  30,  28}, // 87: (11, 13)
+    { 35,  12,  17,  26,  12,  16,  29,  27}, // 88: (12, 13)
+    { 34,  13,  16,  27,  11,  17,  28,  26}, // 89: (13, 13)
+    { 33,  16,  17,  18,  10,  26,  25,  29}, // 90: (16, 13)
+    { 34,  15,  18,  17,  11,  25,  26,  30}, // 91: (17, 13)
+    { 35,  14,  19,  16,  12,  24,  27,  31}, // 92: (18, 13)
+    { 36,  13,  20,  15,  13,  23,  28,  32}, // 93: (19, 13)
+    { 27,  16,  17,  12,  22,  26,  19,  31}, // 94: (22, 13)
+    { 28,  17,  18,  11,  23,  27,  20,  32}, // 95: (23, 13)
+    { 29,  18,  19,  10,  24,  28,  21,  33}, // 96: (24, 13)
+    { 30,  19,  20,   9,  25,  29,  22,  34}, // 97: (25, 13)
+    { 31,  20,  21,   8,  26,  30,  23,  35}, // 98: (26, 13)
+    { 32,  21,  22,   7,  27,  31,  24,  36}, // 99: (27, 13)
+    { 27,  14,  15,  28,  22,   6,  29,  19}, // 100: (7, 14)
+    { 33,  14,  15,  26,  10,  18,  27,  25}, // 101: (13, 14)
+    { 32,  17,  16,  19,   9,  25,  24,  28}, // 102: (16, 14)
+    { 26,  17,  16,  13,  21,  27,  18,  30}, // 103: (22, 14)
+    { 26,  15,  14,  29,  21,   7,  28,  18}, // 104: (7, 15)
+    { 32,  15,  14,  25,   9,  19,  26,  24}, // 105: (13, 15)
+    { 31,  18,  15,  20,   8,  24,  23,  27}, // 106: (16, 15)
+    { 25,  18,  15,  14,  20,  26,  17,  29}, // 107: (22, 15)
+    { 25,  16,  13,  30,  20,   8,  27,  17}, // 108: (7, 16)
+    { 28,  19,  10,  27,  11,  17,  28,  20}, // 109: (10, 16)
+    { 29,  18,  11,  26,  10,  18,  27,  21}, // 110: (11, 16)
+    { 30,  17,  12,  25,   9,  19,  26,  22}, // 111: (12, 16)
+    { 31,  16,  13,  24,   8,  20,  25,  23}, // 112: (13, 16)
+    { 32,  17,  14,  23,   7,  21,  24,  24}, // 113: (14, 16)
+    { 31,  18,  15,  22,   6,  22,  23,  25}, // 114: (15, 16)
+    { 30,  19,  14,  21,   7,  23,  22,  26}, // 115: (16, 16)
+    { 29,  20,  13,  22,   8,  24,  21,  27}, // 116: (17, 16)
+    { 28,  21,  12,  23,   9,  25,  20,  28}, // 117: (18, 16)
+    { 27,  22,  11,  24,  10,  26,  19,  29}, // 118: (19, 16)
+    { 24,  19,  14,  15,  19,  25,  16,  28}, // 119: (22, 16)
+    { 24,  17,  12,  31,  19,   9,  26,  16}, // 120: (7, 17)
+    { 27,  20,   9,  28,  12,  16,  27,  19}, // 121: (10, 17)
+    { 33,  18,  15,  24,   6,  22,  25,  25}, // 122: (14, 17)
+    { 32,  19,  16,  23,   5,  23,  24,  26}, // 123: (15, 17)
+    { 26,  23,  10,  23,  11,  27,  18,  28}, // 124: (19, 17)
+    { 23,  20,  13,  16,  18,  24,  15,  27}, // 125: (22, 17)
+    { 23,  18,  11,  30,  18,  10,  25,  15}, // 126: (7, 18)
+    { 26,  21,   8,  29,  13,  15,  26,  18}, // 127: (10, 18)
+    { 36,  21,  18,  27,   7,  25,  28,  28}, // 128: (12, 18)
+    { 35,  20,  17,  26,   6,  24,  27,  27}, // 129: (13, 18)
+    { 34,  19,  16,  25,   5,  23,  26,  26}, // 130: (14, 18)
+    { 33,  20,  17,  24,   4,  24,  25,  27}, // 131: (15, 18)
+    { 34,  21,  18,  25,   3,  25,  26,  28}, // 132: (16, 18)
+    { 35,  22,  19,  26,   2,  26,  27,  29}, // 133: (17, 18)
+    { 25,  24,   9,  22,  12,  26,  17,  27}, // 134: (19, 18)
+    { 22,  21,  12,  17,  17,  23,  14,  26}, // 135: (22, 18)
+    { 27,  24,  15,  24,  22,  16,  19,  19}, // 136: (2, 19)
+    { 26,  23,  14,  25,  21,  15,  20,  18}, // 137: (3, 19)
+    { 25,  22,  13,  26,  20,  14,  21,  17}, // 138: (4, 19)
+    { 24,  21,  12,  27,  19,  13,  22,  16}, // 139: (5, 19)
+    { 23,  20,  11,  28,  18,  12,  23,  15}, // 140: (6, 19)
+    { 22,  19,  10,  29,  17,  11,  24,  14}, // 141: (7, 19)
+    { 23,  20,   9,  30,  16,  12,  25,  15}, // 142: (8, 19)
+    { 24,  21,   8,  31,  15,  13,  26,  16}, // 143: (9, 19)
+    { 25,  22,   7,  30,  14,  14,  25,  17}, // 144: (10, 19)
+    { 37,  22,  19,  28,   6,  26,  29,  29}, // 145: (12, 19)
+    { 36,  21,  18,  27,   5,  25,  28,  28}, // 146: (13, 19)
+    { 35,  20,  17,  26,   4,  24,  27,  27}, // 147: (14, 19)
+    { 34,  21,  18,  25,   3,  25,  26,  28}, // 148: (15, 19)
+    { 35,  22,  19,  26,   2,  26,  27,  29}, // 149: (16, 19)
+    { 36,  23,  20,  27,   1,  27,  28,  30}, // 150: (17, 19)
+    { 24,  25,   8,  21,  13,  25,  16,  26}, // 151: (19, 19)
+    { 23,  24,   9,  20,  14,  24,  15,  27}, // 152: (20, 19)
+    { 22,  23,  10,  19,  15,  23,  14,  26}, // 153: (21, 19)
+    { 21,  22,  11,  18,  16,  22,  13,  25}, // 154: (22, 19)
+    { 22,  23,  12,  19,  17,  21,  14,  24}, // 155: (23, 19)
+    { 23,  24,  13,  20,  18,  20,  15,  23}, // 156: (24, 19)
+    { 24,  25,  14,  21,  19,  19,  16,  22}, // 157: (25, 19)
+    { 25,  26,  15,  22,  20,  18,  17,  21}, // 158: (26, 19)
+    { 26,  25,  16,  23,  21,  17,  18,  20}, // 159: (27, 19)
+    { 21,  20,  11,  30,  18,  12,  25,  13}, // 160: (7, 20)
+    { 24,  23,   6,  31,  15,  15,  24,  16}, // 161: (10, 20)
+    { 38,  23,  20,  29,   5,  27,  30,  30}, // 162: (12, 20)
+    { 37,  22,  19,  28,   4,  26,  29,  29}, // 163: (13, 20)
+    { 36,  21,  18,  27,   3,  25,  28,  28}, // 164: (14, 20)
+    { 35,  22,  19,  26,   2,  26,  27,  29}, // 165: (15, 20)
+    { 36,  23,  20,  27,   1,  27,  28,  30}, // 166: (16, 20)
+    { 37,  24,  21,  28,   0,  28,  29,  31}, // 167: (17, 20)
+    { 23,  26,   7,  22,  14,  26,  15,  25}, // 168: (19, 20)
+    { 20,  23,  12,  19,  17,  23,  12,  26}, // 169: (22, 20)
+    { 20,  21,  12,  31,  19,  13,  26,  12}, // 170: (7, 21)
+    { 23,  24,   5,  32,  16,  16,  23,  15}, // 171: (10, 21)
+    { 22,  27,   6,  23,  15,  27,  14,  24}, // 172: (19, 21)
+    { 19,  24,  13,  20,  18,  24,  11,  27}, // 173: (22, 21)
+    { 19,  22,  13,  32,  20,  14,  27,  11}, // 174: (7, 22)
+    { 22,  25,   4,  33,  17,  17,  22,  14}, // 175: (10, 22)
+    { 23,  26,   3,  32,  18,  18,  21,  15}, // 176: (11, 22)
+    { 24,  27,   2,  31,  19,  19,  20,  16}, // 177: (12, 22)
+    { 25,  28,   1,  30,  20,  20,  19,  17}, // 178: (13, 22)
+    { 26,  29,   0,  29,  21,  21,  18,  18}, // 179: (14, 22)
+    { 25,  30,   1,  28,  20,  22,  17,  19}, // 180: (15, 22)
+    { 24,  31,   2,  27,  19,  23,  16,  20}, // 181: (16, 22)
+    { 23,  30,   3,  26,  18,  24,  15,  21}, // 182: (17, 22)
+    { 22,  29,   4,  25,  17,  25,  14,  22}, // 183: (18, 22)
+    { 21,  28,   5,  24,  16,  26,  13,  23}, // 184: (19, 22)
+    { 18,  25,  14,  21,  19,  25,  10,  28}, // 185: (22, 22)
+    { 18,  23,  12,  33,  21,  15,  28,  10}, // 186: (7, 23)
+    { 21,  26,   5,  34,  18,  18,  23,  13}, // 187: (10, 23)
+    { 20,  29,   6,  25,  17,  27,  12,  24}, // 188: (19, 23)
+    { 17,  26,  13,  22,  20,  26,   9,  29}, // 189: (22, 23)
+    { 17,  24,  11,  34,  22,  16,  29,   9}, // 190: (7, 24)
+    { 20,  27,   6,  35,  19,  19,  24,  12}, // 191: (10, 24)
+    { 19,  30,   7,  26,  18,  28,  11,  25}, // 192: (19, 24)
+    { 16,  27,  12,  23,  21,  27,   8,  30}, // 193: (22, 24)
+    { 21,  30,  15,  40,  28,  22,  33,   3}, // 194: (2, 25)
+    { 20,  29,  14,  39,  27,  21,  32,   4}, // 195: (3, 25)
+    { 19,  28,  13,  38,  26,  20,  31,   5}, // 196: (4, 25)
+    { 18,  27,  12,  37,  25,  19,  30,   6}, // 197: (5, 25)
+    { 17,  26,  11,  36,  24,  18,  29,   7}, // 198: (6, 25)
+    { 16,  25,  10,  35,  23,  17,  28,   8}, // 199: (7, 25)
+    { 17,  26,   9,  36,  22,  18,  27,   9}, // 200: (8, 25)
+    { 18,  27,   8,  37,  21,  19,  26,  10}, // 201: (9, 25)
+    { 19,  28,   7,  36,  20,  20,  25,  11}, // 202: (10, 25)
+    { 18,  29,   8,  37,  21,  21,  24,  12}, // 203: (11, 25)
+    { 17,  30,   9,  38,  22,  22,  23,  13}, // 204: (12, 25)
+    { 16,  31,  10,  39,  23,  23,  22,  14}, // 205: (13, 25)
+    { 15,  34,  11,  30,  22,  32,  13,  23}, // 206: (16, 25)
+    { 16,  33,  10,  29,  21,  31,  12,  24}, // 207: (17, 25)
+    { 17,  32,   9,  28,  20,  30,  11,  25}, // 208: (18, 25)
+    { 18,  31,   8,  27,  19,  29,  10,  26}, // 209: (19, 25)
+    { 17,  30,   9,  26,  20,  30,   9,  27}, // 210: (20, 25)
+    { 16,  29,  10,  25,  21,  29,   8,  28}, // 211: (21, 25)
+    { 15,  28,  11,  24,  22,  28,   7,  29}, // 212: (22, 25)
+    { 16,  29,  12,  25,  23,  29,   6,  30}, // 213: (23, 25)
+    { 17,  30,  13,  26,  24,  30,   5,  31}, // 214: (24, 25)
+    { 18,  31,  14,  27,  25,  31,   4,  32}, // 215: (25, 25)
+    { 19,  32,  15,  28,  26,  32,   3,  33}, // 216: (26, 25)
+    { 20,  33,  16,  29,  27,  33,   2,  34}, // 217: (27, 25)
+    { 20,  31,  16,  41,  29,  23,  34,   2}, // 218: (2, 26)
+    { 15,  26,  11,  36,  24,  18,  27,   9}, // 219: (7, 26)
+    { 15,  32,  11,  38,  24,  24,  21,  15}, // 220: (13, 26)
+    { 14,  35,  12,  31,  23,  31,  14,  22}, // 221: (16, 26)
+    { 14,  29,  12,  25,  23,  29,   8,  28}, // 222: (22, 26)
+    { 19,  34,  17,  30,  28,  34,   1,  35}, // 223: (27, 26)
+    { 19,  32,  17,  42,  30,  24,  35,   1}, // 224: (2, 27)
+    { 14,  27,  12,  37,  25,  19,  26,  10}, // 225: (7, 27)
+    { 14,  33,  12,  37,  25,  25,  20,  16}, // 226: (13, 27)
+    { 13,  36,  13,  32,  24,  30,  15,  21}, // 227: (16, 27)
+    { 13,  30,  13,  26,  24,  30,   9,  27}, // 228: (22, 27)
+    { 18,  35,  18,  31,  29,  35,   0,  36}, // 229: (27, 27)
+    { 18,  33,  18,  43,  31,  25,  36,   0}, // 230: (2, 28)
+    { 17,  34,  19,  44,  32,  26,  35,   1}, // 231: (3, 28)
+    { 16,  35,  20,  45,  33,  27,  34,   2}, // 232: (4, 28)
+    { 13,  28,  13,  38,  26,  20,  25,  11}, // 233: (7, 28)
+    { 12,  29,  14,  39,  27,  21,  24,  12}, // 234: (8, 28)
+    { 11,  30,  15,  40,  28,  22,  23,  13}, // 235: (9, 28)
+    { 10,  31,  16,  39,  29,  23,  22,  14}, // 236: (10, 28)
+    { 11,  32,  15,  38,  28,  24,  21,  15}, // 237: (11, 28)
+    { 12,  33,  14,  37,  27,  25,  20,  16}, // 238: (12, 28)
+    { 13,  34,  13,  36,  26,  26,  19,  17}, // 239: (13, 28)
+    { 14,  35,  14,  35,  27,  27,  18,  18}, // 240: (14, 28)
+    { 13,  36,  15,  34,  26,  28,  17,  19}, // 241: (15, 28)
+    { 12,  37,  14,  33,  25,  29,  16,  20}, // 242: (16, 28)
+    { 11,  36,  15,  32,  26,  30,  15,  21}, // 243: (17, 28)
+    { 10,  35,  16,  31,  27,  31,  14,  22}, // 244: (18, 28)
+    {  9,  34,  17,  30,  28,  32,  13,  23}, // 245: (19, 28)
+    { 10,  33,  16,  29,  27,  33,  12,  24}, // 246: (20, 28)
+    { 11,  32,  15,  28,  26,  32,  11,  25}, // 247: (21, 28)
+    { 12,  31,  14,  27,  25,  31,  10,  26}, // 248: (22, 28)
+    { 15,  38,  21,  34,  32,  38,   3,  33}, // 249: (25, 28)
+    { 16,  37,  20,  33,  31,  37,   2,  34}, // 250: (26, 28)
+    { 17,  36,  19,  32,  30,  36,   1,  35}, // 251: (27, 28)
+    { 15,  36,  21,  46,  34,  28,  33,   3}, // 252: (4, 29)
+    { 12,  29,  14,  39,  27,  21,  26,  10}, // 253: (7, 29)
+    {  9,  32,  17,  40,  30,  24,  23,  15}, // 254: (10, 29)
+    {  8,  35,  18,  31,  29,  33,  14,  24}, // 255: (19, 29)
+    { 11,  32,  15,  28,  26,  32,  11,  27}, // 256: (22, 29)
+    { 14,  39,  22,  35,  33,  39,   4,  32}, // 257: (25, 29)
+    { 14,  35,  20,  45,  33,  27,  32,   4}, // 258: (4, 30)
+    { 11,  30,  15,  40,  28,  22,  27,   9}, // 259: (7, 30)
+    {  8,  33,  18,  41,  31,  25,  24,  16}, // 260: (10, 30)
+    {  7,  36,  19,  32,  30,  34,  15,  25}, // 261: (19, 30)
+    { 10,  33,  16,  29,  27,  33,  10,  28}, // 262: (22, 30)
+    { 13,  38,  21,  34,  32,  38,   5,  31}, // 263: (25, 30)
+    { 15,  36,  21,  46,  34,  28,  33,   7}, // 264: (2, 31)
+    { 14,  35,  20,  45,  33,  27,  32,   6}, // 265: (3, 31)
+    { 13,  34,  19,  44,  32,  26,  31,   5}, // 266: (4, 31)
+    { 12,  33,  18,  43,  31,  25,  30,   6}, // 267: (5, 31)
+    { 11,  32,  17,  42,  30,  24,  29,   7}, // 268: (6, 31)
+    { 10,  31,  16,  41,  29,  23,  28,   8}, // 269: (7, 31)
+    {  7,  34,  19,  42,  32,  26,  25,  17}, // 270: (10, 31)
+    {  6,  35,  20,  43,  33,  27,  24,  18}, // 271: (11, 31)
+    {  5,  36,  21,  44,  34,  28,  23,  19}, // 272: (12, 31)
+    {  4,  37,  22,  43,  35,  29,  22,  18}, // 273: (13, 31)
+    {  3,  40,  23,  36,  34,  36,  19,  21}, // 274: (16, 31)
+    {  4,  39,  22,  35,  33,  37,  18,  22}, // 275: (17, 31)
+    {  5,  38,  21,  34,  32,  36,  17,  23}, // 276: (18, 31)
+    {  6,  37,  20,  33,  31,  35,  16,  24}, // 277: (19, 31)
+    {  9,  34,  17,  30,  28,  34,   9,  27}, // 278: (22, 31)
+    { 10,  35,  18,  31,  29,  35,   8,  28}, // 279: (23, 31)
+    { 11,  36,  19,  32,  30,  36,   7,  29}, // 280: (24, 31)
+    { 12,  37,  20,  33,  31,  37,   6,  30}, // 281: (25, 31)
+    { 13,  38,  21,  34,  32,  38,   7,  31}, // 282: (26, 31)
+    { 14,  39,  22,  35,  33,  39,   8,  32}, // 283: (27, 31)
+    { 14,  37,  22,  47,  35,  29,  32,   8}, // 284: (2, 32)
+    {  9,  32,  17,  42,  30,  24,  27,   9}, // 285: (7, 32)
+    {  3,  38,  23,  42,  36,  30,  21,  17}, // 286: (13, 32)
+    {  2,  41,  24,  37,  35,  35,  18,  20}, // 287: (16, 32)
+    {  8,  35,  18,  31,  29,  35,  10,  26}, // 288: (22, 32)
+    { 13,  40,  23,  36,  34,  40,   9,  31}, // 289: (27, 32)
+    { 13,  38,  23,  48,  36,  30,  31,   9}, // 290: (2, 33)
+    { 12,  37,  22,  47,  35,  29,  30,  10}, // 291: (3, 33)
+    { 11,  36,  21,  46,  34,  28,  29,  11}, // 292: (4, 33)
+    { 10,  35,  20,  45,  33,  27,  28,  12}, // 293: (5, 33)
+    {  9,  34,  19,  44,  32,  26,  27,  11}, // 294: (6, 33)
+    {  8,  33,  18,  43,  31,  25,  26,  10}, // 295: (7, 33)
+    {  7,  34,  19,  44,  32,  26,  25,  11}, // 296: (8, 33)
+    {  6,  35,  20,  45,  33,  27,  24,  12}, // 297: (9, 33)
+    {  5,  36,  21,  44,  34,  28,  23,  13}, // 298: (10, 33)
+    {  4,  37,  22,  43,  35,  29,  22,  14}, // 299: (11, 33)
+    {  3,  38,  23,  42,  36,  30,  21,  15}, // 300: (12, 33)
+    {  2,  39,  24,  41,  37,  31,  20,  16}, // 301: (13, 33)
+    {  1,  40,  25,  40,  38,  32,  19,  17}, // 302: (14, 33)
+    {  0,  41,  26,  39,  37,  33,  18,  18}, // 303: (15, 33)
+    {  1,  42,  25,  38,  36,  34,  17,  19}, // 304: (16, 33)
+    {  2,  41,  24,  37,  35,  35,  16,  20}, // 305: (17, 33)
+    {  3,  40,  23,  36,  34,  36,  15,  21}, // 306: (18, 33)
+    {  4,  39,  22,  35,  33,  37,  14,  22}, // 307: (19, 33)
+    {  5,  38,  21,  34,  32,  38,  13,  23}, // 308: (20, 33)
+    {  6,  37,  20,  33,  31,  37,  12,  24}, // 309: (21, 33)
+    {  7,  36,  19,  32,  30,  36,  11,  25}, // 310: (22, 33)
+    {  8,  37,  20,  33,  31,  37,  12,  26}, // 311: (23, 33)
+    {  9,  38,  21,  34,  32,  38,  13,  27}, // 312: (24, 33)
+    { 10,  39,  22,  35,  33,  39,  12,  28}, // 313: (25, 33)
+    { 11,  40,  23,  36,  34,  40,  11,  29}, // 314: (26, 33)
+    { 12,  41,  24,  37,  35,  41,  10,  30}, // 315: (27, 33)
+};
+
+#endif /* USE_LANDMARKS */
+
+// Directions a ghost may leave each cell by: bit DIR_* set if the step lands on a ghost cell
+const uint8_t ghost_exits[40][30] = {
+    { 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0},
+    { 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0},
+    { 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0},
+    { 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0},
+    { 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0},
+    { 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0},
+    { 0,  0,  3, 10, 10, 10, 10, 11, 10, 10, 10, 10, 10,  9,  0,  0,  3, 10, 10, 10, 10, 10, 11, 10, 10, 10, 10,  9,  0,  0},
+    { 0,  0,  5,  0,  0,  0,  0,  5,  0,  0,  0,  0,  0,  5,  0,  0,  5,  0,  0,  0,  0,  0,  5,  0,  0,  0,  0,  5,  0,  0},
+    { 0,  0,  5,  0,  0,  0,  0,  5,  0,  0,  0,  0,  0,  5,  0,  0,  5,  0,  0,  0,  0,  0,  5,  0,  0,  0,  0,  5,  0,  0},
+    { 0,  0,  5,  0,  0,  0,  0,  5,  0,  0,  0,  0,  0,  5,  0,  0,  5,  0,  0,  0,  0,  0,  5,  0,  0,  0,  0,  5,  0,  0},
+    { 0,  0,  7, 10, 10, 10, 10, 15, 10, 10, 11, 10, 10, 14, 10, 10, 14, 10, 10, 11, 10, 10, 15, 10, 10, 10, 10, 13,  0,  0},
+    { 0,  0,  5,  0,  0,  0,  0,  5,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,  0,  5,  0,  0,  5,  0,  0,  0,  0,  5,  0,  0},
+    { 0,  0,  5,  0,  0,  0,  0,  5,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,  0,  5,  0,  0,  5,  0,  0,  0,  0,  5,  0,  0},
+    { 0,  0,  6, 10, 10, 10, 10, 13,  0,  0,  6, 10, 10,  9,  0,  0,  3, 10, 10, 12,  0,  0,  7, 10, 10, 10, 10, 12,  0,  0},
+    { 0,  0,  0,  0,  0,  0,  0,  5,  0,  0,  0,  0,  0,  5,  0,  0,  5,  0,  0,  0,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0},
+    { 0,  0,  0,  0,  0,  0,  0,  5,  0,  0,  0,  0,  0,  5,  0,  0,  5,  0,  0,  0,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0},
+    { 0,  0,  0,  0,  0,  0,  0,  5,  0,  0,  3, 10, 10, 14, 11, 11, 14, 10, 10,  9,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0},
+    { 0,  0,  0,  0,  0,  0,  0,  5,  0,  0,  5,  0,  0,  0,  7, 13,  0,  0,  0,  5,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0},
+    { 0,  0,  0,  0,  0,  0,  0,  5,  0,  0,  5,  0,  3, 11, 15, 15, 11,  9,  0,  5,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0},
+    { 0,  0, 10, 10, 10, 10, 10, 15, 10, 10, 13,  0,  7, 15, 15, 15, 15, 13,  0,  7, 10, 10, 15, 10, 10, 10, 10, 10,  0,  0},
+    { 0,  0,  0,  0,  0,  0,  0,  5,  0,  0,  5,  0,  6, 14, 14, 14, 14, 12,  0,  5,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0},
+    { 0,  0,  0,  0,  0,  0,  0,  5,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,  0,  5,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0},
+    { 0,  0,  0,  0,  0,  0,  0,  5,  0,  0,  7, 10, 10, 10, 10, 10, 10, 10, 10, 13,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0},
+    { 0,  0,  0,  0,  0,  0,  0,  5,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,  0,  5,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0},
+    { 0,  0,  0,  0,  0,  0,  0,  5,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,  0,  5,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0},
+    { 0,  0,  3, 10, 10, 10, 10, 15, 10, 10, 14, 10, 10,  9,  0,  0,  3, 10, 10, 14, 10, 10, 15, 10, 10, 10, 10,  9,  0,  0},
+    { 0,  0,  5,  0,  0,  0,  0,  5,  0,  0,  0,  0,  0,  5,  0,  0,  5,  0,  0,  0,  0,  0,  5,  0,  0,  0,  0,  5,  0,  0},
+    { 0,  0,  5,  0,  0,  0,  0,  5,  0,  0,  0,  0,  0,  5,  0,  0,  5,  0,  0,  0,  0,  0,  5,  0,  0,  0,  0,  5,  0,  0},
+    { 0,  0,  6, 10,  9,  0,  0,  7, 10, 10, 11, 10, 10, 14, 10, 10, 14, 10, 10, 11, 10, 10, 13,  0,  0,  3, 10, 12,  0,  0},
+    { 0,  0,  0,  0,  5,  0,  0,  5,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,  0,  5,  0,  0,  5,  0,  0,  5,  0,  0,  0,  0},
+    { 0,  0,  0,  0,  5,  0,  0,  5,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,  0,  5,  0,  0,  5,  0,  0,  5,  0,  0,  0,  0},
+    { 0,  0,  3, 10, 14, 10, 10, 13,  0,  0,  6, 10, 10,  9,  0,  0,  3, 10, 10, 12,  0,  0,  7, 10, 10, 14, 10,  9,  0,  0},
+    { 0,  0,  5,  0,  0,  0,  0,  5,  0,  0,  0,  0,  0,  5,  0,  0,  5,  0,  0,  0,  0,  0,  5,  0,  0,  0,  0,  5,  0,  0},
+    { 0,  0,  6, 10, 10, 10, 10, 14, 10, 10, 10, 10, 10, 14, 10, 10, 14, 10, 10, 10, 10, 10, 14, 10, 10, 10, 10, 12,  0,  0},
+    { 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0},
+    { 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0},
+    { 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0},
+    { 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0},
+    { 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0},
+    { 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0},
+};
+
+#if USE_NEXTHOP_TABLE
+
+// First step (DIR_*) of a shortest route: nexthop_table[source][target >> 2] >> ((target & 3) * 2) & 3
+const uint8_t nexthop_table[MAZE_CELLS][NEXTHOP_ROW_BYTES] = {
+    { // 0: (2, 6)
+        0x54, 0x55, 0x55, 0x00, 0x00, 0x00, 0x14, 0x40, 0x01, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    },
+    { // 1: (3, 6)
+        0x53, 0x55, 0x55, 0x55, 0x55, 0x55, 0x57, 0x75, 0x55, 0x57, 0xF5, 0x5F, 0x55, 0x55, 0x55, 0x55,
+        0x55, 0x57, 0x75, 0x55, 0xFF, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+        0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+        0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+        0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    },
+    { // 2: (4, 6)
+        0x4F, 0x55, 0x55, 0x55, 0x55, 0x55, 0x57, 0x75, 0x55, 0x57, 0xF5, 0x57, 0x55, 0x55, 0x55, 0x55,
+        0x55, 0x57, 0x75, 0x55, 0x7F, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+        0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+        0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+        0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    },
+    { // 3: (5, 6)
+        0x3F, 0x55, 0x55, 0x55, 0x55, 0x55, 0x57, 0x75, 0x55, 0x57, 0xF5, 0x55, 0x55, 0x55, 0x55, 0x55,
+        0x55, 0x57, 0x75, 0x55, 0x5F, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+        0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+        0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+        0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    },
+    { // 4: (6, 6)
+        0xFF, 0x54, 0x55, 0x55, 0x55, 0x55, 0x57, 0x75, 0x55, 0x57, 0x75, 0x55, 0x55, 0x55, 0x55, 0x55,
+        0x55, 0x57, 0x75, 0x55, 0x57, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+        0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+        0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+        0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    },
+    { // 5: (7, 6)
+        0xFF, 0x53, 0x55, 0x00, 0x00, 0x00, 0x13, 0x30, 0x01, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    },
+    { // 6: (8, 6)
+        0xFF, 0x4F, 0x55, 0x55, 0x55, 0x55, 0x5F, 0xF5, 0x55, 0x5F, 0xF5, 0xFF, 0xFF, 0x55, 0x55, 0x55,
+        0x55, 0x7F, 0xF5, 0x57, 0xFF, 0xFF, 0x5F, 0x55, 0x55, 0x5F, 0x7F, 0xFF, 0xFF, 0x7F, 0xFF, 0xF7,
+        0xFF, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    },
+    { // 7: (9, 6)
+        0xFF, 0x3F, 0x55, 0x55, 0x55, 0x55, 0x5F, 0xF5, 0x55, 0x5F, 0xF5, 0xFF, 0x7F, 0x55, 0x55, 0x55,
+        0x55, 0x7F, 0xF5, 0x57, 0xFF, 0xFF, 0x5F, 0x55, 0x55, 0x5F, 0x5F, 0xFF, 0xFF, 0x7F, 0xFF, 0xF7,
+        0xFF, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xD5, 0xFF, 0xFF, 0xFF, 0xF7, 0xF7, 0xFF, 0xFF, 0xF7, 0xF7,
+        0xF7, 0xFF, 0xFF, 0xFF, 0x5F, 0x55, 0xF5, 0x5F, 0xFF, 0xF5, 0xFF, 0xFF, 0xFF, 0x5F, 0x55, 0xFF,
+        0xF5, 0x5F, 0xFF, 0xFF, 0xFF, 0x5F, 0x55, 0xFF, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0x55, 0x55,
+    },
+    { // 8: (10, 6)
+        0xFF, 0xFF, 0x54, 0x55, 0x55, 0x55, 0x5F, 0xF5, 0x55, 0x5F, 0xF5, 0xFF, 0x5F, 0x55, 0x55, 0x55,
+        0x55, 0x5F, 0xF5, 0x55, 0xFF, 0x5F, 0x55, 0x55, 0x55, 0x57, 0x57, 0x57, 0x55, 0x55, 0x5F, 0xF5,
+        0x55, 0x55, 0xFF, 0xFF, 0x57, 0x55, 0x55, 0xFF, 0x5F, 0x55, 0xF5, 0xF5, 0xFF, 0xFF, 0xF5, 0xF5,
+        0xF5, 0xFF, 0xFF, 0x5F, 0x55, 0x55, 0xF5, 0x5F, 0xFF, 0xF5, 0xFF, 0xFF, 0xFF, 0x57, 0x55, 0x7F,
+        0xF5, 0x57, 0xFF, 0xFF, 0x7F, 0x55, 0x55, 0xFF, 0xF5, 0xFF, 0xFF, 0xFF, 0x7F, 0x55, 0x55,
+    },
+    { // 9: (11, 6)
+        0xFF, 0xFF, 0x53, 0x55, 0x55, 0x55, 0x5F, 0xF5, 0x55, 0x5F, 0xF5, 0xFF, 0x57, 0x55, 0x55, 0x55,
+        0x55, 0x5F, 0xF5, 0x55, 0xFF, 0x5F, 0x55, 0x55, 0x55, 0x57, 0x57, 0x57, 0x55, 0x55, 0x57, 0xF5,
+        0x55, 0x55, 0xFF, 0xFF, 0x57, 0x55, 0x55, 0xFD, 0x5F, 0x55, 0xF5, 0xF5, 0xFF, 0x7F, 0xF5, 0xF5,
+        0xF5, 0xFF, 0xFF, 0x5F, 0x55, 0x55, 0xF5, 0x57, 0xFF, 0xF5, 0xFF, 0xFF, 0xFF, 0x55, 0x55, 0x7F,
+        0xF5, 0x57, 0xFF, 0xFF, 0x5F, 0x55, 0x55, 0xFF, 0xF5, 0xFF, 0xFF, 0xFF, 0x5F, 0x55, 0x55,
+    },
+    { // 10: (12, 6)
+        0xFF, 0xFF, 0x4F, 0x55, 0x55, 0x55, 0x5F, 0xF5, 0x55, 0x5F, 0xF5, 0xFF, 0x55, 0x55, 0x55, 0x55,
+        0x55, 0x5F, 0xF5, 0x55, 0xFF, 0x5F, 0x55, 0x55, 0x55, 0x57, 0x57, 0x57, 0x55, 0x55, 0x57, 0x75,
+        0x55, 0x55, 0xFF, 0xFF, 0x57, 0x55, 0x55, 0xF5, 0x5F, 0x55, 0xF5, 0xF5, 0xFF, 0x5F, 0xF5, 0xF5,
+        0xF5, 0xFF, 0xFF, 0x5F, 0x55, 0x55, 0xF5, 0x57, 0x7F, 0xF5, 0xFF, 0xFF, 0x7F, 0x55, 0x55, 0x7F,
+        0xF5, 0x57, 0xFF, 0xFF, 0x5F, 0x55, 0x55, 0x7F, 0xF5, 0xFF, 0xFF, 0xFF, 0x57, 0x55, 0x55,
+    },
+    { // 11: (13, 6)
+        0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    },
+    { // 12: (16, 6)
+        0x00, 0x00, 0x00, 0x54, 0x55, 0x55, 0x00, 0x05, 0x50, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    },
+    { // 13: (17, 6)
+        0xFF, 0xFF, 0xFF, 0x53, 0x55, 0x55, 0xFF, 0xF5, 0x5F, 0xFF, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0x57,
+        0x55, 0xFF, 0xF5, 0x5F, 0xFF, 0xFF, 0xFF, 0x5F, 0x55, 0x7F, 0x7F, 0xFF, 0xFF, 0x7F, 0xFF, 0xF7,
+        0xFF, 0x5F, 0xD5, 0xFF, 0xFF, 0x7F, 0x55, 0x55, 0xFF, 0xFF, 0xF5, 0xF5, 0x57, 0x55, 0xF5, 0xF5,
+        0xF5, 0xFF, 0xFF, 0x5F, 0x55, 0x55, 0xF5, 0x57, 0x5F, 0xF5, 0xFF, 0x5F, 0x55, 0x55, 0x55, 0x7F,
+        0xF5, 0x57, 0xFF, 0xFF, 0x5F, 0x55, 0x55, 0x5F, 0xF5, 0xFF, 0xFF, 0x55, 0x55, 0x55, 0x55,
+    },
+    { // 14: (18, 6)
+        0xFF, 0xFF, 0xFF, 0x4F, 0x55, 0x55, 0xFF, 0xF5, 0x5F, 0xFF, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0x55,
+        0x55, 0xFF, 0xF5, 0x5F, 0xFF, 0xFF, 0xFF, 0x5F, 0x55, 0x7F, 0x7F, 0xFF, 0xFF, 0x7F, 0xFF, 0xF5,
+        0xFF, 0x5F, 0x55, 0xFF, 0xFF, 0x7F, 0x55, 0x55, 0xFF, 0xFF, 0xF5, 0xF5, 0x55, 0x55, 0xF5, 0xF5,
+        0xF5, 0xFF, 0xFF, 0x5F, 0x55, 0x55, 0xF5, 0x55, 0x5F, 0xF5, 0xFF, 0x57, 0x55, 0x55, 0x55, 0x7F,
+        0xF5, 0x57, 0xFF, 0xFF, 0x57, 0x55, 0x55, 0x5F, 0xF5, 0xFF, 0x7F, 0x55, 0x55, 0x55, 0x55,
+    },
+    { // 15: (19, 6)
+        0xFF, 0xFF, 0xFF, 0x3F, 0x55, 0x55, 0xFF, 0xF5, 0x5F, 0xFF, 0xF5, 0xFF, 0xFF, 0xFF, 0x7F, 0x55,
+        0x55, 0x7F, 0xF5, 0x57, 0xFF, 0xFF, 0x5F, 0x55, 0x55, 0x5F, 0x5F, 0x57, 0x55, 0x55, 0x57, 0x75,
+        0x55, 0x55, 0x55, 0xFD, 0x55, 0x55, 0x55, 0x55, 0x57, 0x55, 0x75, 0x75, 0x55, 0x55, 0x75, 0x75,
+        0xF5, 0xFF, 0x5F, 0x55, 0x55, 0x55, 0xF5, 0x55, 0x5F, 0xF5, 0xFF, 0x55, 0x55, 0x55, 0x55, 0x5F,
+        0xF5, 0x55, 0xFF, 0x5F, 0x55, 0x55, 0x55, 0x5F, 0xF5, 0xFF, 0x5F, 0x55, 0x55, 0x55, 0x55,
+    },
+    { // 16: (20, 6)
+        0xFF, 0xFF, 0xFF, 0xFF, 0x54, 0x55, 0xFF, 0xF5, 0x5F, 0xFF, 0xF5, 0xFF, 0xFF, 0xFF, 0x5F, 0x55,
+        0x55, 0x7F, 0xF5, 0x57, 0xFF, 0xFF, 0x5F, 0x55, 0x55, 0x5F, 0x57, 0x57, 0x55, 0x55, 0x57, 0x75,
+        0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+        0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+        0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    },
+    { // 17: (21, 6)
+        0xFF, 0xFF, 0xFF, 0xFF, 0x53, 0x55, 0xFF, 0xF5, 0x5F, 0xFF, 0xF5, 0xFF, 0xFF, 0xFF, 0x57, 0x55,
+        0x55, 0x7F, 0xF5, 0x57, 0xFF, 0xFF, 0x5F, 0x55, 0x55, 0x57, 0x57, 0x57, 0x55, 0x55, 0x57, 0x55,
+        0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+        0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+        0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    },
+    { // 18: (22, 6)
+        0x00, 0x00, 0x00, 0xFF, 0x4F, 0x55, 0xC0, 0x04, 0x4C, 0xC0, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    },
+    { // 19: (23, 6)
+        0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0x55, 0xFF, 0xF7, 0x7F, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0x5F, 0xFF, 0xF7, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0x5F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    },
+    { // 20: (24, 6)
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x54, 0xFF, 0xF7, 0x7F, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0x57, 0xFF, 0xF7, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0x57, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    },
+    { // 21: (25, 6)
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x53, 0xFF, 0xF7, 0x7F, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0x55, 0xFF, 0xF7, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0x55, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    },
+    { // 22: (26, 6)
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x4F, 0xFF, 0xF7, 0x7F, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F,
+        0x55, 0xFF, 0xF7, 0x7F, 0xFF, 0xFF, 0xFF, 0x7F, 0x55, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    },
+    { // 23: (27, 6)
+        0x00, 0x00, 0x00, 0xFF, 0xFF, 0x3F, 0xC0, 0x03, 0x3C, 0xC0, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    },
+    { // 24: (2, 7)
+        0xAA, 0xAA, 0xAA, 0x00, 0x00, 0x00, 0x28, 0x80, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    },
+    { // 25: (7, 7)
+        0xAA, 0xAA, 0xAA, 0x00, 0x00, 0x00, 0x22, 0x20, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    },
+    { // 26: (13, 7)
+        0xAA, 0xAA, 0xAA, 0x00, 0x00, 0x00, 0x0A, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    },
+    { // 27: (16, 7)
+        0x00, 0x00, 0x00, 0xAA, 0xAA, 0xAA, 0x00, 0x0A, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    },
+    { // 28: (22, 7)
+        0x00, 0x00, 0x00, 0xAA, 0xAA, 0xAA, 0x80, 0x08, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    },
+    { // 29: (27, 7)
+        0x00, 0x00, 0x00, 0xAA, 0xAA, 0xAA, 0x80, 0x02, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    },
+    { // 30: (2, 8)
+        0xAA, 0xAA, 0xAA, 0x00, 0x00, 0x00, 0x2A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    },
+    { // 31: (7, 8)
+        0xAA, 0xAA, 0xAA, 0x00, 0x00, 0x00, 0x2A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    },
+    { // 32: (13, 8)
+        0xAA, 0xAA, 0xAA, 0x00, 0x00, 0x00, 0x2A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    },
+    { // 33: (16, 8)
+        0x00, 0x00, 0x00, 0xAA, 0xAA, 0xAA, 0x80, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    },
+    { // 34: (22, 8)
+        0x00, 0x00, 0x00, 0xAA, 0xAA, 0xAA, 0x80, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    },
+    { // 35: (27, 8)
+        0x00, 0x00, 0x00, 0xAA, 0xAA, 0xAA, 0x80, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    },
+    { // 36: (2, 9)
+        0xAA, 0xAA, 0xAA, 0x00, 0x00, 0x00, 0x02, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    },
+    { // 37: (7, 9)
+        0xAA, 0xAA, 0xAA, 0x00, 0x00, 0x00, 0x08, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    },
+    { // 38: (13, 9)
+        0xAA, 0xAA, 0xAA, 0x00, 0x00, 0x00, 0x20, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    },
+    { // 39: (16, 9)
+        0x00, 0x00, 0x00, 0xAA, 0xAA, 0xAA, 0x80, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    },
+    { // 40: (22, 9)
+        0x00, 0x00, 0x00, 0xAA, 0xAA, 0xAA, 0x00, 0x02, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    },
+    { // 41: (27, 9)
+        0x00, 0x00, 0x00, 0xAA, 0xAA, 0xAA, 0x00, 0x08, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    },
+    { // 42: (2, 10)
+        0xAA, 0x56, 0x55, 0x55, 0x55, 0x55, 0x56, 0x65, 0x55, 0x56, 0x45, 0x55, 0x55, 0x55, 0x55, 0x55,
+        0x55, 0x54, 0x45, 0x55, 0x00, 0x50, 0x55, 0x55, 0x55, 0x54, 0x54, 0x50, 0x55, 0x55, 0x50, 0x01,
+        0x55, 0x15, 0x00, 0x00, 0x54, 0x55, 0x00, 0x00, 0x50, 0x55, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    },
+    { // 43: (3, 10)
+        0xFF, 0x55, 0x55, 0x55, 0x55, 0x55, 0x57, 0x75, 0x55, 0x57, 0x35, 0x55, 0x55, 0x55, 0x55, 0x55,
+        0x55, 0x57, 0x75, 0x55, 0xFF, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+        0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+        0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+        0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    },
+    { // 44: (4, 10)
+        0x7F, 0x55, 0x55, 0x55, 0x55, 0x55, 0x57, 0x75, 0x55, 0x57, 0xF5, 0x54, 0x55, 0x55, 0x55, 0x55,
+        0x55, 0x57, 0x75, 0x55, 0x7F, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+        0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+        0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+        0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    },
+    { // 45: (5, 10)
+        0x5F, 0x55, 0x55, 0x55, 0x55, 0x55, 0x57, 0x75, 0x55, 0x57, 0xF5, 0x53, 0x55, 0x55, 0x55, 0x55,
+        0x55, 0x57, 0x75, 0x55, 0x5F, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+        0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+        0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+        0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    },
+    { // 46: (6, 10)
+        0x57, 0x55, 0x55, 0x55, 0x55, 0x55, 0x57, 0x75, 0x55, 0x57, 0xF5, 0x4F, 0x55, 0x55, 0x55, 0x55,
+        0x55, 0x57, 0x75, 0x55, 0x57, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+        0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+        0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+        0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    },
+    { // 47: (7, 10)
+        0xAA, 0xAA, 0x6A, 0x55, 0x55, 0x55, 0x5B, 0xB5, 0x55, 0x5B, 0xF5, 0x3F, 0x55, 0x55, 0x55, 0x55,
+        0x55, 0x53, 0x35, 0x55, 0x00, 0x50, 0x55, 0x55, 0x55, 0x54, 0x54, 0x50, 0x55, 0x55, 0x50, 0x01,
+        0x55, 0x15, 0x00, 0x00, 0x54, 0x55, 0x00, 0x00, 0x50, 0x55, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    },
+    { // 48: (8, 10)
+        0xFF, 0xFF, 0x5F, 0x55, 0x55, 0x55, 0x5F, 0xF5, 0x55, 0x5F, 0xF5, 0xFF, 0x54, 0x55, 0x55, 0x55,
+        0x55, 0x5F, 0xF5, 0x55, 0xFF, 0x5F, 0x55, 0x55, 0x55, 0x57, 0x57, 0x57, 0x55, 0x55, 0x57, 0xF5,
+        0x55, 0x55, 0xFF, 0xFF, 0x57, 0x55, 0xF5, 0xFF, 0x5F, 0x55, 0xFD, 0xFD, 0xFF, 0x7F, 0xFD, 0xFD,
+        0xFD, 0xFF, 0xFF, 0x5F, 0x55, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    },
+    { // 49: (9, 10)
+        0xFF, 0xFF, 0x57, 0x55, 0x55, 0x55, 0x5F, 0xF5, 0x55, 0x5F, 0xF5, 0xFF, 0x53, 0x55, 0x55, 0x55,
+        0x55, 0x5F, 0xF5, 0x55, 0xFF, 0x5F, 0x55, 0x55, 0x55, 0x57, 0x57, 0x57, 0x55, 0x55, 0x57, 0x75,
+        0x55, 0x55, 0xFF, 0xFF, 0x57, 0x55, 0xD5, 0xFF, 0x5F, 0x55, 0xF5, 0xF5, 0xFF, 0x5F, 0xF5, 0xF5,
+        0xF5, 0xFF, 0xFF, 0x5F, 0x55, 0x55, 0xF5, 0x57, 0x7F, 0xF5, 0xFF, 0xFF, 0xFF, 0x5F, 0x55, 0xFF,
+        0xF5, 0x5F, 0xFF, 0xFF, 0xFF, 0x5F, 0x55, 0xFF, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0x55, 0x55,
+    },
+    { // 50: (10, 10)
+        0xFF, 0xFF, 0x55, 0x55, 0x55, 0x55, 0x5F, 0xF5, 0x55, 0x5F, 0xF5, 0xFF, 0x4F, 0x55, 0x55, 0x55,
+        0x55, 0x4F, 0xF5, 0x54, 0xFF, 0x0F, 0x40, 0x55, 0x55, 0x43, 0x43, 0x03, 0x00, 0x40, 0x03, 0x34,
+        0x00, 0x40, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x03, 0x00, 0x30, 0x30, 0x00, 0x00, 0x30, 0x30,
+        0xF0, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0xF0, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x3F,
+        0xF0, 0x03, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0x3F, 0x00, 0x00,
+    },
+    { // 51: (11, 10)
+        0xFF, 0x7F, 0x55, 0x55, 0x55, 0x55, 0x5F, 0xF5, 0x55, 0x5F, 0xF5, 0xFF, 0x3F, 0x55, 0x55, 0x55,
+        0x55, 0x7F, 0xF5, 0x57, 0xFF, 0xFF, 0x5F, 0x55, 0x55, 0x5F, 0x7F, 0xFF, 0xFF, 0x7F, 0xFF, 0xF7,
+        0xFF, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0x57, 0xFD, 0xFF, 0xFF, 0xF7, 0xF7, 0xFF, 0xFF, 0xF7, 0xF7,
+        0xF7, 0xFF, 0xFF, 0xFF, 0x7F, 0x55, 0xF5, 0x5F, 0xFF, 0xF5, 0xFF, 0xFF, 0xFF, 0x55, 0x55, 0x7F,
+        0xF5, 0x57, 0xFF, 0xFF, 0x5F, 0x55, 0x55, 0xFF, 0xF5, 0xFF, 0xFF, 0xFF, 0x5F, 0x55, 0x55,
+    },
+    { // 52: (12, 10)
+        0xFF, 0x5F, 0x55, 0x55, 0x55, 0x55, 0x5F, 0xF5, 0x55, 0x5F, 0xF5, 0xFF, 0xFF, 0x54, 0x55, 0x55,
+        0x55, 0x7F, 0xF5, 0x57, 0xFF, 0xFF, 0x5F, 0x55, 0x55, 0x5F, 0x5F, 0xFF, 0xFF, 0x7F, 0xFF, 0xF7,
+        0xFF, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0x55, 0xF5, 0xFF, 0xFF, 0xF7, 0xF7, 0xFF, 0xFF, 0xF7, 0xF7,
+        0xF7, 0xFF, 0xFF, 0xFF, 0x5F, 0x55, 0xF5, 0x5F, 0xFF, 0xF5, 0xFF, 0xFF, 0x7F, 0x55, 0x55, 0x7F,
+        0xF5, 0x57, 0xFF, 0xFF, 0x5F, 0x55, 0x55, 0x7F, 0xF5, 0xFF, 0xFF, 0xFF, 0x57, 0x55, 0x55,
+    },
+    { // 53: (13, 10)
+        0xAA, 0xAA, 0xAA, 0x55, 0x55, 0x55, 0x6F, 0xF5, 0x56, 0x6F, 0xF5, 0xFF, 0xFF, 0x53, 0x55, 0x55,
+        0x55, 0x7F, 0xF5, 0x57, 0xFF, 0xFF, 0x5F, 0x55, 0x55, 0x5F, 0x5F, 0xFF, 0x7F, 0x55, 0xFF, 0xF5,
+        0xFF, 0x5F, 0xFF, 0xFF, 0xFF, 0x7F, 0x55, 0xD5, 0xFF, 0xFF, 0xF5, 0xF5, 0xFF, 0x57, 0xF5, 0xF5,
+        0xF5, 0xFF, 0xFF, 0x5F, 0x55, 0x55, 0xF5, 0x57, 0x7F, 0xF5, 0xFF, 0xFF, 0x5F, 0x55, 0x55, 0x7F,
+        0xF5, 0x57, 0xFF, 0xFF, 0x5F, 0x55, 0x55, 0x7F, 0xF5, 0xFF, 0xFF, 0xFF, 0x55, 0x55, 0x55,
+    },
+    { // 54: (14, 10)
+        0xFF, 0xFF, 0xFF, 0x55, 0x55, 0x55, 0x7F, 0xF5, 0x57, 0x7F, 0xF5, 0xFF, 0xFF, 0x4F, 0x55, 0x55,
+        0x55, 0x7F, 0xF5, 0x57, 0xFF, 0xFF, 0x5F, 0x55, 0x55, 0x5F, 0x5F, 0xFF, 0x5F, 0x55, 0x7F, 0xF5,
+        0x7F, 0x55, 0xFF, 0xFF, 0xFF, 0x55, 0x55, 0x55, 0xFF, 0x57, 0xF5, 0xF5, 0xFF, 0x55, 0xF5, 0xF5,
+        0xF5, 0xFF, 0xFF, 0x5F, 0x55, 0x55, 0xF5, 0x57, 0x7F, 0xF5, 0xFF, 0xFF, 0x57, 0x55, 0x55, 0x7F,
+        0xF5, 0x57, 0xFF, 0xFF, 0x5F, 0x55, 0x55, 0x7F, 0xF5, 0xFF, 0xFF, 0x7F, 0x55, 0x55, 0x55,
+    },
+    { // 55: (15, 10)
+        0xFF, 0xFF, 0xFF, 0x55, 0x55, 0x55, 0x7F, 0xF5, 0x57, 0x7F, 0xF5, 0xFF, 0xFF, 0x3F, 0x55, 0x55,
+        0x55, 0x7F, 0xF5, 0x57, 0xFF, 0xFF, 0x5F, 0x55, 0x55, 0x5F, 0x5F, 0xFF, 0x57, 0x55, 0x5F, 0xF5,
+        0x55, 0x55, 0xFD, 0xFF, 0x57, 0x55, 0x55, 0x55, 0x5F, 0x55, 0xF5, 0xF5, 0x7F, 0x55, 0xF5, 0xF5,
+        0xF5, 0xFF, 0xFF, 0x5F, 0x55, 0x55, 0xF5, 0x57, 0x7F, 0xF5, 0xFF, 0xFF, 0x55, 0x55, 0x55, 0x7F,
+        0xF5, 0x57, 0xFF, 0xFF, 0x5F, 0x55, 0x55, 0x7F, 0xF5, 0xFF, 0xFF, 0x5F, 0x55, 0x55, 0x55,
+    },
+    { // 56: (16, 10)
+        0xFF, 0xFF, 0xFF, 0xAA, 0x5A, 0x55, 0xBF, 0xF5, 0x5B, 0xBF, 0xF5, 0xFF, 0xFF, 0xFF, 0x54, 0x55,
+        0x55, 0x7F, 0xF5, 0x57, 0xFF, 0xFF, 0x5F, 0x55, 0x55, 0x5F, 0x5F, 0x57, 0x55, 0x55, 0x57, 0x75,
+        0x55, 0x55, 0xF5, 0xFF, 0x55, 0x55, 0x55, 0x55, 0x57, 0x55, 0x75, 0x75, 0x55, 0x55, 0x75, 0x75,
+        0xF5, 0xFF, 0x5F, 0x55, 0x55, 0x55, 0xF5, 0x55, 0x5F, 0xF5, 0xFF, 0x7F, 0x55, 0x55, 0x55, 0x7F,
+        0xF5, 0x57, 0xFF, 0xFF, 0x5F, 0x55, 0x55, 0x7F, 0xF5, 0xFF, 0xFF, 0x57, 0x55, 0x55, 0x55,
+    },
+    { // 57: (17, 10)
+        0xFF, 0xFF, 0xFF, 0xFF, 0x57, 0x55, 0xFF, 0xF5, 0x5F, 0xFF, 0xF5, 0xFF, 0xFF, 0xFF, 0x53, 0x55,
+        0x55, 0x7F, 0xF5, 0x57, 0xFF, 0xFF, 0x5F, 0x55, 0x55, 0x5F, 0x57, 0x57, 0x55, 0x55, 0x57, 0x75,
+        0x55, 0x55, 0xD5, 0x7F, 0x55, 0x55, 0x55, 0x55, 0x57, 0x55, 0x75, 0x75, 0x55, 0x55, 0x75, 0x75,
+        0xF5, 0xFF, 0x57, 0x55, 0x55, 0x55, 0xF5, 0x55, 0x5F, 0xF5, 0xFF, 0x5F, 0x55, 0x55, 0x55, 0x7F,
+        0xF5, 0x57, 0xFF, 0xFF, 0x5F, 0x55, 0x55, 0x5F, 0xF5, 0xFF, 0xFF, 0x55, 0x55, 0x55, 0x55,
+    },
+    { // 58: (18, 10)
+        0xFF, 0xFF, 0xFF, 0xFF, 0x55, 0x55, 0xFF, 0xF5, 0x5F, 0xFF, 0xF5, 0xFF, 0xFF, 0xFF, 0x4F, 0x55,
+        0x55, 0x7F, 0xF5, 0x57, 0xFF, 0xFF, 0x5F, 0x55, 0x55, 0x57, 0x57, 0x57, 0x55, 0x55, 0x57, 0x75,
+        0x55, 0x55, 0x55, 0x5F, 0x55, 0x55, 0x55, 0x55, 0x57, 0x55, 0x75, 0x75, 0x55, 0x55, 0x75, 0x75,
+        0xF5, 0xFF, 0x55, 0x55, 0x55, 0x55, 0xF5, 0x55, 0x5F, 0xF5, 0xFF, 0x57, 0x55, 0x55, 0x55, 0x7F,
+        0xF5, 0x57, 0xFF, 0xFF, 0x57, 0x55, 0x55, 0x5F, 0xF5, 0xFF, 0x7F, 0x55, 0x55, 0x55, 0x55,
+    },
+    { // 59: (19, 10)
+        0xFF, 0xFF, 0xFF, 0x7F, 0x55, 0x55, 0xFF, 0xF5, 0x5F, 0xFF, 0xF5, 0xFF, 0xFF, 0xFF, 0x3F, 0x55,
+        0x55, 0x3F, 0xF5, 0x53, 0xFF, 0xFF, 0x03, 0x50, 0x55, 0x43, 0x43, 0x03, 0x00, 0x40, 0x03, 0x34,
+        0x00, 0x40, 0x55, 0x00, 0x00, 0x00, 0x55, 0x55, 0x00, 0x00, 0x04, 0x04, 0x00, 0x00, 0x04, 0x04,
+        0x04, 0x00, 0x00, 0x00, 0x50, 0x55, 0x05, 0x50, 0x00, 0x05, 0x00, 0x00, 0x40, 0x55, 0x55, 0x40,
+        0x05, 0x54, 0x00, 0x00, 0x54, 0x55, 0x55, 0x50, 0x05, 0x00, 0x40, 0x55, 0x55, 0x55, 0x55,
+    },
+    { // 60: (20, 10)
+        0xFF, 0xFF, 0xFF, 0x5F, 0x55, 0x55, 0xFF, 0xF5, 0x5F, 0xFF, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0x54,
+        0x55, 0xFF, 0xF5, 0x5F, 0xFF, 0xFF, 0xFF, 0x5F, 0x55, 0x7F, 0x7F, 0xFF, 0xFF, 0x7F, 0xFF, 0xF7,
+        0xFF, 0x5F, 0x55, 0xF5, 0xFF, 0x7F, 0x55, 0x55, 0xFD, 0xFF, 0xD5, 0xD5, 0x57, 0x55, 0xD5, 0xD5,
+        0x55, 0x55, 0xFF, 0x5F, 0x55, 0x55, 0x55, 0x57, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+        0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    },
+    { // 61: (21, 10)
+        0xFF, 0xFF, 0xFF, 0x57, 0x55, 0x55, 0xFF, 0xF5, 0x5F, 0xFF, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0x53,
+        0x55, 0xFF, 0xF5, 0x5F, 0xFF, 0xFF, 0xFF, 0x5F, 0x55, 0x7F, 0x7F, 0xFF, 0xFF, 0x7F, 0xFF, 0xD5,
+        0xFF, 0x5F, 0x55, 0xD5, 0xFF, 0x7F, 0x55, 0x55, 0xFD, 0xFF, 0xD5, 0xD5, 0x55, 0x55, 0xD5, 0xD5,
+        0x55, 0x55, 0xFD, 0x5F, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+        0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    },
+    { // 62: (22, 10)
+        0xFF, 0xFF, 0xFF, 0xAA, 0xAA, 0x6A, 0xFF, 0xF6, 0x6F, 0xFF, 0xF6, 0xFF, 0xFF, 0xFF, 0xFF, 0x4F,
+        0x55, 0xFF, 0xF4, 0x4F, 0xFF, 0xFF, 0xFF, 0x0F, 0x00, 0x3F, 0x3F, 0xFF, 0xFF, 0x0F, 0xFC, 0xC0,
+        0xFF, 0x0F, 0x00, 0x00, 0xFF, 0x3F, 0x00, 0x00, 0xFC, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    },
+    { // 63: (23, 10)
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5F, 0xFF, 0xF7, 0x7F, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F,
+        0x55, 0xFF, 0xF7, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0x5F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    },
+    { // 64: (24, 10)
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x57, 0xFF, 0xF7, 0x7F, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0x54, 0xFF, 0xF7, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0x57, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    },
+    { // 65: (25, 10)
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x55, 0xFF, 0xF7, 0x7F, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0x53, 0xFF, 0xF7, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0x55, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    },
+    { // 66: (26, 10)
+        0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0x55, 0xFF, 0xF7, 0x7F, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0x4F, 0xFF, 0xF7, 0x7F, 0xFF, 0xFF, 0xFF, 0x7F, 0x55, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    },
+    { // 67: (27, 10)
+        0xFF, 0xFF, 0xFF, 0xAA, 0xAA, 0xAA, 0xFF, 0xFB, 0xBF, 0xFF, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0x3F, 0xFF, 0xF3, 0x3F, 0xFF, 0xFF, 0xFF, 0x0F, 0x00, 0x3F, 0x3F, 0xFF, 0xFF, 0x0F, 0xFC, 0xC0,
+        0xFF, 0x0F, 0x00, 0x00, 0xFF, 0x3F, 0x00, 0x00, 0xFC, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    },
+    { // 68: (2, 11)
+        0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+        0xAA, 0xA8, 0x0A, 0xAA, 0x00, 0xA0, 0xAA, 0xAA, 0xAA, 0xA8, 0xA8, 0x80, 0xAA, 0x2A, 0xA0, 0x02,
+        0xAA, 0x2A, 0x00, 0x00, 0xA8, 0x2A, 0x00, 0x00, 0xA0, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    },
+    { // 69: (7, 11)
+        0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+        0xAA, 0xA2, 0x0A, 0xAA, 0x00, 0xA0, 0xAA, 0xAA, 0xAA, 0xA8, 0xA8, 0x80, 0xAA, 0x2A, 0xA0, 0x02,
+        0xAA, 0x2A, 0x00, 0x00, 0xA8, 0x2A, 0x00, 0x00, 0xA0, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    },
+    { // 70: (10, 11)
+        0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+        0xAA, 0x8A, 0xAA, 0xA8, 0xAA, 0x0A, 0x00, 0xAA, 0xAA, 0x82, 0x82, 0x02, 0x00, 0x80, 0x02, 0x28,
+        0x00, 0x00, 0xAA, 0x2A, 0x00, 0x00, 0x00, 0xA8, 0x02, 0x00, 0x20, 0x20, 0x00, 0x00, 0x20, 0x20,
+        0xA0, 0xAA, 0x02, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x0A, 0xA0, 0xAA, 0x0A, 0x00, 0x00, 0x00, 0x2A,
+        0xA0, 0x02, 0xAA, 0xAA, 0x0A, 0x00, 0x00, 0xAA, 0xA0, 0xAA, 0xAA, 0xAA, 0x0A, 0x00, 0x00,
+    },
+    { // 71: (19, 11)
+        0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+        0xAA, 0x2A, 0xAA, 0xA2, 0xAA, 0xAA, 0x00, 0xA0, 0xAA, 0x82, 0x82, 0x02, 0x00, 0x80, 0x02, 0x08,
+        0x00, 0x80, 0x2A, 0x00, 0x00, 0x00, 0xA8, 0xAA, 0x00, 0x00, 0x08, 0x08, 0x00, 0x00, 0x08, 0x08,
+        0x08, 0x00, 0x00, 0x00, 0x80, 0xAA, 0x0A, 0xA0, 0x00, 0x0A, 0x00, 0x00, 0x00, 0xAA, 0xAA, 0x80,
+        0x0A, 0xA8, 0x00, 0x00, 0xA0, 0xAA, 0xAA, 0xA0, 0x0A, 0x00, 0x00, 0xAA, 0xAA, 0xAA, 0xAA,
+    },
+    { // 72: (22, 11)
+        0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+        0xAA, 0xAA, 0xA8, 0x0A, 0xAA, 0xAA, 0xAA, 0x0A, 0x00, 0x2A, 0x2A, 0xA8, 0xAA, 0x02, 0xA8, 0x80,
+        0xAA, 0x0A, 0x00, 0x00, 0xA8, 0x2A, 0x00, 0x00, 0xA0, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    },
+    { // 73: (27, 11)
+        0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+        0xAA, 0xAA, 0xA2, 0x0A, 0xAA, 0xAA, 0xAA, 0x0A, 0x00, 0x2A, 0x2A, 0xA8, 0xAA, 0x02, 0xA8, 0x80,
+        0xAA, 0x0A, 0x00, 0x00, 0xA8, 0x2A, 0x00, 0x00, 0xA0, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    },
+    { // 74: (2, 12)
+        0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+        0xAA, 0xA2, 0x0A, 0xAA, 0x00, 0xA0, 0xAA, 0xAA, 0xAA, 0xA8, 0x28, 0x00, 0xAA, 0x2A, 0xA0, 0x02,
+        0xAA, 0x0A, 0x00, 0x00, 0xA8, 0x2A, 0x00, 0x00, 0xA0, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    },
+    { // 75: (7, 12)
+        0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+        0xAA, 0xA8, 0x0A, 0xAA, 0x00, 0xA0, 0xAA, 0xAA, 0xAA, 0xA8, 0x28, 0x00, 0xAA, 0x2A, 0xA0, 0x02,
+        0xAA, 0x0A, 0x00, 0x00, 0xA8, 0x2A, 0x00, 0x00, 0xA0, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    },
+    { // 76: (10, 12)
+        0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+        0xAA, 0xAA, 0xAA, 0xA8, 0xAA, 0x0A, 0x00, 0xA8, 0xAA, 0x82, 0x82, 0x02, 0x00, 0x80, 0x02, 0x20,
+        0x00, 0x00, 0xAA, 0x0A, 0x00, 0x00, 0x00, 0xA0, 0x02, 0x00, 0x20, 0x20, 0x00, 0x00, 0x20, 0x20,
+        0xA0, 0xAA, 0x00, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x0A, 0xA0, 0xAA, 0x02, 0x00, 0x00, 0x00, 0x2A,
+        0xA0, 0x02, 0xAA, 0xAA, 0x0A, 0x00, 0x00, 0x2A, 0xA0, 0xAA, 0xAA, 0xAA, 0x02, 0x00, 0x00,
+    },
+    { // 77: (19, 12)
+        0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+        0xAA, 0xAA, 0xAA, 0xA2, 0xAA, 0x2A, 0x00, 0xA0, 0xAA, 0x82, 0x82, 0x02, 0x00, 0x80, 0x00, 0x08,
+        0x00, 0x80, 0x0A, 0x00, 0x00, 0x00, 0xA0, 0xAA, 0x00, 0x00, 0x08, 0x08, 0x00, 0x00, 0x08, 0x08,
+        0x08, 0x00, 0x00, 0x00, 0x00, 0xAA, 0x0A, 0xA0, 0x00, 0x0A, 0x00, 0x00, 0x00, 0xA8, 0xAA, 0x80,
+        0x0A, 0xA8, 0x00, 0x00, 0xA0, 0xAA, 0xAA, 0x80, 0x0A, 0x00, 0x00, 0xA8, 0xAA, 0xAA, 0xAA,
+    },
+    { // 78: (22, 12)
+        0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+        0xAA, 0xAA, 0xA2, 0x0A, 0xAA, 0xAA, 0xAA, 0x0A, 0x00, 0x2A, 0x28, 0xA8, 0xAA, 0x00, 0xA8, 0x00,
+        0xAA, 0x0A, 0x00, 0x00, 0xA8, 0x2A, 0x00, 0x00, 0xA0, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    },
+    { // 79: (27, 12)
+        0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+        0xAA, 0xAA, 0xA8, 0x0A, 0xAA, 0xAA, 0xAA, 0x0A, 0x00, 0x2A, 0x28, 0xA8, 0xAA, 0x00, 0xA8, 0x00,
+        0xAA, 0x0A, 0x00, 0x00, 0xA8, 0x2A, 0x00, 0x00, 0xA0, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    },
+    { // 80: (2, 13)
+        0xAA, 0x56, 0x55, 0x55, 0x55, 0x55, 0x56, 0x65, 0x55, 0x56, 0xA5, 0x6A, 0x55, 0x55, 0x55, 0x55,
+        0x55, 0x56, 0x65, 0x55, 0x54, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+        0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+        0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+        0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    },
+    { // 81: (3, 13)
+        0xFF, 0x55, 0x55, 0x55, 0x55, 0x55, 0x57, 0x75, 0x55, 0x57, 0xF5, 0x5F, 0x55, 0x55, 0x55, 0x55,
+        0x55, 0x57, 0x75, 0x55, 0x53, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+        0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+        0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+        0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    },
+    { // 82: (4, 13)
+        0x7F, 0x55, 0x55, 0x55, 0x55, 0x55, 0x57, 0x75, 0x55, 0x57, 0xF5, 0x57, 0x55, 0x55, 0x55, 0x55,
+        0x55, 0x57, 0x75, 0x55, 0x4F, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+        0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+        0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+        0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    },
+    { // 83: (5, 13)
+        0x5F, 0x55, 0x55, 0x55, 0x55, 0x55, 0x57, 0x75, 0x55, 0x57, 0xF5, 0x55, 0x55, 0x55, 0x55, 0x55,
+        0x55, 0x57, 0x75, 0x55, 0x3F, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+        0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+        0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+        0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    },
+    { // 84: (6, 13)
+        0x57, 0x55, 0x55, 0x55, 0x55, 0x55, 0x57, 0x75, 0x55, 0x57, 0x75, 0x55, 0x55, 0x55, 0x55, 0x55,
+        0x55, 0x57, 0x75, 0x55, 0xFF, 0x54, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+        0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+        0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+        0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    },
+    { // 85: (7, 13)
+        0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+        0xAA, 0xAB, 0xBA, 0xAA, 0xFF, 0xA3, 0x8A, 0xAA, 0xAA, 0x08, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    },
+    { // 86: (10, 13)
+        0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+        0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x4A, 0x55, 0xA5, 0xAA, 0x96, 0x96, 0x56, 0x55, 0x55, 0x56, 0x65,
+        0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+        0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+        0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    },
+    { // 87: (11, 13)
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0x3F, 0x55, 0xF5, 0xFF, 0xD7, 0x57, 0x57, 0x55, 0x55, 0x57, 0x55,
+        0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+        0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+        0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    },
+    { // 88: (12, 13)
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0x7F, 0xFF, 0xF7, 0xFF, 0xFF, 0x54, 0xF5, 0xFF, 0x57, 0x57, 0x57, 0x55, 0x55, 0x55, 0x55,
+        0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+        0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+        0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    },
+    { // 89: (13, 13)
+        0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0x00, 0xFF, 0xF0, 0x0F, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0x3F, 0x00,
+        0x00, 0x3F, 0xF0, 0x03, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    },
+    { // 90: (16, 13)
+        0x00, 0x50, 0x55, 0x55, 0x55, 0x55, 0x50, 0x05, 0x55, 0x50, 0x05, 0x00, 0x40, 0x55, 0x55, 0x55,
+        0x55, 0x40, 0x05, 0x54, 0x00, 0x00, 0x40, 0x55, 0x55, 0x40, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    },
+    { // 91: (17, 13)
+        0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+        0x55, 0x55, 0x55, 0x57, 0x55, 0xF5, 0x3F, 0x55, 0x55, 0x7D, 0x7F, 0xFF, 0xFF, 0x7F, 0xFF, 0xF7,
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    },
+    { // 92: (18, 13)
+        0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+        0x55, 0x55, 0x55, 0x55, 0x55, 0xF5, 0xFF, 0x54, 0x55, 0x7D, 0x7D, 0xFF, 0xFF, 0x7F, 0xFF, 0xF7,
+        0xFF, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    },
+    { // 93: (19, 13)
+        0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+        0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xEA, 0xFF, 0xA3, 0xAA, 0xBE, 0xBE, 0xFE, 0xFF, 0xBF, 0xFF, 0xFB,
+        0xFF, 0xBF, 0xFA, 0xFF, 0xFF, 0xFF, 0xAF, 0xAA, 0xFF, 0xFF, 0xFB, 0xFB, 0xFF, 0xFF, 0xFB, 0xFB,
+        0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xAA, 0xFA, 0xAF, 0xFF, 0xFA, 0xFF, 0xFF, 0xFF, 0xAB, 0xAA, 0xBF,
+        0xFA, 0xAB, 0xFF, 0xFF, 0xAF, 0xAA, 0xAA, 0xBF, 0xFA, 0xFF, 0xFF, 0xAB, 0xAA, 0xAA, 0xAA,
+    },
+    { // 94: (22, 13)
+        0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x6A, 0xAA, 0xA6, 0x6A, 0xAA, 0xA6, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+        0x6A, 0xAA, 0xA6, 0x6A, 0xAA, 0xAA, 0xA2, 0x4A, 0x55, 0x20, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    },
+    { // 95: (23, 13)
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5F, 0xFF, 0xF7, 0x7F, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0x5F, 0xFF, 0xF7, 0x7F, 0xFF, 0xFF, 0xFF, 0x3F, 0x55, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    },
+    { // 96: (24, 13)
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x57, 0xFF, 0xF7, 0x7F, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0x57, 0xFF, 0xF7, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0x54, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    },
+    { // 97: (25, 13)
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x55, 0xFF, 0xF7, 0x7F, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0x55, 0xFF, 0xF7, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0x53, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    },
+    { // 98: (26, 13)
+        0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0x55, 0xFF, 0xF7, 0x7F, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F,
+        0x55, 0xFF, 0xF7, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0x4F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    },
+    { // 99: (27, 13)
+        0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+        0xAA, 0xAA, 0xAB, 0xBA, 0xAA, 0xAA, 0xAA, 0xFA, 0x3F, 0xEA, 0xEB, 0xAB, 0xAA, 0xFF, 0xAB, 0xFF,
+        0xAA, 0xFA, 0xFF, 0xFF, 0xAB, 0xEA, 0xFF, 0xFF, 0xAF, 0xAA, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    },
+    { // 100: (7, 14)
+        0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+        0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x0A, 0x0A, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    },
+    { // 101: (13, 14)
+        0xAA, 0xAA, 0xAA, 0xAA, 0x02, 0x00, 0xAA, 0xA0, 0x0A, 0xAA, 0xA0, 0xAA, 0xAA, 0xAA, 0x0A, 0x00,
+        0x00, 0x2A, 0xA0, 0x02, 0xAA, 0xAA, 0x0A, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    },
+    { // 102: (16, 14)
+        0x00, 0x80, 0xAA, 0xAA, 0xAA, 0xAA, 0xA0, 0x0A, 0xAA, 0xA0, 0x0A, 0x00, 0x00, 0xAA, 0xAA, 0xAA,
+        0xAA, 0x80, 0x0A, 0xA8, 0x00, 0x00, 0xA0, 0xAA, 0xAA, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    },
+    { // 103: (22, 14)
+        0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+        0xAA, 0xAA, 0xAA, 0xAA, 0x00, 0xA0, 0xA0, 0xAA, 0xAA, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    },
+    { // 104: (7, 15)
+        0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+        0xAA, 0xAA, 0xAA, 0x0A, 0xAA, 0xAA, 0x0A, 0x08, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    },
+    { // 105: (13, 15)
+        0xAA, 0xAA, 0xAA, 0xAA, 0x00, 0x00, 0xAA, 0xA0, 0x0A, 0xAA, 0xA0, 0xAA, 0xAA, 0xAA, 0x02, 0x00,
+        0x00, 0x2A, 0xA0, 0x02, 0xAA, 0xAA, 0x0A, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    },
+    { // 106: (16, 15)
+        0x00, 0x00, 0xAA, 0xAA, 0xAA, 0xAA, 0xA0, 0x0A, 0xAA, 0xA0, 0x0A, 0x00, 0x00, 0xA8, 0xAA, 0xAA,
+        0xAA, 0x80, 0x0A, 0xA8, 0x00, 0x00, 0xA0, 0xAA, 0xAA, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    },
+    { // 107: (22, 15)
+        0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+        0xAA, 0xAA, 0x0A, 0xAA, 0x00, 0x20, 0xA0, 0xAA, 0xAA, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    },
+    { // 108: (7, 16)
+        0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+        0xAA, 0xAA, 0xA0, 0x0A, 0xAA, 0xAA, 0x02, 0x00, 0x00, 0x02, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    },
+    { // 109: (10, 16)
+        0x00, 0x00, 0x54, 0x55, 0x55, 0x55, 0x50, 0x05, 0x55, 0x50, 0x05, 0x00, 0x55, 0x55, 0x55, 0x55,
+        0x55, 0x50, 0x05, 0x55, 0x00, 0x50, 0x55, 0x55, 0x55, 0x54, 0x54, 0x50, 0x55, 0x55, 0x50, 0x05,
+        0x55, 0x55, 0x00, 0x00, 0x54, 0x55, 0x15, 0x00, 0x50, 0x55, 0x05, 0x05, 0x00, 0x00, 0x04, 0x04,
+        0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    },
+    { // 110: (11, 16)
+        0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+        0x55, 0x55, 0xF5, 0x55, 0xFF, 0x5F, 0x55, 0x55, 0x55, 0x57, 0x57, 0x4F, 0x55, 0x55, 0x5F, 0xF5,
+        0x55, 0x55, 0xFF, 0xFF, 0x57, 0x55, 0x55, 0xFD, 0x5F, 0x55, 0xF5, 0xF5, 0xFF, 0x7F, 0xF5, 0xF5,
+        0xF5, 0xFF, 0xFF, 0x5F, 0x55, 0x55, 0xF5, 0x57, 0xFF, 0xF5, 0xFF, 0xFF, 0xFF, 0x7F, 0x55, 0xFF,
+        0xF5, 0x5F, 0xFF, 0xFF, 0xFF, 0x5F, 0x55, 0xFF, 0xF5, 0xFF, 0xFF, 0xFF, 0x5F, 0x55, 0x55,
+    },
+    { // 111: (12, 16)
+        0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+        0x55, 0x55, 0x55, 0x55, 0xFF, 0x5F, 0x55, 0x55, 0x55, 0x57, 0x57, 0x3F, 0x55, 0x55, 0x5F, 0xF5,
+        0x55, 0x55, 0xFF, 0xFF, 0x57, 0x55, 0x55, 0xF5, 0x5F, 0x55, 0xF5, 0xF5, 0xFF, 0x5F, 0xF5, 0xF5,
+        0xF5, 0xFF, 0xFF, 0x5F, 0x55, 0x55, 0xF5, 0x57, 0x7F, 0xF5, 0xFF, 0xFF, 0xFF, 0x5F, 0x55, 0xFF,
+        0xF5, 0x5F, 0xFF, 0xFF, 0xFF, 0x5F, 0x55, 0xFF, 0xF5, 0xFF, 0xFF, 0xFF, 0x57, 0x55, 0x55,
+    },
+    { // 112: (13, 16)
+        0xAA, 0xAA, 0xAA, 0x55, 0x55, 0x55, 0x6A, 0xA5, 0x56, 0x6A, 0xA5, 0xAA, 0xAA, 0xAA, 0x55, 0x55,
+        0x55, 0x6A, 0xA5, 0x56, 0xAA, 0xAA, 0x5A, 0x55, 0x55, 0x5B, 0x5B, 0xFF, 0x54, 0x55, 0x5F, 0xF5,
+        0x55, 0x55, 0xFF, 0xFF, 0x57, 0x55, 0x55, 0xD5, 0x5F, 0x55, 0xF5, 0xF5, 0xFF, 0x57, 0xF5, 0xF5,
+        0xF5, 0xFF, 0xFF, 0x5F, 0x55, 0x55, 0xF5, 0x57, 0x7F, 0xF5, 0xFF, 0xFF, 0x5F, 0x55, 0x55, 0x7F,
+        0xF5, 0x57, 0xFF, 0xFF, 0x5F, 0x55, 0x55, 0x7F, 0xF5, 0xFF, 0xFF, 0xFF, 0x55, 0x55, 0x55,
+    },
+    { // 113: (14, 16)
+        0xFF, 0xFF, 0xFF, 0x55, 0x55, 0x55, 0x7F, 0xF5, 0x57, 0x7F, 0xF5, 0xFF, 0xFF, 0x7F, 0x55, 0x55,
+        0x55, 0x7F, 0xF5, 0x57, 0xFF, 0xFF, 0x5F, 0x55, 0x55, 0x5F, 0x5F, 0xFF, 0x53, 0x55, 0x0F, 0xF5,
+        0x00, 0x50, 0xFF, 0xFF, 0x03, 0x40, 0x55, 0x55, 0x0F, 0x00, 0xF5, 0xF5, 0xFF, 0x55, 0xF5, 0xF5,
+        0xF5, 0xFF, 0xFF, 0x5F, 0x55, 0x55, 0xF5, 0x57, 0x7F, 0xF5, 0xFF, 0xFF, 0x57, 0x55, 0x55, 0x7F,
+        0xF5, 0x57, 0xFF, 0xFF, 0x5F, 0x55, 0x55, 0x7F, 0xF5, 0xFF, 0xFF, 0x7F, 0x55, 0x55, 0x55,
+    },
+    { // 114: (15, 16)
+        0xFF, 0xFF, 0xFF, 0x55, 0x55, 0x55, 0x7F, 0xF5, 0x57, 0x7F, 0xF5, 0xFF, 0xFF, 0x5F, 0x55, 0x55,
+        0x55, 0x7F, 0xF5, 0x57, 0xFF, 0xFF, 0x5F, 0x55, 0x55, 0x5F, 0x5F, 0xFF, 0x4F, 0x55, 0x0F, 0xF5,
+        0x00, 0x50, 0xFD, 0xFF, 0x03, 0x40, 0x55, 0x55, 0x0F, 0x00, 0xF5, 0xF5, 0x7F, 0x55, 0xF5, 0xF5,
+        0xF5, 0xFF, 0xFF, 0x5F, 0x55, 0x55, 0xF5, 0x57, 0x7F, 0xF5, 0xFF, 0xFF, 0x55, 0x55, 0x55, 0x7F,
+        0xF5, 0x57, 0xFF, 0xFF, 0x5F, 0x55, 0x55, 0x7F, 0xF5, 0xFF, 0xFF, 0x5F, 0x55, 0x55, 0x55,
+    },
+    { // 115: (16, 16)
+        0xFF, 0xFF, 0xAA, 0xAA, 0xAA, 0xAA, 0xAF, 0xFA, 0xAA, 0xAF, 0xFA, 0xFF, 0xFF, 0xAB, 0xAA, 0xAA,
+        0xAA, 0xBF, 0xFA, 0xAB, 0xFF, 0xFF, 0xAF, 0x5A, 0x55, 0x6F, 0x6F, 0xFF, 0x3F, 0x55, 0xFF, 0xF5,
+        0xFF, 0x5F, 0xF5, 0xFF, 0xFF, 0x7F, 0x55, 0x55, 0xFF, 0xFF, 0xF5, 0xF5, 0x5F, 0x55, 0xF5, 0xF5,
+        0xF5, 0xFF, 0xFF, 0x5F, 0x55, 0x55, 0xF5, 0x57, 0x7F, 0xF5, 0xFF, 0x55, 0x55, 0x55, 0x55, 0x5F,
+        0xF5, 0x55, 0xFF, 0x5F, 0x55, 0x55, 0x55, 0x5F, 0xF5, 0xFF, 0xFF, 0x57, 0x55, 0x55, 0x55,
+    },
+    { // 116: (17, 16)
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0xFF, 0xFF, 0x5F, 0xFF, 0xFF, 0xFF, 0x5F, 0x55, 0x7F, 0x7F, 0xFF, 0xFF, 0x54, 0xFF, 0xF5,
+        0xFF, 0x5F, 0xD5, 0xFF, 0xFF, 0x7F, 0x55, 0x55, 0xFF, 0xFF, 0xF5, 0xF5, 0x57, 0x55, 0xF5, 0xF5,
+        0xF5, 0xFF, 0xFF, 0x5F, 0x55, 0x55, 0xF5, 0x57, 0x5F, 0xF5, 0x7F, 0x55, 0x55, 0x55, 0x55, 0x5F,
+        0xF5, 0x55, 0xFF, 0x5F, 0x55, 0x55, 0x55, 0x5F, 0xF5, 0xFF, 0xFF, 0x55, 0x55, 0x55, 0x55,
+    },
+    { // 117: (18, 16)
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0xFF, 0xF5, 0x5F, 0xFF, 0xFF, 0xFF, 0x5F, 0x55, 0x7F, 0x7F, 0xFF, 0xFF, 0x53, 0xFF, 0xF5,
+        0xFF, 0x5F, 0x55, 0xFF, 0xFF, 0x7F, 0x55, 0x55, 0xFF, 0xFF, 0xF5, 0xF5, 0x55, 0x55, 0xF5, 0xF5,
+        0xF5, 0xFF, 0xFF, 0x5F, 0x55, 0x55, 0xF5, 0x55, 0x5F, 0xF5, 0x5F, 0x55, 0x55, 0x55, 0x55, 0x5F,
+        0xF5, 0x55, 0xFF, 0x5F, 0x55, 0x55, 0x55, 0x5F, 0xF5, 0xFF, 0x7F, 0x55, 0x55, 0x55, 0x55,
+    },
+    { // 118: (19, 16)
+        0xFF, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0xFF, 0xF0, 0x0F, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F,
+        0x00, 0xFF, 0xF0, 0x0F, 0xFF, 0xFF, 0xFF, 0x0F, 0x00, 0x3F, 0x3F, 0xFF, 0xFF, 0x0F, 0xFF, 0xF0,
+        0xFF, 0x0F, 0x00, 0xFC, 0xFF, 0x3F, 0x00, 0x00, 0xFF, 0xFF, 0xF0, 0x30, 0x00, 0x00, 0x30, 0x30,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    },
+    { // 119: (22, 16)
+        0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+        0xAA, 0xA0, 0x0A, 0xAA, 0x00, 0x00, 0x80, 0xAA, 0xAA, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    },
+    { // 120: (7, 17)
+        0xAA, 0xAA, 0xAA, 0xAA, 0x0A, 0x00, 0xAA, 0xA0, 0x0A, 0xAA, 0xA0, 0xAA, 0xAA, 0xAA, 0xAA, 0x0A,
+        0x00, 0xAA, 0xA0, 0x02, 0xAA, 0xAA, 0x00, 0x00, 0x00, 0x02, 0x02, 0x02, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    },
+    { // 121: (10, 17)
+        0x00, 0x00, 0xA0, 0xAA, 0xAA, 0xAA, 0xA0, 0x0A, 0xAA, 0xA0, 0x0A, 0x00, 0xA8, 0xAA, 0xAA, 0xAA,
+        0xAA, 0xA0, 0x0A, 0xAA, 0x00, 0xA0, 0xAA, 0x0A, 0x00, 0x28, 0x28, 0xA8, 0xAA, 0x2A, 0xA0, 0x02,
+        0xAA, 0x2A, 0x00, 0x00, 0xA8, 0xAA, 0x0A, 0x00, 0xA0, 0xAA, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    },
+    { // 122: (14, 17)
+        0xAA, 0xAA, 0xAA, 0x55, 0x55, 0x55, 0x6A, 0xA5, 0x56, 0x6A, 0xA5, 0xAA, 0xAA, 0x6A, 0x55, 0x55,
+        0x55, 0x6A, 0xA5, 0x56, 0xAA, 0xAA, 0x5A, 0x55, 0x55, 0x5A, 0x5A, 0xAA, 0x5A, 0x55, 0x4A, 0xA5,
+        0x00, 0x50, 0xAA, 0xAA, 0x02, 0x40, 0x55, 0x55, 0x0A, 0x00, 0xA5, 0xA5, 0xAA, 0x55, 0xA5, 0xA5,
+        0xA5, 0xAA, 0xAA, 0x5A, 0x55, 0x55, 0xA5, 0x56, 0x6A, 0xA5, 0xAA, 0xAA, 0x56, 0x55, 0x55, 0x6A,
+        0xA5, 0x56, 0xAA, 0xAA, 0x5A, 0x55, 0x55, 0x6A, 0xA5, 0xAA, 0xAA, 0x6A, 0x55, 0x55, 0x55,
+    },
+    { // 123: (15, 17)
+        0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+        0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x3A, 0xAA,
+        0x00, 0xA0, 0xAA, 0xAA, 0x02, 0x80, 0xAA, 0xAA, 0x0A, 0x00, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+        0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+        0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    },
+    { // 124: (19, 17)
+        0xAA, 0xAA, 0xAA, 0x0A, 0x00, 0x00, 0xAA, 0xA0, 0x0A, 0xAA, 0xA0, 0xAA, 0xAA, 0xAA, 0xAA, 0x02,
+        0x00, 0xAA, 0xA0, 0x0A, 0x00, 0xA0, 0xAA, 0x0A, 0x00, 0x28, 0x28, 0xA8, 0xAA, 0x2A, 0xA8, 0x80,
+        0xAA, 0x0A, 0x00, 0xA0, 0xAA, 0x2A, 0x00, 0x00, 0xA8, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    },
+    { // 125: (22, 17)
+        0x00, 0xA0, 0xAA, 0xAA, 0xAA, 0xAA, 0xA0, 0x0A, 0xAA, 0xA0, 0x0A, 0x00, 0xAA, 0xAA, 0xAA, 0xAA,
+        0xAA, 0xA0, 0x0A, 0xA8, 0x00, 0x00, 0x00, 0xAA, 0xAA, 0x80, 0x80, 0x00, 0x00, 0x80, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    },
+    { // 126: (7, 18)
+        0xAA, 0xAA, 0xAA, 0xAA, 0x02, 0x00, 0xAA, 0xA0, 0x0A, 0xAA, 0xA0, 0xAA, 0xAA, 0xAA, 0xAA, 0x02,
+        0x00, 0x2A, 0xA0, 0x02, 0xAA, 0x2A, 0x00, 0x00, 0x00, 0x02, 0x02, 0x02, 0x00, 0x00, 0x02, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    },
+    { // 127: (10, 18)
+        0x00, 0x00, 0x80, 0xAA, 0xAA, 0xAA, 0xA0, 0x0A, 0xAA, 0xA0, 0x0A, 0x00, 0xA0, 0xAA, 0xAA, 0xAA,
+        0xAA, 0xA0, 0x0A, 0x0A, 0x00, 0xA0, 0xAA, 0x0A, 0x00, 0x28, 0x28, 0xA8, 0xAA, 0x2A, 0xA8, 0x02,
+        0xAA, 0x2A, 0x00, 0x00, 0xA8, 0xAA, 0x02, 0x00, 0xA0, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    },
+    { // 128: (12, 18)
+        0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+        0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+        0x54, 0x55, 0x55, 0x55, 0x01, 0x40, 0x55, 0x55, 0x05, 0x00, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+        0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+        0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    },
+    { // 129: (13, 18)
+        0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+        0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+        0x53, 0x55, 0x55, 0x55, 0x01, 0x40, 0x55, 0x55, 0x05, 0x00, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+        0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+        0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    },
+    { // 130: (14, 18)
+        0xAA, 0xAA, 0xAA, 0x55, 0x55, 0x55, 0x6A, 0xA5, 0x56, 0x6A, 0xA5, 0xAA, 0xAA, 0x6A, 0x55, 0x55,
+        0x55, 0x6A, 0xA5, 0x56, 0xAA, 0xAA, 0x5A, 0x55, 0x55, 0x5A, 0x5A, 0xAA, 0x5A, 0x55, 0x6A, 0xA5,
+        0x4F, 0x55, 0xAA, 0xAA, 0x02, 0x40, 0x55, 0x55, 0x0A, 0x00, 0xA5, 0xA5, 0xAA, 0x55, 0xA5, 0xA5,
+        0xA5, 0xAA, 0xAA, 0x5A, 0x55, 0x55, 0xA5, 0x56, 0x6A, 0xA5, 0xAA, 0xAA, 0x56, 0x55, 0x55, 0x6A,
+        0xA5, 0x56, 0xAA, 0xAA, 0x5A, 0x55, 0x55, 0x6A, 0xA5, 0xAA, 0xAA, 0x6A, 0x55, 0x55, 0x55,
+    },
+    { // 131: (15, 18)
+        0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+        0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+        0x3F, 0xA5, 0xAA, 0xAA, 0x02, 0x80, 0xAA, 0xAA, 0x0A, 0x00, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+        0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+        0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    },
+    { // 132: (16, 18)
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0xF4, 0xFF, 0xFF, 0x03, 0xC0, 0xFF, 0xFF, 0x0F, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    },
+    { // 133: (17, 18)
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0xF3, 0xFF, 0xFF, 0x03, 0xC0, 0xFF, 0xFF, 0x0F, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    },
+    { // 134: (19, 18)
+        0xAA, 0xAA, 0xAA, 0x02, 0x00, 0x00, 0xAA, 0xA0, 0x0A, 0xAA, 0xA0, 0xAA, 0xAA, 0xAA, 0xAA, 0x00,
+        0x00, 0xAA, 0x00, 0x0A, 0x00, 0xA0, 0xAA, 0x0A, 0x00, 0x28, 0x28, 0xA8, 0xAA, 0x2A, 0xA8, 0x82,
+        0xAA, 0x0A, 0x00, 0x80, 0xAA, 0x2A, 0x00, 0x00, 0xA0, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    },
+    { // 135: (22, 18)
+        0x00, 0x80, 0xAA, 0xAA, 0xAA, 0xAA, 0xA0, 0x0A, 0xAA, 0xA0, 0x0A, 0x00, 0xA8, 0xAA, 0xAA, 0xAA,
+        0xAA, 0x80, 0x0A, 0xA8, 0x00, 0x00, 0x00, 0xA8, 0xAA, 0x80, 0x80, 0x00, 0x00, 0x80, 0x00, 0x08,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    },
+    { // 136: (2, 19)
+        0x55, 0x55, 0x55, 0xFF, 0xFF, 0xFF, 0xD5, 0x5F, 0xFD, 0xD5, 0x5F, 0x55, 0x55, 0x55, 0xFF, 0xFF,
+        0xFF, 0xD5, 0x5F, 0xFD, 0x55, 0x55, 0xF5, 0xFF, 0xFF, 0xF5, 0xF5, 0x55, 0xD5, 0xFF, 0x55, 0x5F,
+        0x55, 0xF5, 0x54, 0x55, 0x55, 0xD5, 0xFF, 0xFF, 0x55, 0x55, 0x5F, 0x5F, 0x55, 0xFD, 0x5F, 0x5F,
+        0x5F, 0x55, 0x55, 0xF5, 0xFF, 0xFF, 0x5F, 0xFD, 0xD5, 0x5F, 0x55, 0x55, 0xF5, 0xFF, 0xFF, 0xD5,
+        0x5F, 0xFD, 0x55, 0x55, 0xF5, 0xFF, 0xFF, 0xD5, 0x5F, 0x55, 0x55, 0x55, 0xFF, 0xFF, 0xFF,
+    },
+    { // 137: (3, 19)
+        0x55, 0x55, 0x55, 0xFD, 0xFF, 0xFF, 0x55, 0x5F, 0xF5, 0x55, 0x5F, 0x55, 0x55, 0x55, 0xFD, 0xFF,
+        0xFF, 0xD5, 0x5F, 0xFD, 0x55, 0x55, 0x55, 0xF5, 0xFF, 0xD5, 0xD5, 0x55, 0x55, 0xFF, 0x55, 0x5F,
+        0x55, 0xF5, 0x53, 0x55, 0x55, 0xD5, 0xFF, 0xFF, 0x55, 0x55, 0x5F, 0x5F, 0x55, 0xF5, 0x5F, 0x5F,
+        0x5F, 0x55, 0x55, 0xF5, 0xFF, 0xFF, 0x5F, 0xFD, 0xD5, 0x5F, 0x55, 0x55, 0xD5, 0xFF, 0xFF, 0xD5,
+        0x5F, 0xFD, 0x55, 0x55, 0xF5, 0xFF, 0xFF, 0xD5, 0x5F, 0x55, 0x55, 0x55, 0xFD, 0xFF, 0xFF,
+    },
+    { // 138: (4, 19)
+        0x55, 0x55, 0x55, 0xF5, 0xFF, 0xFF, 0x55, 0x5F, 0xF5, 0x55, 0x5F, 0x55, 0x55, 0x55, 0xF5, 0xFF,
+        0xFF, 0xD5, 0x5F, 0xF5, 0x55, 0x55, 0x55, 0xF5, 0xFF, 0xD5, 0xD5, 0x55, 0x55, 0xFD, 0x55, 0x5F,
+        0x55, 0xF5, 0x4F, 0x55, 0x55, 0xD5, 0xFF, 0xFF, 0x55, 0x55, 0x5F, 0x5F, 0x55, 0xD5, 0x5F, 0x5F,
+        0x5F, 0x55, 0x55, 0xF5, 0xFF, 0xFF, 0x5F, 0xFD, 0x55, 0x5F, 0x55, 0x55, 0x55, 0xFF, 0xFF, 0xD5,
+        0x5F, 0xFD, 0x55, 0x55, 0xF5, 0xFF, 0xFF, 0x55, 0x5F, 0x55, 0x55, 0x55, 0xF5, 0xFF, 0xFF,
+    },
+    { // 139: (5, 19)
+        0x55, 0x55, 0x55, 0xD5, 0xFF, 0xFF, 0x55, 0x5F, 0xF5, 0x55, 0x5F, 0x55, 0x55, 0x55, 0xD5, 0xFF,
+        0xFF, 0x55, 0x5F, 0xF5, 0x55, 0x55, 0x55, 0xF5, 0xFF, 0xD5, 0xD5, 0x55, 0x55, 0xF5, 0x55, 0x5F,
+        0x55, 0xF5, 0x3F, 0x55, 0x55, 0xD5, 0xFF, 0xFF, 0x55, 0x55, 0x5F, 0x5F, 0x55, 0x55, 0x5F, 0x5F,
+        0x5F, 0x55, 0x55, 0xF5, 0xFF, 0xFF, 0x5F, 0xF5, 0x55, 0x5F, 0x55, 0x55, 0x55, 0xFD, 0xFF, 0xD5,
+        0x5F, 0xFD, 0x55, 0x55, 0xD5, 0xFF, 0xFF, 0x55, 0x5F, 0x55, 0x55, 0x55, 0xD5, 0xFF, 0xFF,
+    },
+    { // 140: (6, 19)
+        0x55, 0x55, 0x55, 0x55, 0xFF, 0xFF, 0x55, 0x5F, 0xF5, 0x55, 0x5F, 0x55, 0x55, 0x55, 0x55, 0xFF,
+        0xFF, 0x55, 0x5F, 0xF5, 0x55, 0x55, 0x55, 0xF5, 0xFF, 0xD5, 0xD5, 0x55, 0x55, 0xD5, 0x55, 0x5F,
+        0x55, 0xF5, 0xFF, 0x54, 0x55, 0xD5, 0xFF, 0xFF, 0x55, 0x55, 0x5F, 0x5F, 0x55, 0x55, 0x5D, 0x5D,
+        0x5D, 0x55, 0x55, 0x55, 0xF5, 0xFF, 0x5F, 0xF5, 0x55, 0x5F, 0x55, 0x55, 0x55, 0xF5, 0xFF, 0x55,
+        0x5F, 0xF5, 0x55, 0x55, 0x55, 0xF5, 0xFF, 0x55, 0x5F, 0x55, 0x55, 0x55, 0x55, 0xFF, 0xFF,
+    },
+    { // 141: (7, 19)
+        0xAA, 0xAA, 0xAA, 0xAA, 0xFE, 0xFF, 0xAA, 0xAF, 0xFA, 0xAA, 0xAF, 0xAA, 0xAA, 0xAA, 0x6A, 0xFD,
+        0xFF, 0x6A, 0xAF, 0xF6, 0xAA, 0x5A, 0x55, 0xF5, 0xFF, 0xD6, 0xD6, 0x56, 0x55, 0xD5, 0x56, 0x6D,
+        0x55, 0xF5, 0xFF, 0x53, 0x55, 0xD5, 0xFF, 0xFF, 0x54, 0x55, 0x4F, 0x4D, 0x55, 0x55, 0x4D, 0x4D,
+        0x0D, 0x00, 0x00, 0x40, 0xD5, 0xFF, 0x0F, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0x00,
+        0x0F, 0xF0, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF,
+    },
+    { // 142: (8, 19)
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5F, 0xF5,
+        0xFF, 0x7F, 0xFF, 0xF5, 0xFF, 0x5F, 0x55, 0xF5, 0xFF, 0xD7, 0xD7, 0x57, 0x55, 0xD5, 0x57, 0x7D,
+        0x55, 0xD5, 0xFF, 0x4F, 0x55, 0xD5, 0xFF, 0xFF, 0x57, 0x55, 0x7D, 0x7D, 0x55, 0x55, 0x7D, 0x7D,
+        0xFD, 0xFF, 0x57, 0x55, 0x55, 0xFF, 0xFF, 0xF5, 0x5F, 0xFF, 0xFF, 0x5F, 0x55, 0x55, 0xFF, 0x7F,
+        0xFF, 0xF7, 0xFF, 0xFF, 0x5F, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    },
+    { // 143: (9, 19)
+        0xFF, 0xFF, 0xFF, 0xFF, 0x55, 0x55, 0xFF, 0xF5, 0x5F, 0xFF, 0xF5, 0xFF, 0xFF, 0xFF, 0x57, 0x55,
+        0x55, 0x5F, 0xFF, 0xF5, 0xFF, 0x5F, 0x55, 0xF5, 0xFF, 0xD7, 0xD7, 0x57, 0x55, 0xD5, 0x57, 0x7D,
+        0x55, 0xD5, 0xFF, 0x3F, 0x55, 0x55, 0xFF, 0xFF, 0x57, 0x55, 0x7D, 0x7D, 0x55, 0x55, 0x7D, 0x7D,
+        0xFD, 0xFF, 0x55, 0x55, 0x55, 0x55, 0xF5, 0x55, 0x5F, 0xF5, 0xFF, 0x57, 0x55, 0x55, 0x55, 0x7F,
+        0xF5, 0x57, 0xFF, 0xFF, 0x5F, 0x55, 0x55, 0x7F, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0x55, 0x55,
+    },
+    { // 144: (10, 19)
+        0xFF, 0xFF, 0xBF, 0xAA, 0xAA, 0xAA, 0xAF, 0xFA, 0xAA, 0xAF, 0xFA, 0xFF, 0xAF, 0xAA, 0xAA, 0xAA,
+        0xAA, 0xAF, 0xFA, 0xFA, 0xFF, 0xAF, 0xAA, 0xFA, 0xFF, 0xEB, 0xEB, 0xAB, 0xAA, 0xEA, 0xAB, 0xBE,
+        0xAA, 0xEA, 0xFF, 0xFF, 0xA8, 0x2A, 0xFC, 0xFF, 0xA3, 0xAA, 0x3C, 0x3C, 0x00, 0x00, 0x3C, 0x3C,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    },
+    { // 145: (12, 19)
+        0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+        0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+        0x56, 0x55, 0x55, 0x55, 0x51, 0x55, 0x55, 0x55, 0x05, 0x00, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+        0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+        0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    },
+    { // 146: (13, 19)
+        0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+        0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+        0x5A, 0x55, 0x55, 0x55, 0x4D, 0x55, 0x55, 0x55, 0x05, 0x00, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+        0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+        0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    },
+    { // 147: (14, 19)
+        0xAA, 0xAA, 0xAA, 0x55, 0x55, 0x55, 0x6A, 0xA5, 0x56, 0x6A, 0xA5, 0xAA, 0xAA, 0x6A, 0x55, 0x55,
+        0x55, 0x6A, 0xA5, 0x56, 0xAA, 0xAA, 0x5A, 0x55, 0x55, 0x5A, 0x5A, 0xAA, 0x5A, 0x55, 0x6A, 0xA5,
+        0x6A, 0x55, 0xAA, 0xAA, 0x3E, 0x55, 0x55, 0x55, 0x0A, 0x00, 0xA5, 0xA5, 0xAA, 0x55, 0xA5, 0xA5,
+        0xA5, 0xAA, 0xAA, 0x5A, 0x55, 0x55, 0xA5, 0x56, 0x6A, 0xA5, 0xAA, 0xAA, 0x56, 0x55, 0x55, 0x6A,
+        0xA5, 0x56, 0xAA, 0xAA, 0x5A, 0x55, 0x55, 0x6A, 0xA5, 0xAA, 0xAA, 0x6A, 0x55, 0x55, 0x55,
+    },
+    { // 148: (15, 19)
+        0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+        0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+        0xAA, 0xA5, 0xAA, 0xAA, 0xFE, 0x94, 0xAA, 0xAA, 0x0A, 0x00, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+        0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+        0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    },
+    { // 149: (16, 19)
+        0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+        0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+        0xAA, 0xA6, 0xAA, 0xAA, 0xFE, 0x93, 0xAA, 0xAA, 0x0A, 0x00, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+        0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+        0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    },
+    { // 150: (17, 19)
+        0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+        0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+        0xAA, 0xAA, 0xAA, 0xAA, 0xFE, 0x8F, 0xAA, 0xAA, 0x0A, 0x00, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+        0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+        0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    },
+    { // 151: (19, 19)
+        0xAA, 0xAA, 0x55, 0x55, 0x55, 0x55, 0x5A, 0xA5, 0x55, 0x5A, 0xA5, 0xAA, 0xAA, 0x56, 0x55, 0x55,
+        0x55, 0xA5, 0x55, 0x5A, 0x55, 0xA5, 0xAA, 0x5A, 0x55, 0x69, 0x69, 0xA9, 0xAA, 0x6A, 0xA9, 0x96,
+        0xAA, 0x6A, 0x55, 0x15, 0xA8, 0x2A, 0x55, 0x55, 0xA1, 0xAA, 0x14, 0x14, 0x00, 0x00, 0x14, 0x04,
+        0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    },
+    { // 152: (20, 19)
+        0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xFF, 0x55, 0x55, 0x55,
+        0x55, 0x75, 0x55, 0x5F, 0x55, 0xF5, 0xFF, 0x5F, 0x55, 0x7D, 0x7D, 0xFD, 0xFF, 0x7F, 0xFD, 0xD7,
+        0xFF, 0x7F, 0x55, 0x55, 0xFD, 0xFF, 0x54, 0x55, 0xFD, 0xFF, 0xD7, 0xD7, 0xFF, 0xFF, 0xD7, 0xD7,
+        0x57, 0x55, 0xFF, 0xFF, 0x7F, 0x55, 0x55, 0x5F, 0xF5, 0x55, 0xF5, 0xFF, 0xFF, 0x55, 0x55, 0x75,
+        0x55, 0x57, 0x55, 0xF5, 0x5F, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    },
+    { // 153: (21, 19)
+        0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x7D, 0x55, 0x55, 0x55,
+        0x55, 0x75, 0x55, 0x57, 0x55, 0xF5, 0xFF, 0x5F, 0x55, 0x7D, 0x7D, 0xFD, 0xFF, 0x7F, 0xFD, 0x57,
+        0xFF, 0x7F, 0x55, 0x55, 0xFD, 0xFF, 0x53, 0x55, 0xF5, 0xFF, 0xD7, 0xD7, 0xFF, 0xFF, 0xD7, 0xD7,
+        0x57, 0x55, 0xFD, 0xFF, 0x5F, 0x55, 0x55, 0x5F, 0xF5, 0x55, 0xD5, 0xFF, 0x7F, 0x55, 0x55, 0x75,
+        0x55, 0x57, 0x55, 0xF5, 0x57, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    },
+    { // 154: (22, 19)
+        0x55, 0x55, 0xAA, 0xAA, 0xAA, 0xAA, 0xA5, 0x5A, 0xAA, 0xA5, 0x5A, 0x55, 0xA5, 0xAA, 0xAA, 0xAA,
+        0xAA, 0xB5, 0x5A, 0xAB, 0x55, 0xF5, 0xFF, 0xAB, 0xAA, 0xBD, 0xBD, 0xFD, 0xFF, 0xBF, 0xF5, 0x5B,
+        0xFF, 0xBF, 0x55, 0x55, 0xFD, 0xFF, 0x4F, 0x55, 0xF5, 0xFF, 0x53, 0xD3, 0xFF, 0xFF, 0xD3, 0xD3,
+        0x53, 0x55, 0xF5, 0x03, 0x00, 0x00, 0x50, 0x00, 0x05, 0x50, 0x15, 0x00, 0x00, 0x00, 0x00, 0x05,
+        0x50, 0x00, 0x55, 0x05, 0x00, 0x00, 0x00, 0x05, 0x50, 0x55, 0x01, 0x00, 0x00, 0x00, 0x00,
+    },
+    { // 155: (23, 19)
+        0x55, 0x55, 0xFD, 0xFF, 0xFF, 0xFF, 0xF5, 0x5F, 0xFF, 0xF5, 0x5F, 0x55, 0xD5, 0xFF, 0xFF, 0xFF,
+        0xFF, 0xF5, 0x5F, 0xFF, 0x55, 0xF5, 0xFF, 0xFF, 0xFF, 0xFD, 0xFD, 0xF5, 0xFF, 0xFF, 0xF5, 0x5F,
+        0xFF, 0xFF, 0x55, 0x55, 0xFD, 0xFF, 0x3F, 0x55, 0xF5, 0xFF, 0x5F, 0x5F, 0xFF, 0xFF, 0x5F, 0x5F,
+        0x5F, 0x55, 0x55, 0xF5, 0xFF, 0xFF, 0x5F, 0xFF, 0xF5, 0x5F, 0x55, 0xFD, 0xFF, 0xFF, 0xFF, 0xD5,
+        0x5F, 0xFD, 0x55, 0x55, 0xFD, 0xFF, 0xFF, 0xF5, 0x5F, 0x55, 0xD5, 0xFF, 0xFF, 0xFF, 0xFF,
+    },
+    { // 156: (24, 19)
+        0x55, 0x55, 0xF5, 0xFF, 0xFF, 0xFF, 0xF5, 0x5F, 0xFF, 0xF5, 0x5F, 0x55, 0x55, 0xFF, 0xFF, 0xFF,
+        0xFF, 0xD5, 0x5F, 0xFF, 0x55, 0xF5, 0xFF, 0xFF, 0xFF, 0xFD, 0xFD, 0xD5, 0xFF, 0xFF, 0xF5, 0x5F,
+        0xFF, 0xFF, 0x55, 0x55, 0xFD, 0xFF, 0xFF, 0x54, 0xF5, 0xFF, 0x5F, 0x5F, 0xFD, 0xFF, 0x5F, 0x5F,
+        0x5F, 0x55, 0x55, 0xF5, 0xFF, 0xFF, 0x5F, 0xFD, 0xF5, 0x5F, 0x55, 0xF5, 0xFF, 0xFF, 0xFF, 0xD5,
+        0x5F, 0xFD, 0x55, 0x55, 0xF5, 0xFF, 0xFF, 0xF5, 0x5F, 0x55, 0x55, 0xFF, 0xFF, 0xFF, 0xFF,
+    },
+    { // 157: (25, 19)
+        0x55, 0x55, 0xD5, 0xFF, 0xFF, 0xFF, 0xF5, 0x5F, 0xFF, 0xF5, 0x5F, 0x55, 0x55, 0xFD, 0xFF, 0xFF,
+        0xFF, 0xD5, 0x5F, 0xFD, 0x55, 0xF5, 0xFF, 0xFF, 0xFF, 0xFD, 0xFD, 0x55, 0xFF, 0xFF, 0xF5, 0x5F,
+        0xFF, 0xFF, 0x55, 0x55, 0xFD, 0xFF, 0xFF, 0x53, 0xF5, 0xFF, 0x5F, 0x5F, 0xF5, 0xFF, 0x5F, 0x5F,
+        0x5F, 0x55, 0x55, 0xF5, 0xFF, 0xFF, 0x5F, 0xFD, 0xD5, 0x5F, 0x55, 0xD5, 0xFF, 0xFF, 0xFF, 0xD5,
+        0x5F, 0xFD, 0x55, 0x55, 0xF5, 0xFF, 0xFF, 0xD5, 0x5F, 0x55, 0x55, 0xFD, 0xFF, 0xFF, 0xFF,
+    },
+    { // 158: (26, 19)
+        0x55, 0x55, 0x55, 0xFF, 0xFF, 0xFF, 0xD5, 0x5F, 0xFD, 0xD5, 0x5F, 0x55, 0x55, 0xF5, 0xFF, 0xFF,
+        0xFF, 0xD5, 0x5F, 0xFD, 0x55, 0x55, 0xF5, 0xFF, 0xFF, 0xF5, 0xF5, 0x55, 0xFD, 0xFF, 0xF5, 0x5F,
+        0xFF, 0xFF, 0x55, 0x55, 0xFD, 0xFF, 0xFF, 0x4F, 0xF5, 0xFF, 0x5F, 0x5F, 0xD5, 0xFF, 0x5F, 0x5F,
+        0x5F, 0x55, 0x55, 0xF5, 0xFF, 0xFF, 0x5F, 0xFD, 0xD5, 0x5F, 0x55, 0x55, 0xFF, 0xFF, 0xFF, 0xD5,
+        0x5F, 0xFD, 0x55, 0x55, 0xF5, 0xFF, 0xFF, 0xD5, 0x5F, 0x55, 0x55, 0xF5, 0xFF, 0xFF, 0xFF,
+    },
+    { // 159: (27, 19)
+        0x55, 0x55, 0x55, 0xFF, 0xFF, 0xFF, 0xD5, 0x5F, 0xFD, 0xD5, 0x5F, 0x55, 0x55, 0xD5, 0xFF, 0xFF,
+        0xFF, 0xD5, 0x5F, 0xFD, 0x55, 0x55, 0xF5, 0xFF, 0xFF, 0xF5, 0xF5, 0x55, 0xF5, 0xFF, 0xD5, 0x5F,
+        0xD5, 0xFF, 0x55, 0x55, 0x55, 0xFF, 0xFF, 0x3F, 0x55, 0xFD, 0x5F, 0x5F, 0x55, 0xFF, 0x5F, 0x5F,
+        0x5F, 0x55, 0x55, 0xF5, 0xFF, 0xFF, 0x5F, 0xFD, 0xD5, 0x5F, 0x55, 0x55, 0xFD, 0xFF, 0xFF, 0xD5,
+        0x5F, 0xFD, 0x55, 0x55, 0xF5, 0xFF, 0xFF, 0xD5, 0x5F, 0x55, 0x55, 0xD5, 0xFF, 0xFF, 0xFF,
+    },
+    { // 160: (7, 20)
+        0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+        0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+        0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA8, 0xAA, 0x8A, 0x8A, 0xAA, 0xAA, 0x8A, 0x0A,
+        0x0A, 0x00, 0x00, 0x00, 0xAA, 0xAA, 0x0A, 0xA0, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0xAA, 0x00,
+        0x0A, 0xA0, 0x00, 0x00, 0x00, 0xA0, 0xAA, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0xA0, 0xAA,
+    },
+    { // 161: (10, 20)
+        0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+        0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+        0xAA, 0x8A, 0xAA, 0xAA, 0xAA, 0x2A, 0xA0, 0xAA, 0xA2, 0xAA, 0x28, 0x28, 0x00, 0x00, 0x28, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    },
+    { // 162: (12, 20)
+        0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+        0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+        0x56, 0x55, 0x55, 0x55, 0x59, 0x55, 0x55, 0x55, 0x45, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+        0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+        0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    },
+    { // 163: (13, 20)
+        0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+        0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+        0x5A, 0x55, 0x55, 0x55, 0x69, 0x55, 0x55, 0x55, 0x35, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+        0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+        0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    },
+    { // 164: (14, 20)
+        0xAA, 0xAA, 0xAA, 0x55, 0x55, 0x55, 0x6A, 0xA5, 0x56, 0x6A, 0xA5, 0xAA, 0xAA, 0x6A, 0x55, 0x55,
+        0x55, 0x6A, 0xA5, 0x56, 0xAA, 0xAA, 0x5A, 0x55, 0x55, 0x5A, 0x5A, 0xAA, 0x5A, 0x55, 0x6A, 0xA5,
+        0x6A, 0x55, 0xAA, 0xAA, 0xAA, 0x55, 0x55, 0x55, 0xFA, 0x54, 0xA5, 0xA5, 0xAA, 0x55, 0xA5, 0xA5,
+        0xA5, 0xAA, 0xAA, 0x5A, 0x55, 0x55, 0xA5, 0x56, 0x6A, 0xA5, 0xAA, 0xAA, 0x56, 0x55, 0x55, 0x6A,
+        0xA5, 0x56, 0xAA, 0xAA, 0x5A, 0x55, 0x55, 0x6A, 0xA5, 0xAA, 0xAA, 0x6A, 0x55, 0x55, 0x55,
+    },
+    { // 165: (15, 20)
+        0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+        0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+        0xAA, 0xA5, 0xAA, 0xAA, 0xAA, 0x96, 0xAA, 0xAA, 0xFA, 0x53, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+        0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+        0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    },
+    { // 166: (16, 20)
+        0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+        0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+        0xAA, 0xA6, 0xAA, 0xAA, 0xAA, 0x9A, 0xAA, 0xAA, 0xFA, 0x4F, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+        0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+        0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    },
+    { // 167: (17, 20)
+        0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+        0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+        0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xFA, 0x3F, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+        0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+        0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+    },
+    { // 168: (19, 20)
+        0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+        0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x2A,
+        0xAA, 0xAA, 0xAA, 0x0A, 0xA8, 0xAA, 0xAA, 0xAA, 0xA2, 0xAA, 0x28, 0x28, 0x00, 0x00, 0x08, 0x08,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    },
+    { // 169: (22, 20)
+        0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+        0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+        0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA2, 0xA2, 0xAA, 0xAA, 0xA2, 0xA2,
+        0xA0, 0xAA, 0xAA, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x0A, 0xA0, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x0A,
+        0xA0, 0x00, 0xAA, 0x0A, 0x00, 0x00, 0x00, 0x0A, 0xA0, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00,
+    },
+    { // 170: (7, 21)
+        0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+        0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+        0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x8A, 0x8A, 0xAA, 0xAA, 0x0A, 0x0A,
+        0x0A, 0x00, 0x00, 0x00, 0xA8, 0xAA, 0x0A, 0xA0, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0xA8, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    },
+    { // 171: (10, 21)
+        0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+        0xAA, 0xAA, 0xA0, 0x0A, 0xAA, 0xAA, 0xAA, 0x0A, 0x00, 0x2A, 0x2A, 0xAA, 0xAA, 0x2A, 0xAA, 0xA0,
+        0xAA, 0x0A, 0xAA, 0xAA, 0xAA, 0x2A, 0x80, 0xAA, 0xAA, 0xAA, 0x20, 0x20, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    },
+    { // 172: (19, 21)
+        0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+        0xAA, 0xA0, 0x0A, 0xAA, 0x00, 0xA0, 0xAA, 0xAA, 0xAA, 0xA8, 0xA8, 0xA8, 0xAA, 0xAA, 0xA0, 0x0A,
+        0xAA, 0xAA, 0xAA, 0x02, 0xA8, 0xAA, 0xAA, 0xAA, 0xA0, 0xAA, 0x0A, 0x08, 0x00, 0x00, 0x08, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    },
+    { // 173: (22, 21)
+        0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+        0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+        0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA2, 0xAA, 0xAA, 0xA2, 0xA0,
+        0xA0, 0xAA, 0x2A, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x0A, 0xA0, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    },
+    { // 174: (7, 22)
+        0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+        0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+        0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x08, 0x00, 0x00, 0x08, 0x08,
+        0x08, 0x00, 0x00, 0x00, 0x80, 0xAA, 0x0A, 0xA0, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0xA0, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    },
+    { // 175: (10, 22)
+        0xAA, 0xAA, 0xAA, 0x6A, 0x55, 0x55, 0xAA, 0xA5, 0x5A, 0xAA, 0xA5, 0xAA, 0xAA, 0xAA, 0xAA, 0x5A,
+        0x55, 0xAA, 0xA5, 0x5A, 0xAA, 0xAA, 0xAA, 0x5A, 0x55, 0x6A, 0x6A, 0xAA, 0xAA, 0x5A, 0xAA, 0xA5,
+        0xAA, 0x5A, 0xAA, 0xAA, 0xAA, 0x6A, 0x55, 0xAA, 0xAA, 0xAA, 0xA5, 0x05, 0x55, 0x55, 0x05, 0x05,
+        0x05, 0x00, 0x00, 0x40, 0x55, 0x55, 0x05, 0x50, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    },
+    { // 176: (11, 22)
+        0xFF, 0xFF, 0xFF, 0x5F, 0x55, 0x55, 0xFF, 0xF5, 0x5F, 0xFF, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0x57,
+        0x55, 0xFF, 0xF5, 0x5F, 0xFF, 0xFF, 0xFF, 0x5F, 0x55, 0x7F, 0x7F, 0xFF, 0xFF, 0x57, 0xFF, 0xF5,
+        0xFF, 0x5F, 0xFF, 0xFF, 0xFF, 0x7F, 0x55, 0xFD, 0xFF, 0xFF, 0xF5, 0xF5, 0x54, 0x55, 0xF5, 0xF5,
+        0xF5, 0xFF, 0xFF, 0x5F, 0x55, 0x55, 0xF5, 0x57, 0xFF, 0xF5, 0xFF, 0xFF, 0xFF, 0x7F, 0x55, 0xFF,
+        0xF5, 0x5F, 0xFF, 0xFF, 0xFF, 0x5F, 0x55, 0xFF, 0xF5, 0xFF, 0xFF, 0xFF, 0x5F, 0x55, 0x55,
+    },
+    { // 177: (12, 22)
+        0xFF, 0xFF, 0xFF, 0x57, 0x55, 0x55, 0xFF, 0xF5, 0x5F, 0xFF, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0x55,
+        0x55, 0xFF, 0xF5, 0x5F, 0xFF, 0xFF, 0xFF, 0x5F, 0x55, 0x7F, 0x7F, 0xFF, 0xFF, 0x55, 0xFF, 0xF5,
+        0xFF, 0x5F, 0xFF, 0xFF, 0xFF, 0x7F, 0x55, 0xF5, 0xFF, 0xFF, 0xF5, 0xF5, 0x53, 0x55, 0xF5, 0xF5,
+        0xF5, 0xFF, 0xFF, 0x5F, 0x55, 0x55, 0xF5, 0x57, 0x7F, 0xF5, 0xFF, 0xFF, 0xFF, 0x5F, 0x55, 0xFF,
+        0xF5, 0x5F, 0xFF, 0xFF, 0xFF, 0x5F, 0x55, 0xFF, 0xF5, 0xFF, 0xFF, 0xFF, 0x57, 0x55, 0x55,
+    },
+    { // 178: (13, 22)
+        0xFF, 0xFF, 0xFF, 0x55, 0x55, 0x55, 0x7F, 0xF5, 0x57, 0x7F, 0xF5, 0xFF, 0xFF, 0xFF, 0x55, 0x55,
+        0x55, 0x7F, 0xF5, 0x57, 0xFF, 0xFF, 0x5F, 0x55, 0x55, 0x5F, 0x5F, 0xFF, 0x7F, 0x55, 0xFF, 0xF5,
+        0xFF, 0x5F, 0xFF, 0xFF, 0xFF, 0x7F, 0x55, 0xD5, 0xFF, 0xFF, 0xF5, 0xF5, 0x4F, 0x55, 0xF5, 0xF5,
+        0xF5, 0xFF, 0xFF, 0x5F, 0x55, 0x55, 0xF5, 0x57, 0x7F, 0xF5, 0xFF, 0xFF, 0x5F, 0x55, 0x55, 0x7F,
+        0xF5, 0x57, 0xFF, 0xFF, 0x5F, 0x55, 0x55, 0x7F, 0xF5, 0xFF, 0xFF, 0xFF, 0x55, 0x55, 0x55,
+    },
+    { // 179: (14, 22)
+        0xFF, 0xFF, 0xFF, 0x55, 0x55, 0x55, 0x7F, 0xF5, 0x57, 0x7F, 0xF5, 0xFF, 0xFF, 0x7F, 0x55, 0x55,
+        0x55, 0x7F, 0xF5, 0x57, 0xFF, 0xFF, 0x5F, 0x55, 0x55, 0x5F, 0x5F, 0xFF, 0x5F, 0x55, 0x7F, 0xF5,
+        0x7F, 0x55, 0xFF, 0xFF, 0xFF, 0x55, 0x55, 0x55, 0xFF, 0x57, 0xF5, 0xF5, 0x3F, 0x55, 0xF5, 0xF5,
+        0xF5, 0xFF, 0xFF, 0x5F, 0x55, 0x55, 0xF5, 0x57, 0x7F, 0xF5, 0xFF, 0xFF, 0x57, 0x55, 0x55, 0x7F,
+        0xF5, 0x57, 0xFF, 0xFF, 0x5F, 0x55, 0x55, 0x7F, 0xF5, 0xFF, 0xFF, 0x7F, 0x55, 0x55, 0x55,
+    },
+    { // 180: (15, 22)
+        0xFF, 0xFF, 0xFF, 0x55, 0x55, 0x55, 0x7F, 0xF5, 0x57, 0x7F, 0xF5, 0xFF, 0xFF, 0x5F, 0x55, 0x55,
+        0x55, 0x7F, 0xF5, 0x57, 0xFF, 0xFF, 0x5F, 0x55, 0x55, 0x5F, 0x5F, 0xFF, 0x57, 0x55, 0x5F, 0xF5,
+        0x55, 0x55, 0xFD, 0xFF, 0x57, 0x55, 0x55, 0x55, 0x5F, 0x55, 0xF5, 0xF5, 0xFF, 0x54, 0xF5, 0xF5,
+        0xF5, 0xFF, 0xFF, 0x5F, 0x55, 0x55, 0xF5, 0x57, 0x7F, 0xF5, 0xFF, 0xFF, 0x55, 0x55, 0x55, 0x7F,
+        0xF5, 0x57, 0xFF, 0xFF, 0x5F, 0x55, 0x55, 0x7F, 0xF5, 0xFF, 0xFF, 0x5F, 0x55, 0x55, 0x55,
+    },
+    { // 181: (16, 22)
+        0xFF, 0xFF, 0x7F, 0x55, 0x55, 0x55, 0x5F, 0xF5, 0x55, 0x5F, 0xF5, 0xFF, 0x5F, 0x55, 0x55, 0x55,
+        0x55, 0x5F, 0xF5, 0x55, 0xFF, 0x5F, 0x55, 0x55, 0x55, 0x57, 0x57, 0xFF, 0x55, 0x55, 0x5F, 0xF5,
+        0x55, 0x55, 0xF5, 0xFF, 0x57, 0x55, 0x55, 0x55, 0x5F, 0x55, 0xF5, 0xF5, 0xFF, 0x53, 0xF5, 0xF5,
+        0xF5, 0xFF, 0xFF, 0x5F, 0x55, 0x55, 0xF5, 0x57, 0x7F, 0xF5, 0xFF, 0x55, 0x55, 0x55, 0x55, 0x5F,
+        0xF5, 0x55, 0xFF, 0x5F, 0x55, 0x55, 0x55, 0x5F, 0xF5, 0xFF, 0xFF, 0x57, 0x55, 0x55, 0x55,
+    },
+    { // 182: (17, 22)
+        0xFF, 0xFF, 0x5F, 0x55, 0x55, 0x55, 0x5F, 0xF5, 0x55, 0x5F, 0xF5, 0xFF, 0x57, 0x55, 0x55, 0x55,
+        0x55, 0x5F, 0xF5, 0x55, 0xFF, 0x5F, 0x55, 0x55, 0x55, 0x57, 0x57, 0x7F, 0x55, 0x55, 0x5F, 0xF5,
+        0x55, 0x55, 0xD5, 0xFF, 0x57, 0x55, 0x55, 0x55, 0x5F, 0x55, 0xF5, 0xF5, 0xFF, 0x4F, 0xF5, 0xF5,
+        0xF5, 0xFF, 0xFF, 0x5F, 0x55, 0x55, 0xF5, 0x57, 0x5F, 0xF5, 0x7F, 0x55, 0x55, 0x55, 0x55, 0x5F,
+        0xF5, 0x55, 0xFF, 0x5F, 0x55, 0x55, 0x55, 0x5F, 0xF5, 0xFF, 0xFF, 0x55, 0x55, 0x55, 0x55,
+    },
+    { // 183: (18, 22)
+        0xFF, 0xFF, 0x57, 0x55, 0x55, 0x55, 0x5F, 0xF5, 0x55, 0x5F, 0xF5, 0xFF, 0x55, 0x55, 0x55, 0x55,
+        0x55, 0x5F, 0xF5, 0x55, 0xFF, 0x5F, 0x55, 0x55, 0x55, 0x57, 0x57, 0x5F, 0x55, 0x55, 0x5F, 0xF5,
+        0x55, 0x55, 0x55, 0xFF, 0x57, 0x55, 0x55, 0x55, 0x5F, 0x55, 0xF5, 0xF5, 0xFF, 0x3F, 0xF5, 0xF5,
+        0xF5, 0xFF, 0xFF, 0x5F, 0x55, 0x55, 0xF5, 0x55, 0x5F, 0xF5, 0x5F, 0x55, 0x55, 0x55, 0x55, 0x5F,
+        0xF5, 0x55, 0xFF, 0x5F, 0x55, 0x55, 0x55, 0x5F, 0xF5, 0xFF, 0x7F, 0x55, 0x55, 0x55, 0x55,
+    },
+    { // 184: (19, 22)
+        0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+        0xAA, 0xAF, 0xFA, 0xAA, 0xFF, 0xAF, 0xAA, 0xAA, 0xAA, 0xAB, 0xAB, 0xAB, 0xAA, 0xAA, 0xAF, 0xFA,
+        0xAA, 0xAA, 0xAA, 0xFE, 0xAB, 0xAA, 0xAA, 0xAA, 0xAF, 0xAA, 0xFA, 0xFA, 0xFF, 0xFF, 0xF0, 0xF0,
+        0xF0, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0xF0, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    },
+    { // 185: (22, 22)
+        0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+        0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+        0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x2A, 0x2A, 0x00, 0x00, 0x20, 0x20,
+        0xA0, 0xAA, 0x02, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x02, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    },
+    { // 186: (7, 23)
+        0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+        0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+        0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x28, 0x28, 0x00, 0x00, 0x08, 0x08,
+        0x08, 0x00, 0x00, 0x00, 0x00, 0xAA, 0x0A, 0x80, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    },
+    { // 187: (10, 23)
+        0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+        0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+        0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x8A, 0x8A, 0xAA, 0xAA, 0x0A, 0x0A,
+        0x0A, 0x00, 0x00, 0x00, 0xAA, 0xAA, 0x0A, 0xA0, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0xA0, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    },
+    { // 188: (19, 23)
+        0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+        0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+        0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA2, 0xAA, 0xAA, 0xA2, 0xA0,
+        0xA0, 0xAA, 0xAA, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x02, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    },
+    { // 189: (22, 23)
+        0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+        0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+        0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA2, 0xAA, 0x2A, 0x28, 0x00, 0x00, 0x28, 0x20,
+        0xA0, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x02, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    },
+    { // 190: (7, 24)
+        0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+        0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA8,
+        0xAA, 0x8A, 0xAA, 0xAA, 0xAA, 0x2A, 0xAA, 0xAA, 0xA2, 0xAA, 0x28, 0x28, 0x00, 0x00, 0x28, 0x08,
+        0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    },
+    { // 191: (10, 24)
+        0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+        0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+        0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA8, 0xAA, 0x8A, 0x8A, 0xAA, 0xAA, 0x8A, 0x0A,
+        0x0A, 0x00, 0x00, 0x00, 0xA8, 0xAA, 0x0A, 0x80, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    },
+    { // 192: (19, 24)
+        0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+        0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+        0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA2, 0xA2, 0xAA, 0xAA, 0xA2, 0xA2,
+        0xA0, 0xAA, 0x2A, 0x00, 0x00, 0x00, 0x20, 0x00, 0x02, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    },
+    { // 193: (22, 24)
+        0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+        0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA2, 0x2A,
+        0xAA, 0xAA, 0xAA, 0xAA, 0xA8, 0xAA, 0xAA, 0xAA, 0xA2, 0xAA, 0x28, 0x28, 0x00, 0x00, 0x28, 0x28,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    },
+    { // 194: (2, 25)
+        0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+        0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+        0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+        0x45, 0x55, 0x55, 0x55, 0x55, 0x55, 0x45, 0x55, 0x54, 0x05, 0x54, 0x55, 0x55, 0x55, 0x55, 0x54,
+        0x45, 0x55, 0x00, 0x50, 0x05, 0x55, 0x55, 0x10, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    },
+    { // 195: (3, 25)
+        0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+        0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+        0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+        0x35, 0x55, 0x55, 0x55, 0x55, 0x55, 0x75, 0x55, 0x57, 0xF5, 0x57, 0x55, 0x55, 0x55, 0x55, 0x57,
+        0x75, 0x55, 0xFF, 0x55, 0x55, 0x55, 0x55, 0x57, 0xF5, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    },
+    { // 196: (4, 25)
+        0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+        0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+        0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+        0xF5, 0x54, 0x55, 0x55, 0x55, 0x55, 0x75, 0x55, 0x57, 0xF5, 0x57, 0x55, 0x55, 0x55, 0x55, 0x57,
+        0x75, 0x55, 0x7F, 0x55, 0x55, 0x55, 0x55, 0x57, 0x75, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    },
+    { // 197: (5, 25)
+        0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+        0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+        0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+        0xF5, 0x53, 0x55, 0x55, 0x55, 0x55, 0x75, 0x55, 0x57, 0xF5, 0x57, 0x55, 0x55, 0x55, 0x55, 0x57,
+        0x75, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    },
+    { // 198: (6, 25)
+        0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+        0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+        0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+        0xF5, 0x4F, 0x55, 0x55, 0x55, 0x55, 0x75, 0x55, 0x57, 0xF5, 0x57, 0x55, 0x55, 0x55, 0x55, 0x57,
+        0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    },
+    { // 199: (7, 25)
+        0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x6A, 0xA9,
+        0xAA, 0x6A, 0xAA, 0xA6, 0xAA, 0x5A, 0x55, 0xA5, 0xAA, 0x96, 0x96, 0x56, 0x55, 0x95, 0x56, 0x69,
+        0x55, 0x95, 0xAA, 0xAA, 0x55, 0x55, 0xA9, 0xAA, 0x56, 0x55, 0x69, 0x69, 0x55, 0x55, 0x69, 0x69,
+        0xF1, 0x3F, 0x55, 0x05, 0x00, 0x00, 0x30, 0x01, 0x13, 0xF0, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    },
+    { // 200: (8, 25)
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5F, 0xF5,
+        0xFF, 0x7F, 0xFF, 0xF5, 0xFF, 0x5F, 0x55, 0xF5, 0xFF, 0xD7, 0xD7, 0x57, 0x55, 0xD5, 0x57, 0x7D,
+        0x55, 0xD5, 0xFF, 0x7F, 0x55, 0x55, 0xF5, 0xFF, 0x57, 0x55, 0x7D, 0x7D, 0x55, 0x55, 0x7D, 0x75,
+        0xF5, 0xFF, 0x54, 0x55, 0x55, 0x55, 0xF5, 0x55, 0x5F, 0xF5, 0xFF, 0x5F, 0x55, 0x55, 0x55, 0x7F,
+        0xF5, 0x57, 0xFF, 0xFF, 0x5F, 0x55, 0x55, 0xFF, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0x57, 0x55,
+    },
+    { // 201: (9, 25)
+        0xFF, 0xFF, 0xFF, 0xFF, 0x55, 0x55, 0xFF, 0xF5, 0x5F, 0xFF, 0xF5, 0xFF, 0xFF, 0xFF, 0x57, 0x55,
+        0x55, 0x5F, 0xF5, 0x55, 0xFF, 0x5F, 0x55, 0x55, 0x55, 0x57, 0x57, 0x57, 0x55, 0x55, 0x57, 0x75,
+        0x55, 0x55, 0xFF, 0x5F, 0x55, 0x55, 0xD5, 0xFF, 0x57, 0x55, 0x75, 0x75, 0x55, 0x55, 0x75, 0x75,
+        0xF5, 0xFF, 0x53, 0x55, 0x55, 0x55, 0xF5, 0x55, 0x5F, 0xF5, 0xFF, 0x57, 0x55, 0x55, 0x55, 0x7F,
+        0xF5, 0x57, 0xFF, 0xFF, 0x5F, 0x55, 0x55, 0x7F, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0x55, 0x55,
+    },
+    { // 202: (10, 25)
+        0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+        0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+        0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAB, 0xAA, 0xBA, 0xBA, 0xAA, 0xAA, 0xB6, 0xB6,
+        0xF6, 0xFF, 0x4F, 0x55, 0x55, 0x55, 0xF5, 0x55, 0x5F, 0xF5, 0xFF, 0x55, 0x55, 0x55, 0x55, 0x5F,
+        0xF5, 0x55, 0xFF, 0x5F, 0x55, 0x55, 0x55, 0x5F, 0xF5, 0xFF, 0xFF, 0x57, 0x55, 0x55, 0x55,
+    },
+    { // 203: (11, 25)
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xF7, 0xF7,
+        0xF5, 0xFF, 0x3F, 0x55, 0x55, 0x55, 0xF5, 0x55, 0x5F, 0xF5, 0x7F, 0x55, 0x55, 0x55, 0x55, 0x5F,
+        0xF5, 0x55, 0xFF, 0x5F, 0x55, 0x55, 0x55, 0x5F, 0xF5, 0xFF, 0xFF, 0x55, 0x55, 0x55, 0x55,
+    },
+    { // 204: (12, 25)
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xF7, 0xFF, 0xFF, 0xF7, 0xF5,
+        0xF5, 0xFF, 0xFF, 0x54, 0x55, 0x55, 0xF5, 0x55, 0x5F, 0xF5, 0x5F, 0x55, 0x55, 0x55, 0x55, 0x5F,
+        0xF5, 0x55, 0xFF, 0x5F, 0x55, 0x55, 0x55, 0x5F, 0xF5, 0xFF, 0x7F, 0x55, 0x55, 0x55, 0x55,
+    },
+    { // 205: (13, 25)
+        0xFF, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0xFF, 0xF0, 0x0F, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F,
+        0x00, 0xFF, 0xF0, 0x0F, 0xFF, 0xFF, 0xFF, 0x0F, 0x00, 0x3F, 0x3F, 0xFF, 0xFF, 0x0F, 0xFF, 0xF0,
+        0xFF, 0x0F, 0xFF, 0xFF, 0xFF, 0x3F, 0x00, 0xFF, 0xFF, 0xFF, 0xF0, 0xF0, 0xFF, 0xFF, 0xF0, 0xF0,
+        0xF0, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0xF0, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    },
+    { // 206: (16, 25)
+        0x00, 0x00, 0x54, 0x55, 0x55, 0x55, 0x50, 0x05, 0x55, 0x50, 0x05, 0x00, 0x55, 0x55, 0x55, 0x55,
+        0x55, 0x50, 0x05, 0x55, 0x00, 0x50, 0x55, 0x55, 0x55, 0x54, 0x54, 0x50, 0x55, 0x55, 0x50, 0x05,
+        0x55, 0x55, 0x55, 0x00, 0x54, 0x55, 0x55, 0x55, 0x50, 0x55, 0x05, 0x05, 0x55, 0x55, 0x05, 0x05,
+        0x05, 0x00, 0x00, 0x40, 0x55, 0x55, 0x05, 0x50, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    },
+    { // 207: (17, 25)
+        0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+        0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+        0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x75, 0x75, 0x55, 0x55, 0x75, 0xF5,
+        0xF5, 0xFF, 0xFF, 0x3F, 0x55, 0x55, 0xF5, 0x5F, 0xFF, 0xF5, 0xFF, 0xFF, 0xFF, 0x7F, 0x55, 0xFF,
+        0xF5, 0x5F, 0xFF, 0xFF, 0xFF, 0x5F, 0x55, 0xFF, 0xF5, 0xFF, 0xFF, 0xFF, 0x5F, 0x55, 0x55,
+    },
+    { // 208: (18, 25)
+        0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+        0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+        0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x75, 0x55, 0x55, 0x75, 0x75,
+        0xF5, 0xFF, 0xFF, 0xFF, 0x54, 0x55, 0xF5, 0x5F, 0xFF, 0xF5, 0xFF, 0xFF, 0xFF, 0x5F, 0x55, 0xFF,
+        0xF5, 0x5F, 0xFF, 0xFF, 0xFF, 0x5F, 0x55, 0xFF, 0xF5, 0xFF, 0xFF, 0xFF, 0x57, 0x55, 0x55,
+    },
+    { // 209: (19, 25)
+        0xAA, 0xAA, 0x55, 0x55, 0x55, 0x55, 0x5A, 0xA5, 0x55, 0x5A, 0xA5, 0xAA, 0xAA, 0x56, 0x55, 0x55,
+        0x55, 0xAA, 0xA5, 0x5A, 0xAA, 0xAA, 0xAA, 0x5A, 0x55, 0x6A, 0x6A, 0xAA, 0xAA, 0x6A, 0xAA, 0xA6,
+        0xAA, 0x6A, 0x55, 0xA9, 0xAA, 0xAA, 0x5A, 0x55, 0xAA, 0xAA, 0xA6, 0xA6, 0xAA, 0xAA, 0xA6, 0xA6,
+        0xA6, 0xAA, 0xEA, 0xFF, 0x53, 0x55, 0xE5, 0x5F, 0xFE, 0xE5, 0xFF, 0xFF, 0xFF, 0x57, 0x55, 0x7F,
+        0xF5, 0x57, 0xFF, 0xFF, 0x5F, 0x55, 0x55, 0x7F, 0xF5, 0xFF, 0x5F, 0x55, 0x55, 0x55, 0x55,
+    },
+    { // 210: (20, 25)
+        0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xFF, 0x55, 0x55, 0x55,
+        0x55, 0x75, 0x55, 0x5F, 0x55, 0xF5, 0xFF, 0x5F, 0x55, 0x7D, 0x7D, 0xFD, 0xFF, 0x7F, 0xFD, 0xD7,
+        0xFF, 0x7F, 0x55, 0xF5, 0xFF, 0xFF, 0x57, 0x55, 0xFD, 0xFF, 0xD7, 0xD7, 0xFF, 0xFF, 0xF7, 0xF7,
+        0xF7, 0xFF, 0xFF, 0xFF, 0x4F, 0x55, 0xF5, 0x5F, 0xFF, 0xF5, 0xFF, 0xFF, 0xFF, 0x55, 0x55, 0x7F,
+        0xF5, 0x57, 0xFF, 0xFF, 0x5F, 0x55, 0x55, 0x5F, 0xF5, 0xFF, 0x57, 0x55, 0x55, 0x55, 0x55,
+    },
+    { // 211: (21, 25)
+        0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x7D, 0x55, 0x55, 0x55,
+        0x55, 0x75, 0x55, 0x57, 0x55, 0xF5, 0xFF, 0x5F, 0x55, 0x7D, 0x7D, 0xFD, 0xFF, 0x7F, 0xFD, 0xD7,
+        0xFF, 0x7F, 0x55, 0xD5, 0xFF, 0xFF, 0x55, 0x55, 0xFD, 0xFF, 0xD7, 0xD7, 0xFF, 0xFF, 0xD7, 0xF7,
+        0xF7, 0xFF, 0xFF, 0xFF, 0x3F, 0x55, 0xF5, 0x5F, 0xFF, 0xF5, 0xFF, 0xFF, 0x7F, 0x55, 0x55, 0x7F,
+        0xF5, 0x57, 0xFF, 0xFF, 0x57, 0x55, 0x55, 0x5F, 0xF5, 0xFF, 0x55, 0x55, 0x55, 0x55, 0x55,
+    },
+    { // 212: (22, 25)
+        0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+        0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAE, 0xEA,
+        0xAA, 0xAA, 0xAA, 0xAA, 0xAB, 0xAA, 0xAA, 0xAA, 0xAE, 0xAA, 0xEB, 0xEB, 0xFF, 0xFF, 0xEB, 0xCB,
+        0x0B, 0x00, 0x00, 0xF0, 0xFF, 0x54, 0x05, 0x4C, 0xC0, 0x04, 0x00, 0x00, 0x00, 0x00, 0x54, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    },
+    { // 213: (23, 25)
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x53, 0xF5, 0x7F, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0x57, 0xFF,
+        0xF7, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    },
+    { // 214: (24, 25)
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x4F, 0xF5, 0x7F, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0x57, 0xFF,
+        0xF7, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0x57, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F,
+    },
+    { // 215: (25, 25)
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0xF5, 0x7F, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0x57, 0xFF,
+        0xF7, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0x55, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5F,
+    },
+    { // 216: (26, 25)
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x7F, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0x57, 0xFF,
+        0xF7, 0x7F, 0xFF, 0xFF, 0xFF, 0x7F, 0x55, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x57,
+    },
+    { // 217: (27, 25)
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF3, 0x3F, 0xFF, 0xF3, 0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0xFF,
+        0xF3, 0x3F, 0xFF, 0xFF, 0xF0, 0x0F, 0x00, 0xCF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    },
+    { // 218: (2, 26)
+        0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+        0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+        0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+        0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x8A, 0xAA, 0xA8, 0x0A, 0xA8, 0xAA, 0xAA, 0xAA, 0xAA, 0xA8,
+        0x0A, 0xAA, 0x00, 0xA0, 0x0A, 0xA8, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    },
+    { // 219: (7, 26)
+        0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+        0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+        0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA2,
+        0xA0, 0xAA, 0xAA, 0x0A, 0x00, 0x00, 0x20, 0x02, 0x02, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    },
+    { // 220: (13, 26)
+        0xAA, 0xAA, 0xAA, 0x0A, 0x00, 0x00, 0xAA, 0xA0, 0x0A, 0xAA, 0xA0, 0xAA, 0xAA, 0xAA, 0xAA, 0x02,
+        0x00, 0xAA, 0xA0, 0x0A, 0xAA, 0xAA, 0xAA, 0x0A, 0x00, 0x2A, 0x2A, 0xAA, 0xAA, 0x02, 0xAA, 0xA0,
+        0xAA, 0x0A, 0xAA, 0xAA, 0xAA, 0x2A, 0x00, 0xA8, 0xAA, 0xAA, 0xA0, 0xA0, 0xAA, 0x2A, 0xA0, 0xA0,
+        0xA0, 0xAA, 0xAA, 0x0A, 0x00, 0x00, 0xA0, 0x00, 0x02, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    },
+    { // 221: (16, 26)
+        0x00, 0x00, 0xA0, 0xAA, 0xAA, 0xAA, 0xA0, 0x0A, 0xAA, 0xA0, 0x0A, 0x00, 0xA8, 0xAA, 0xAA, 0xAA,
+        0xAA, 0xA0, 0x0A, 0xAA, 0x00, 0xA0, 0xAA, 0xAA, 0xAA, 0xA8, 0xA8, 0x80, 0xAA, 0xAA, 0xA0, 0x0A,
+        0xAA, 0xAA, 0x2A, 0x00, 0xA8, 0xAA, 0xAA, 0xAA, 0xA0, 0xAA, 0x0A, 0x0A, 0xA8, 0xAA, 0x0A, 0x0A,
+        0x0A, 0x00, 0x00, 0xA0, 0xAA, 0xAA, 0x0A, 0xA0, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0xA0, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    },
+    { // 222: (22, 26)
+        0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+        0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+        0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x8A, 0x0A,
+        0x0A, 0x00, 0x00, 0xA0, 0xAA, 0xAA, 0x0A, 0x88, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0xA0, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    },
+    { // 223: (27, 26)
+        0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+        0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+        0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+        0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x2A, 0xAA, 0xA2, 0xAA, 0xAA, 0xAA, 0xAA, 0x02, 0xAA,
+        0xA2, 0x0A, 0xAA, 0x2A, 0xA0, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    },
+    { // 224: (2, 27)
+        0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+        0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+        0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+        0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA8, 0x0A, 0xA8, 0xAA, 0xAA, 0xAA, 0x02, 0xA0,
+        0x02, 0x2A, 0x00, 0xA0, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    },
+    { // 225: (7, 27)
+        0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+        0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+        0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA2, 0xA0,
+        0xA0, 0xAA, 0xAA, 0x0A, 0x00, 0x00, 0xA0, 0x00, 0x02, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    },
+    { // 226: (13, 27)
+        0xAA, 0xAA, 0xAA, 0x02, 0x00, 0x00, 0xAA, 0xA0, 0x0A, 0xAA, 0xA0, 0xAA, 0xAA, 0xAA, 0xAA, 0x00,
+        0x00, 0xAA, 0xA0, 0x0A, 0xAA, 0xAA, 0xAA, 0x0A, 0x00, 0x2A, 0x2A, 0xAA, 0xAA, 0x00, 0xAA, 0xA0,
+        0xAA, 0x0A, 0xAA, 0xAA, 0xAA, 0x2A, 0x00, 0xA0, 0xAA, 0xAA, 0xA0, 0xA0, 0xAA, 0x0A, 0xA0, 0xA0,
+        0xA0, 0xAA, 0xAA, 0x0A, 0x00, 0x00, 0x20, 0x02, 0x02, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    },
+    { // 227: (16, 27)
+        0x00, 0x00, 0x80, 0xAA, 0xAA, 0xAA, 0xA0, 0x0A, 0xAA, 0xA0, 0x0A, 0x00, 0xA0, 0xAA, 0xAA, 0xAA,
+        0xAA, 0xA0, 0x0A, 0xAA, 0x00, 0xA0, 0xAA, 0xAA, 0xAA, 0xA8, 0xA8, 0x00, 0xAA, 0xAA, 0xA0, 0x0A,
+        0xAA, 0xAA, 0x0A, 0x00, 0xA8, 0xAA, 0xAA, 0xAA, 0xA0, 0xAA, 0x0A, 0x0A, 0xA0, 0xAA, 0x0A, 0x0A,
+        0x0A, 0x00, 0x00, 0xA0, 0xAA, 0xAA, 0x0A, 0x88, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    },
+    { // 228: (22, 27)
+        0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+        0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+        0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x8A, 0xAA, 0xAA, 0x0A, 0x0A,
+        0x0A, 0x00, 0x00, 0xA0, 0xAA, 0xAA, 0x0A, 0xA0, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    },
+    { // 229: (27, 27)
+        0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+        0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+        0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+        0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x02, 0xA8, 0xAA, 0xAA, 0xAA, 0x02, 0xA8,
+        0x80, 0x0A, 0x00, 0x00, 0x80, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    },
+    { // 230: (2, 28)
+        0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+        0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+        0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+        0xA6, 0xAA, 0xAA, 0x5A, 0x55, 0x55, 0xA5, 0x56, 0x6A, 0x45, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+        0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    },
+    { // 231: (3, 28)
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7,
+        0xF5, 0xFF, 0xFF, 0x5F, 0x55, 0x55, 0xF5, 0x57, 0x57, 0x35, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+        0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    },
+    { // 232: (4, 28)
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF3, 0xF0,
+        0xF0, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x30, 0x00, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    },
+    { // 233: (7, 28)
+        0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+        0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x9A, 0xAA, 0xA9,
+        0xAA, 0x9A, 0xAA, 0xAA, 0xAA, 0x6A, 0xA9, 0xAA, 0xAA, 0xAA, 0xA9, 0xA5, 0xAA, 0xAA, 0xA5, 0xA5,
+        0xA5, 0xAA, 0xAA, 0x56, 0x55, 0x55, 0xA5, 0x55, 0x5A, 0x05, 0x50, 0x55, 0x55, 0x55, 0x55, 0x50,
+        0x05, 0x55, 0x00, 0x50, 0x05, 0x55, 0x55, 0x10, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    },
+    { // 234: (8, 28)
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD7, 0xFF, 0xFD,
+        0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0x7F, 0xF5, 0xFF, 0xFF, 0xFF, 0xF5, 0xF5, 0xFF, 0x7F, 0xF5, 0xF5,
+        0xF5, 0xFF, 0xFF, 0x55, 0x55, 0x55, 0xF5, 0x55, 0x5F, 0xF5, 0x4F, 0x55, 0x55, 0x55, 0x55, 0x5F,
+        0xF5, 0x55, 0xFF, 0x5F, 0x55, 0x55, 0x55, 0x5F, 0xF5, 0xFF, 0xFF, 0x55, 0x55, 0x55, 0x55,
+    },
+    { // 235: (9, 28)
+        0xFF, 0xFF, 0xFF, 0xFF, 0x55, 0x55, 0xFF, 0xF5, 0x5F, 0xFF, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0x55,
+        0x55, 0xFF, 0xF5, 0x5F, 0xFF, 0xFF, 0xFF, 0x5F, 0x55, 0x7F, 0x7F, 0xFF, 0xFF, 0x55, 0xFF, 0xF5,
+        0xFF, 0x5F, 0xFF, 0xFF, 0xFF, 0x7F, 0xD5, 0xFF, 0xFF, 0xFF, 0xF5, 0xF5, 0xFF, 0x5F, 0xF5, 0xF5,
+        0xF5, 0xFF, 0x7F, 0x55, 0x55, 0x55, 0xF5, 0x55, 0x5F, 0xF5, 0x3F, 0x55, 0x55, 0x55, 0x55, 0x5F,
+        0xF5, 0x55, 0xFF, 0x5F, 0x55, 0x55, 0x55, 0x5F, 0xF5, 0xFF, 0x7F, 0x55, 0x55, 0x55, 0x55,
+    },
+    { // 236: (10, 28)
+        0xFF, 0xFF, 0xFF, 0x7F, 0x55, 0x55, 0xFF, 0xF5, 0x5F, 0xFF, 0xF5, 0xFF, 0xFF, 0xFF, 0x7F, 0x55,
+        0x55, 0x7F, 0xF5, 0x57, 0xFF, 0x5F, 0x55, 0x55, 0x55, 0x57, 0x57, 0x57, 0x55, 0x55, 0x57, 0x75,
+        0x55, 0x55, 0xFF, 0xFF, 0x55, 0x55, 0x55, 0xFF, 0x57, 0x55, 0x75, 0x75, 0x55, 0x55, 0x75, 0x75,
+        0xF5, 0xFF, 0x5F, 0x55, 0x55, 0x55, 0xF5, 0x55, 0x5F, 0xF5, 0xFF, 0x54, 0x55, 0x55, 0x55, 0x4F,
+        0xF5, 0x54, 0xFF, 0x0F, 0x00, 0x55, 0x55, 0x0F, 0xF5, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00,
+    },
+    { // 237: (11, 28)
+        0xFF, 0xFF, 0xFF, 0x5F, 0x55, 0x55, 0xFF, 0xF5, 0x5F, 0xFF, 0xF5, 0xFF, 0xFF, 0xFF, 0x5F, 0x55,
+        0x55, 0x7F, 0xF5, 0x55, 0xFF, 0x5F, 0x55, 0x55, 0x55, 0x57, 0x57, 0x57, 0x55, 0x55, 0x57, 0x75,
+        0x55, 0x55, 0xFF, 0x7F, 0x55, 0x55, 0x55, 0xFD, 0x57, 0x55, 0x75, 0x75, 0x55, 0x55, 0x75, 0x75,
+        0xF5, 0xFF, 0x57, 0x55, 0x55, 0x55, 0xF5, 0x55, 0x5F, 0xF5, 0xFF, 0x53, 0x55, 0x55, 0x55, 0x7F,
+        0xF5, 0x57, 0xFF, 0xFF, 0x5F, 0x55, 0x55, 0xFF, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0x57, 0x55,
+    },
+    { // 238: (12, 28)
+        0xFF, 0xFF, 0xFF, 0x57, 0x55, 0x55, 0xFF, 0xF5, 0x5F, 0xFF, 0xF5, 0xFF, 0xFF, 0xFF, 0x57, 0x55,
+        0x55, 0x5F, 0xF5, 0x55, 0xFF, 0x5F, 0x55, 0x55, 0x55, 0x57, 0x57, 0x57, 0x55, 0x55, 0x57, 0x75,
+        0x55, 0x55, 0xFF, 0x5F, 0x55, 0x55, 0x55, 0xF5, 0x57, 0x55, 0x75, 0x75, 0x55, 0x55, 0x75, 0x75,
+        0xF5, 0xFF, 0x55, 0x55, 0x55, 0x55, 0xF5, 0x55, 0x5F, 0xF5, 0xFF, 0x4F, 0x55, 0x55, 0x55, 0x7F,
+        0xF5, 0x57, 0xFF, 0xFF, 0x5F, 0x55, 0x55, 0x7F, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0x55, 0x55,
+    },
+    { // 239: (13, 28)
+        0xAA, 0xAA, 0xAA, 0x55, 0x55, 0x55, 0x6A, 0xA5, 0x56, 0x6A, 0xA5, 0xAA, 0xAA, 0xAA, 0x55, 0x55,
+        0x55, 0x6A, 0xA5, 0x56, 0xAA, 0xAA, 0x5A, 0x55, 0x55, 0x5A, 0x5A, 0xAA, 0x6A, 0x55, 0xAA, 0xA5,
+        0xAA, 0x5A, 0xAA, 0xAA, 0xAA, 0x6A, 0x55, 0x95, 0xAA, 0xAA, 0xA5, 0xA5, 0xAA, 0x56, 0xA5, 0xA5,
+        0xA5, 0xAA, 0xAA, 0x5A, 0x55, 0x55, 0xE5, 0x56, 0x6E, 0xE5, 0xFF, 0x3F, 0x55, 0x55, 0x55, 0x7F,
+        0xF5, 0x57, 0xFF, 0xFF, 0x5F, 0x55, 0x55, 0x7F, 0xF5, 0xFF, 0xFF, 0xFF, 0x55, 0x55, 0x55,
+    },
+    { // 240: (14, 28)
+        0xFF, 0xFF, 0xFF, 0x55, 0x55, 0x55, 0x7F, 0xF5, 0x57, 0x7F, 0xF5, 0xFF, 0xFF, 0x7F, 0x55, 0x55,
+        0x55, 0x7F, 0xF5, 0x57, 0xFF, 0xFF, 0x5F, 0x55, 0x55, 0x5F, 0x5F, 0xFF, 0x5F, 0x55, 0x7F, 0xF5,
+        0x7F, 0x55, 0xFF, 0xFF, 0xFF, 0x55, 0x55, 0x55, 0xFF, 0x57, 0xF5, 0xF5, 0xFF, 0x55, 0xF5, 0xF5,
+        0xF5, 0xFF, 0xFF, 0x5F, 0x55, 0x55, 0xF5, 0x57, 0x7F, 0xF5, 0xFF, 0xFF, 0x54, 0x55, 0x55, 0x7F,
+        0xF5, 0x57, 0xFF, 0xFF, 0x5F, 0x55, 0x55, 0x7F, 0xF5, 0xFF, 0xFF, 0x7F, 0x55, 0x55, 0x55,
+    },
+    { // 241: (15, 28)
+        0xFF, 0xFF, 0xFF, 0x55, 0x55, 0x55, 0x7F, 0xF5, 0x57, 0x7F, 0xF5, 0xFF, 0xFF, 0x5F, 0x55, 0x55,
+        0x55, 0x7F, 0xF5, 0x57, 0xFF, 0xFF, 0x5F, 0x55, 0x55, 0x5F, 0x5F, 0xFF, 0x57, 0x55, 0x5F, 0xF5,
+        0x55, 0x55, 0xFD, 0xFF, 0x57, 0x55, 0x55, 0x55, 0x5F, 0x55, 0xF5, 0xF5, 0x7F, 0x55, 0xF5, 0xF5,
+        0xF5, 0xFF, 0xFF, 0x5F, 0x55, 0x55, 0xF5, 0x57, 0x7F, 0xF5, 0xFF, 0xFF, 0x53, 0x55, 0x55, 0x7F,
+        0xF5, 0x57, 0xFF, 0xFF, 0x5F, 0x55, 0x55, 0x7F, 0xF5, 0xFF, 0xFF, 0x5F, 0x55, 0x55, 0x55,
+    },
+    { // 242: (16, 28)
+        0xFF, 0xFF, 0x7F, 0x55, 0x55, 0x55, 0x5F, 0xF5, 0x55, 0x5F, 0xF5, 0xFF, 0xAF, 0x56, 0x55, 0x55,
+        0x55, 0xAF, 0xF5, 0x5A, 0xFF, 0xAF, 0xAA, 0x5A, 0x55, 0x6B, 0x6B, 0xFF, 0xAA, 0x6A, 0xAF, 0xF6,
+        0xAA, 0x6A, 0xF5, 0xFF, 0xAB, 0xAA, 0x5A, 0x55, 0xAF, 0xAA, 0xF6, 0xF6, 0xAF, 0xAA, 0xF6, 0xF6,
+        0xF6, 0xFF, 0xFF, 0xAF, 0xAA, 0x55, 0xF5, 0x5B, 0xBF, 0xF5, 0xFF, 0xFF, 0x4F, 0x55, 0x55, 0x7F,
+        0xF5, 0x57, 0xFF, 0xFF, 0x5F, 0x55, 0x55, 0x7F, 0xF5, 0xFF, 0x5F, 0x55, 0x55, 0x55, 0x55,
+    },
+    { // 243: (17, 28)
+        0xFF, 0xFF, 0x5F, 0x55, 0x55, 0x55, 0x5F, 0xF5, 0x55, 0x5F, 0xF5, 0xFF, 0xFF, 0x55, 0x55, 0x55,
+        0x55, 0x7F, 0xF5, 0x5F, 0xFF, 0xFF, 0xFF, 0x5F, 0x55, 0x7F, 0x7F, 0xFF, 0xFF, 0x7F, 0xFF, 0xF7,
+        0xFF, 0x7F, 0xD5, 0xFF, 0xFF, 0xFF, 0x57, 0x55, 0xFF, 0xFF, 0xF7, 0xF7, 0xFF, 0xFF, 0xF7, 0xF7,
+        0xF7, 0xFF, 0xFF, 0xFF, 0x7F, 0x55, 0xF5, 0x5F, 0xFF, 0xF5, 0xFF, 0xFF, 0x3F, 0x55, 0x55, 0x7F,
+        0xF5, 0x57, 0xFF, 0xFF, 0x5F, 0x55, 0x55, 0x5F, 0xF5, 0xFF, 0x57, 0x55, 0x55, 0x55, 0x55,
+    },
+    { // 244: (18, 28)
+        0xFF, 0xFF, 0x57, 0x55, 0x55, 0x55, 0x5F, 0xF5, 0x55, 0x5F, 0xF5, 0xFF, 0x7F, 0x55, 0x55, 0x55,
+        0x55, 0x7F, 0xF5, 0x57, 0xFF, 0xFF, 0xFF, 0x5F, 0x55, 0x7F, 0x7F, 0xFF, 0xFF, 0x7F, 0xFF, 0xF7,
+        0xFF, 0x7F, 0x55, 0xFF, 0xFF, 0xFF, 0x55, 0x55, 0xFF, 0xFF, 0xF7, 0xF7, 0xFF, 0xFF, 0xF7, 0xF7,
+        0xF7, 0xFF, 0xFF, 0xFF, 0x5F, 0x55, 0xF5, 0x5F, 0xFF, 0xF5, 0xFF, 0xFF, 0xFF, 0x54, 0x55, 0x7F,
+        0xF5, 0x57, 0xFF, 0xFF, 0x57, 0x55, 0x55, 0x5F, 0xF5, 0xFF, 0x55, 0x55, 0x55, 0x55, 0x55,
+    },
+    { // 245: (19, 28)
+        0xFF, 0xFF, 0x55, 0x55, 0x55, 0x55, 0x5F, 0xF5, 0x55, 0x5F, 0xF5, 0xFF, 0x5F, 0x55, 0x55, 0x55,
+        0x55, 0x5F, 0xF5, 0x55, 0xFF, 0x5F, 0x55, 0x55, 0x55, 0x57, 0x57, 0xFF, 0x55, 0x55, 0x5F, 0xF5,
+        0x55, 0x55, 0x55, 0xFD, 0x57, 0x55, 0x55, 0x55, 0x5F, 0x55, 0xF5, 0xF5, 0x5F, 0x55, 0xF5, 0xF5,
+        0xF5, 0xFF, 0xFF, 0xFF, 0x57, 0x55, 0xF5, 0x5F, 0xFF, 0xF5, 0xFF, 0xFF, 0xFF, 0x53, 0x55, 0x3F,
+        0xF5, 0x53, 0xFF, 0xFF, 0x00, 0x50, 0x55, 0x0F, 0x05, 0x00, 0x00, 0x00, 0x00, 0x55, 0x55,
+    },
+    { // 246: (20, 28)
+        0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+        0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x7D, 0x55, 0x55, 0x5D, 0xD5,
+        0x55, 0x55, 0x55, 0xF5, 0x57, 0x55, 0x55, 0x55, 0x5F, 0x55, 0xF5, 0xF5, 0x57, 0x55, 0xF5, 0xF5,
+        0xF5, 0xFF, 0xFF, 0xFF, 0x55, 0x55, 0xF5, 0x5F, 0xFF, 0xF5, 0xFF, 0xFF, 0xFF, 0x4F, 0x55, 0xFF,
+        0xF5, 0x5F, 0xFF, 0xFF, 0xFF, 0x5F, 0x55, 0xFF, 0xF5, 0xFF, 0xFF, 0xFF, 0x5F, 0x55, 0x55,
+    },
+    { // 247: (21, 28)
+        0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+        0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x5D, 0x55, 0x55, 0x5D, 0xD5,
+        0x55, 0x55, 0x55, 0xD5, 0x57, 0x55, 0x55, 0x55, 0x5D, 0x55, 0xF5, 0xF5, 0x55, 0x55, 0xF5, 0xF5,
+        0xF5, 0xFF, 0xFF, 0x7F, 0x55, 0x55, 0xF5, 0x5F, 0xFF, 0xF5, 0xFF, 0xFF, 0xFF, 0x3F, 0x55, 0xFF,
+        0xF5, 0x5F, 0xFF, 0xFF, 0xFF, 0x5F, 0x55, 0xFF, 0xF5, 0xFF, 0xFF, 0xFF, 0x57, 0x55, 0x55,
+    },
+    { // 248: (22, 28)
+        0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+        0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+        0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xBA, 0xAA, 0xAA, 0xFA, 0xFA,
+        0xFA, 0xFF, 0xFF, 0xAF, 0xAA, 0xAA, 0xFA, 0xAF, 0xFF, 0xFA, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF,
+        0xF0, 0x0F, 0xFF, 0xFF, 0xF0, 0x0F, 0x00, 0xCF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    },
+    { // 249: (25, 28)
+        0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+        0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+        0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x45, 0x55, 0x55, 0x05, 0x05,
+        0x05, 0x00, 0x00, 0x50, 0x55, 0x55, 0x05, 0x40, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    },
+    { // 250: (26, 28)
+        0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+        0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+        0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x75,
+        0xF5, 0xFF, 0xFF, 0x5F, 0x55, 0x55, 0xF5, 0x57, 0x7F, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0x4F, 0xFF,
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    },
+    { // 251: (27, 28)
+        0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+        0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+        0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+        0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xFA, 0xAB, 0xAA, 0xAA, 0xAA, 0x3E, 0xAB,
+        0xBF, 0xFA, 0xFF, 0xFF, 0xBF, 0xFA, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    },
+    { // 252: (4, 29)
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0xA0, 0x2A, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x02, 0xA0, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    },
+    { // 253: (7, 29)
+        0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+        0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+        0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+        0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA8, 0x0A, 0xA8, 0xAA, 0xAA, 0xAA, 0xAA, 0xA0,
+        0x0A, 0xAA, 0x00, 0xA0, 0x0A, 0xA8, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    },
+    { // 254: (10, 29)
+        0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+        0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+        0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+        0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x8A,
+        0xAA, 0xA8, 0xAA, 0x0A, 0x00, 0xA8, 0xAA, 0x0A, 0xA0, 0xAA, 0x02, 0x00, 0x00, 0x00, 0x00,
+    },
+    { // 255: (19, 29)
+        0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+        0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+        0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+        0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x2A,
+        0xAA, 0xA2, 0xAA, 0x2A, 0x00, 0xA0, 0xAA, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0xA8, 0xAA,
+    },
+    { // 256: (22, 29)
+        0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+        0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+        0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+        0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA2, 0xAA, 0xAA, 0xAA, 0xAA, 0x02, 0xAA,
+        0xA0, 0x0A, 0xAA, 0x2A, 0xA0, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    },
+    { // 257: (25, 29)
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0xA8, 0x0A, 0x80, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0xA8, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    },
+    { // 258: (4, 30)
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0xA0, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x02, 0xA0, 0x02, 0x00, 0x00, 0x00, 0x00, 0x02,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    },
+    { // 259: (7, 30)
+        0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+        0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+        0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+        0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x8A, 0xAA, 0xA8, 0x0A, 0xA8, 0xAA, 0xAA, 0xAA, 0x02, 0xA8,
+        0x02, 0x2A, 0x00, 0xA0, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    },
+    { // 260: (10, 30)
+        0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+        0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+        0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+        0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x02, 0xAA,
+        0xA2, 0x28, 0xAA, 0x0A, 0x00, 0x00, 0x00, 0x0A, 0xA0, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00,
+    },
+    { // 261: (19, 30)
+        0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+        0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+        0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+        0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x0A, 0xA8, 0xAA, 0xAA, 0xAA, 0xAA, 0xA8,
+        0x8A, 0xA2, 0x00, 0x00, 0x00, 0xA0, 0xAA, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0xA0, 0xAA,
+    },
+    { // 262: (22, 30)
+        0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+        0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+        0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+        0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x2A, 0xAA, 0x02, 0xA8, 0xAA, 0xAA, 0xAA, 0x02, 0xA8,
+        0x82, 0x0A, 0x00, 0x00, 0x80, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    },
+    { // 263: (25, 30)
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0xA0, 0x0A, 0x80, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0xA8, 0x00,
+        0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    },
+    { // 264: (2, 31)
+        0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+        0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+        0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+        0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x51, 0x55, 0x55, 0x55, 0x55, 0x01, 0x55,
+        0x51, 0x01, 0x54, 0x55, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    },
+    { // 265: (3, 31)
+        0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+        0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+        0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+        0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+        0x55, 0x55, 0x53, 0x55, 0x55, 0x55, 0x55, 0x57, 0xF5, 0x5F, 0x55, 0x55, 0x55, 0x55, 0x55,
+    },
+    { // 266: (4, 31)
+        0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+        0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+        0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+        0xA5, 0x56, 0x55, 0x55, 0x55, 0x55, 0x65, 0x55, 0x56, 0xA5, 0x56, 0x55, 0x55, 0x55, 0x55, 0x56,
+        0x65, 0x55, 0x4F, 0x55, 0x55, 0x55, 0x55, 0x57, 0xF5, 0x57, 0x55, 0x55, 0x55, 0x55, 0x55,
+    },
+    { // 267: (5, 31)
+        0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+        0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+        0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+        0xF5, 0x55, 0x55, 0x55, 0x55, 0x55, 0x75, 0x55, 0x57, 0xF5, 0x57, 0x55, 0x55, 0x55, 0x55, 0x57,
+        0x75, 0x55, 0x3F, 0x55, 0x55, 0x55, 0x55, 0x57, 0xF5, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    },
+    { // 268: (6, 31)
+        0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+        0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+        0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+        0x75, 0x55, 0x55, 0x55, 0x55, 0x55, 0x75, 0x55, 0x57, 0xF5, 0x57, 0x55, 0x55, 0x55, 0x55, 0x57,
+        0x75, 0x55, 0xFF, 0x54, 0x55, 0x55, 0x55, 0x57, 0x75, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    },
+    { // 269: (7, 31)
+        0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+        0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+        0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+        0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xBA, 0xAA, 0xAB, 0xF2, 0xAB, 0xAA, 0xAA, 0xAA, 0x02, 0xAB,
+        0xB2, 0x02, 0xFF, 0xA3, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    },
+    { // 270: (10, 31)
+        0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+        0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+        0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+        0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA6, 0xAA, 0xAA, 0xAA, 0xAA, 0x56, 0xAA,
+        0xA6, 0x56, 0xAA, 0x4A, 0x55, 0x55, 0x55, 0x5A, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    },
+    { // 271: (11, 31)
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0x57, 0x7F,
+        0xF5, 0x57, 0xFF, 0x3F, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    },
+    { // 272: (12, 31)
+        0xFF, 0xFF, 0xFF, 0x7F, 0x55, 0x55, 0xFF, 0xF5, 0x5F, 0xFF, 0xF5, 0xFF, 0xFF, 0xFF, 0x7F, 0x55,
+        0x55, 0xFF, 0xF5, 0x5F, 0xFF, 0xFF, 0xFF, 0x5F, 0x55, 0x7F, 0x7F, 0xFF, 0xFF, 0x7F, 0xFF, 0xF7,
+        0xFF, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0x5F, 0xFF, 0xFF, 0xFF, 0xF7, 0xF7, 0xFF, 0xFF, 0xF7, 0xF7,
+        0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0x55, 0xF5, 0x5F, 0xFF, 0x55, 0xFD, 0xFF, 0xFF, 0x57, 0x55, 0x7D,
+        0xD5, 0x57, 0x55, 0xF5, 0x54, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    },
+    { // 273: (13, 31)
+        0xFF, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0xFF, 0xF0, 0x0F, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0x0F, 0x00,
+        0x00, 0x3F, 0xF0, 0x0F, 0xFF, 0xFF, 0xFF, 0x0F, 0x00, 0x3F, 0x3F, 0xFF, 0xFF, 0x3F, 0xFF, 0xF3,
+        0xFF, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0xFC, 0xFF, 0xFF, 0xF3, 0xF3, 0xFF, 0xFF, 0xF3, 0xF3,
+        0xF3, 0xFF, 0xFF, 0xFF, 0x3F, 0x00, 0xF0, 0x0F, 0xFC, 0x00, 0xFC, 0xFF, 0xFF, 0x00, 0x00, 0x3C,
+        0x00, 0x03, 0x00, 0xF0, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    },
+    { // 274: (16, 31)
+        0x00, 0x00, 0x50, 0x55, 0x55, 0x55, 0x50, 0x05, 0x55, 0x50, 0x05, 0x00, 0x00, 0x55, 0x55, 0x55,
+        0x55, 0x40, 0x05, 0x55, 0x00, 0x50, 0x55, 0x55, 0x55, 0x54, 0x54, 0x54, 0x55, 0x55, 0x54, 0x45,
+        0x55, 0x55, 0x15, 0x40, 0x55, 0x55, 0x55, 0x55, 0x54, 0x55, 0x45, 0x45, 0x55, 0x55, 0x45, 0x45,
+        0x05, 0x00, 0x54, 0x55, 0x55, 0x55, 0x05, 0x55, 0x50, 0x01, 0x00, 0x50, 0x55, 0x55, 0x01, 0x40,
+        0x01, 0x04, 0x00, 0x00, 0x40, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    },
+    { // 275: (17, 31)
+        0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+        0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+        0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+        0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x75, 0x55, 0x57, 0xF5, 0x57, 0x55, 0x55, 0x55, 0x55, 0x7F,
+        0xF5, 0x57, 0xFF, 0xFF, 0x3F, 0x55, 0x55, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    },
+    { // 276: (18, 31)
+        0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+        0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+        0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+        0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x57, 0xF5, 0x57, 0x55, 0x55, 0x55, 0x55, 0x57,
+        0xF5, 0x57, 0xFF, 0xFF, 0xFF, 0x54, 0x55, 0xFF, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    },
+    { // 277: (19, 31)
+        0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+        0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+        0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+        0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xFA, 0xAB, 0xAA, 0xAA, 0xAA, 0xAA, 0xAB,
+        0xBA, 0xAA, 0xFF, 0xFF, 0xFF, 0xA3, 0xAA, 0xFF, 0xFA, 0xFF, 0xFF, 0xFF, 0xFF, 0xAF, 0xAA,
+    },
+    { // 278: (22, 31)
+        0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+        0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+        0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+        0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA6, 0x6A, 0xA8, 0x06, 0xA8, 0xAA, 0xAA, 0xAA, 0x56, 0xA8,
+        0x06, 0x68, 0x00, 0x00, 0x00, 0x4A, 0x55, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    },
+    { // 279: (23, 31)
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF5, 0x7F, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0x57, 0xFF,
+        0xF7, 0x7F, 0xFF, 0xFF, 0xFF, 0x3F, 0x55, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5F,
+    },
+    { // 280: (24, 31)
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0xF5, 0x7F, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0x57, 0xFF,
+        0xF7, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0x54, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x57,
+    },
+    { // 281: (25, 31)
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAF, 0xFA, 0xBF, 0xFF, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xAB, 0xFF,
+        0xFB, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0x53, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x55,
+    },
+    { // 282: (26, 31)
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x4F, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0x55,
+    },
+    { // 283: (27, 31)
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x0F, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC,
+        0x0F, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0x3F, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    },
+    { // 284: (2, 32)
+        0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+        0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+        0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+        0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x2A, 0xAA, 0xA2, 0xAA, 0xAA, 0xAA, 0xAA, 0x02, 0x2A,
+        0xA0, 0x02, 0xAA, 0x2A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    },
+    { // 285: (7, 32)
+        0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+        0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+        0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+        0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x2A, 0xAA, 0xA2, 0xAA, 0xAA, 0xAA, 0xAA, 0x02, 0x2A,
+        0xA0, 0x02, 0xAA, 0x2A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    },
+    { // 286: (13, 32)
+        0xAA, 0xAA, 0xAA, 0x02, 0x00, 0x00, 0xAA, 0xA0, 0x0A, 0xAA, 0xA0, 0xAA, 0xAA, 0xAA, 0x02, 0x00,
+        0x00, 0x2A, 0xA0, 0x02, 0xAA, 0xAA, 0xAA, 0x0A, 0x00, 0x2A, 0x2A, 0xAA, 0xAA, 0x2A, 0xAA, 0xA2,
+        0xAA, 0x2A, 0xAA, 0xAA, 0xAA, 0xAA, 0x00, 0xA0, 0xAA, 0xAA, 0xA2, 0xA2, 0xAA, 0xAA, 0xA2, 0xA2,
+        0xA2, 0xAA, 0xAA, 0xAA, 0x0A, 0x00, 0x80, 0x0A, 0xA8, 0x00, 0xA8, 0xAA, 0x2A, 0x00, 0x00, 0x20,
+        0x00, 0x02, 0x00, 0xA0, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    },
+    { // 287: (16, 32)
+        0x00, 0x00, 0x80, 0xAA, 0xAA, 0xAA, 0xA0, 0x0A, 0xAA, 0xA0, 0x0A, 0x00, 0x00, 0xA8, 0xAA, 0xAA,
+        0xAA, 0x80, 0x0A, 0xA8, 0x00, 0xA0, 0xAA, 0xAA, 0xAA, 0xA8, 0xA8, 0xA8, 0xAA, 0xAA, 0xA8, 0x8A,
+        0xAA, 0xAA, 0x0A, 0x00, 0xAA, 0xAA, 0xAA, 0xAA, 0xA8, 0xAA, 0x8A, 0x8A, 0xAA, 0xAA, 0x8A, 0x8A,
+        0x0A, 0x00, 0xA0, 0xAA, 0xAA, 0xAA, 0x0A, 0x2A, 0xA0, 0x02, 0x00, 0x80, 0xAA, 0xAA, 0x02, 0x80,
+        0x00, 0x08, 0x00, 0x00, 0xA0, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    },
+    { // 288: (22, 32)
+        0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+        0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+        0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+        0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x8A, 0xAA, 0xA8, 0x0A, 0xA8, 0xAA, 0xAA, 0xAA, 0xAA, 0x80,
+        0x0A, 0xA8, 0x00, 0x00, 0x00, 0xA8, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    },
+    { // 289: (27, 32)
+        0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+        0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+        0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+        0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x8A, 0xAA, 0xA8, 0x0A, 0xA8, 0xAA, 0xAA, 0xAA, 0xAA, 0x80,
+        0x0A, 0xA8, 0x00, 0x00, 0x00, 0xA8, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    },
+    { // 290: (2, 33)
+        0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+        0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+        0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+        0xA5, 0x56, 0x55, 0x55, 0x55, 0x55, 0x65, 0x55, 0x56, 0xA5, 0x56, 0x55, 0x55, 0x55, 0x55, 0x56,
+        0x65, 0x55, 0xAA, 0x56, 0x55, 0x55, 0x55, 0x56, 0x45, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    },
+    { // 291: (3, 33)
+        0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+        0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+        0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+        0xF5, 0x55, 0x55, 0x55, 0x55, 0x55, 0x75, 0x55, 0x57, 0xF5, 0x57, 0x55, 0x55, 0x55, 0x55, 0x57,
+        0x75, 0x55, 0xFF, 0x55, 0x55, 0x55, 0x55, 0x57, 0x35, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    },
+    { // 292: (4, 33)
+        0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+        0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+        0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+        0x75, 0x55, 0x55, 0x55, 0x55, 0x55, 0x75, 0x55, 0x57, 0xF5, 0x57, 0x55, 0x55, 0x55, 0x55, 0x57,
+        0x75, 0x55, 0x7F, 0x55, 0x55, 0x55, 0x55, 0x57, 0xF5, 0x54, 0x55, 0x55, 0x55, 0x55, 0x55,
+    },
+    { // 293: (5, 33)
+        0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+        0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+        0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+        0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+        0x55, 0x55, 0x5F, 0x55, 0x55, 0x55, 0x55, 0x57, 0xF5, 0x53, 0x55, 0x55, 0x55, 0x55, 0x55,
+    },
+    { // 294: (6, 33)
+        0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+        0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+        0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+        0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+        0x55, 0x55, 0x57, 0x55, 0x55, 0x55, 0x55, 0x57, 0xF5, 0x4F, 0x55, 0x55, 0x55, 0x55, 0x55,
+    },
+    { // 295: (7, 33)
+        0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+        0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+        0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA6, 0xAA, 0xAA, 0xA6, 0xA6,
+        0xA6, 0xAA, 0xAA, 0xAA, 0xAA, 0x55, 0xA5, 0x5A, 0xAA, 0xA5, 0xAA, 0xAA, 0xAA, 0x56, 0x55, 0x6A,
+        0xA5, 0x56, 0xAA, 0x5A, 0x55, 0x55, 0x55, 0x5B, 0xF5, 0x3F, 0x55, 0x55, 0x55, 0x55, 0x55,
+    },
+    { // 296: (8, 33)
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xF7, 0xFF, 0xFF, 0xF7, 0xF7,
+        0xF7, 0xFF, 0xFF, 0xFF, 0x7F, 0x55, 0xF5, 0x5F, 0xFF, 0xF5, 0xFF, 0xFF, 0xFF, 0x55, 0x55, 0x7F,
+        0xF5, 0x55, 0xFF, 0x5F, 0x55, 0x55, 0x55, 0x5F, 0xF5, 0xFF, 0x54, 0x55, 0x55, 0x55, 0x55,
+    },
+    { // 297: (9, 33)
+        0xFF, 0xFF, 0xFF, 0xFF, 0x55, 0x55, 0xFF, 0xF5, 0x5F, 0xFF, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0x55,
+        0x55, 0xFF, 0xF5, 0x5F, 0xFF, 0xFF, 0xFF, 0x5F, 0x55, 0x7F, 0x7F, 0xFF, 0xFF, 0x7F, 0xFF, 0xF7,
+        0xFF, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xD5, 0xFF, 0xFF, 0xFF, 0xF7, 0xF7, 0xFF, 0xFF, 0xF7, 0xF7,
+        0xF7, 0xFF, 0xFF, 0xFF, 0x5F, 0x55, 0xF5, 0x5F, 0xFF, 0xF5, 0xFF, 0xFF, 0x7F, 0x55, 0x55, 0x5F,
+        0xF5, 0x55, 0xFF, 0x5F, 0x55, 0x55, 0x55, 0x5F, 0xF5, 0xFF, 0x53, 0x55, 0x55, 0x55, 0x55,
+    },
+    { // 298: (10, 33)
+        0xFF, 0xFF, 0xFF, 0x7F, 0x55, 0x55, 0xFF, 0xF5, 0x5F, 0xFF, 0xF5, 0xFF, 0xFF, 0xFF, 0x7F, 0x55,
+        0x55, 0xFF, 0xF5, 0x5F, 0xFF, 0xFF, 0xFF, 0x5F, 0x55, 0x7F, 0x7F, 0xFF, 0xFF, 0x5F, 0xFF, 0xF5,
+        0xFF, 0x5F, 0xFF, 0xFF, 0xFF, 0x7F, 0x55, 0xFF, 0xFF, 0xFF, 0xF5, 0xF5, 0xFF, 0xFF, 0xF5, 0xF5,
+        0xF5, 0xFF, 0xFF, 0x57, 0x55, 0x55, 0xF5, 0x55, 0x5F, 0xF5, 0xFF, 0x55, 0x55, 0x55, 0x55, 0x5F,
+        0xF5, 0x55, 0xFF, 0x5F, 0x55, 0x55, 0x55, 0x5F, 0xF5, 0xFF, 0x4F, 0x55, 0x55, 0x55, 0x55,
+    },
+    { // 299: (11, 33)
+        0xFF, 0xFF, 0xFF, 0x5F, 0x55, 0x55, 0xFF, 0xF5, 0x5F, 0xFF, 0xF5, 0xFF, 0xFF, 0xFF, 0x5F, 0x55,
+        0x55, 0x7F, 0xF5, 0x5F, 0xFF, 0xFF, 0xFF, 0x5F, 0x55, 0x7F, 0x7F, 0xFF, 0xFF, 0x57, 0xFF, 0xF5,
+        0xFF, 0x5F, 0xFF, 0xFF, 0xFF, 0x7F, 0x55, 0xFD, 0xFF, 0xFF, 0xF5, 0xF5, 0xFF, 0x7F, 0xF5, 0xF5,
+        0xF5, 0xFF, 0xFF, 0x55, 0x55, 0x55, 0xF5, 0x55, 0x5F, 0xF5, 0x7F, 0x55, 0x55, 0x55, 0x55, 0x5F,
+        0xF5, 0x55, 0xFF, 0x5F, 0x55, 0x55, 0x55, 0x5F, 0xF5, 0xFF, 0x3F, 0x55, 0x55, 0x55, 0x55,
+    },
+    { // 300: (12, 33)
+        0xFF, 0xFF, 0xFF, 0x57, 0x55, 0x55, 0xFF, 0xF5, 0x5F, 0xFF, 0xF5, 0xFF, 0xFF, 0xFF, 0x57, 0x55,
+        0x55, 0x7F, 0xF5, 0x57, 0xFF, 0xFF, 0xFF, 0x5F, 0x55, 0x7F, 0x7F, 0xFF, 0xFF, 0x55, 0xFF, 0xF5,
+        0xFF, 0x5F, 0xFF, 0xFF, 0xFF, 0x7F, 0x55, 0xF5, 0xFF, 0xFF, 0xF5, 0xF5, 0xFF, 0x5F, 0xF5, 0xF5,
+        0xF5, 0xFF, 0x7F, 0x55, 0x55, 0x55, 0xF5, 0x55, 0x5F, 0xF5, 0x5F, 0x55, 0x55, 0x55, 0x55, 0x5F,
+        0xF5, 0x55, 0xFF, 0x5F, 0x55, 0x55, 0x55, 0x5F, 0xF5, 0xFF, 0xFF, 0x54, 0x55, 0x55, 0x55,
+    },
+    { // 301: (13, 33)
+        0xAA, 0xAA, 0xAA, 0x55, 0x55, 0x55, 0x6A, 0xA5, 0x56, 0x6A, 0xA5, 0xAA, 0xAA, 0xAA, 0x55, 0x55,
+        0x55, 0x6A, 0xA5, 0x56, 0xAA, 0xAA, 0x5A, 0x55, 0x55, 0x5A, 0x5A, 0xAA, 0x6A, 0x55, 0xAA, 0xA5,
+        0xAA, 0x5A, 0xAA, 0xAA, 0xAA, 0x6A, 0x55, 0x95, 0xAA, 0xAA, 0xA5, 0xA5, 0xAA, 0x56, 0xA5, 0xA5,
+        0xA5, 0xAA, 0xAA, 0x5A, 0x55, 0x55, 0xB5, 0x56, 0x6B, 0xF5, 0xAB, 0xAA, 0x5A, 0x55, 0x55, 0x6F,
+        0xF5, 0x56, 0xFF, 0xAF, 0x5A, 0x55, 0x55, 0x6F, 0xF5, 0xFF, 0xFF, 0x53, 0x55, 0x55, 0x55,
+    },
+    { // 302: (14, 33)
+        0xFF, 0xFF, 0xFF, 0x55, 0x55, 0x55, 0x7F, 0xF5, 0x57, 0x7F, 0xF5, 0xFF, 0xFF, 0x7F, 0x55, 0x55,
+        0x55, 0x7F, 0xF5, 0x57, 0xFF, 0xFF, 0x5F, 0x55, 0x55, 0x5F, 0x5F, 0xFF, 0x5F, 0x55, 0x7F, 0xF5,
+        0x7F, 0x55, 0xFF, 0xFF, 0xFF, 0x55, 0x55, 0x55, 0xFF, 0x57, 0xF5, 0xF5, 0xFF, 0x55, 0xF5, 0xF5,
+        0xF5, 0xFF, 0xFF, 0x5F, 0x55, 0x55, 0xF5, 0x57, 0x7F, 0xF5, 0xFF, 0xFF, 0x57, 0x55, 0x55, 0x7F,
+        0xF5, 0x57, 0xFF, 0xFF, 0x5F, 0x55, 0x55, 0x7F, 0xF5, 0xFF, 0xFF, 0x4F, 0x55, 0x55, 0x55,
+    },
+    { // 303: (15, 33)
+        0xFF, 0xFF, 0xFF, 0x55, 0x55, 0x55, 0x7F, 0xF5, 0x57, 0x7F, 0xF5, 0xFF, 0xFF, 0x5F, 0x55, 0x55,
+        0x55, 0x7F, 0xF5, 0x57, 0xFF, 0xFF, 0x5F, 0x55, 0x55, 0x5F, 0x5F, 0xFF, 0x57, 0x55, 0x5F, 0xF5,
+        0x55, 0x55, 0xFD, 0xFF, 0x57, 0x55, 0x55, 0x55, 0x5F, 0x55, 0xF5, 0xF5, 0x7F, 0x55, 0xF5, 0xF5,
+        0xF5, 0xFF, 0xFF, 0x5F, 0x55, 0x55, 0xF5, 0x57, 0x7F, 0xF5, 0xFF, 0xFF, 0x55, 0x55, 0x55, 0x7F,
+        0xF5, 0x57, 0xFF, 0xFF, 0x5F, 0x55, 0x55, 0x7F, 0xF5, 0xFF, 0xFF, 0x3F, 0x55, 0x55, 0x55,
+    },
+    { // 304: (16, 33)
+        0xFF, 0xFF, 0x7F, 0x55, 0x55, 0x55, 0x5F, 0xF5, 0x55, 0x5F, 0xF5, 0xFF, 0xFF, 0x57, 0x55, 0x55,
+        0x55, 0x7F, 0xF5, 0x57, 0xFF, 0x5F, 0x55, 0x55, 0x55, 0x57, 0x57, 0xAB, 0x55, 0x55, 0x5B, 0xB5,
+        0x55, 0x55, 0xF5, 0xFF, 0x56, 0x55, 0x55, 0x55, 0x5B, 0x55, 0xB5, 0xB5, 0x5A, 0x55, 0xB5, 0xB5,
+        0xF5, 0xFF, 0xAF, 0xAA, 0x56, 0x55, 0xF5, 0x5A, 0xAF, 0xF5, 0xFF, 0xBF, 0xAA, 0xAA, 0x55, 0xBF,
+        0xF5, 0x5B, 0xFF, 0xFF, 0xAF, 0x5A, 0x55, 0xBF, 0xF5, 0xFF, 0xFF, 0xFF, 0x54, 0x55, 0x55,
+    },
+    { // 305: (17, 33)
+        0xFF, 0xFF, 0x5F, 0x55, 0x55, 0x55, 0x5F, 0xF5, 0x55, 0x5F, 0xF5, 0xFF, 0xFF, 0x55, 0x55, 0x55,
+        0x55, 0x7F, 0xF5, 0x55, 0xFF, 0x5F, 0x55, 0x55, 0x55, 0x57, 0x57, 0x7F, 0x55, 0x55, 0x5F, 0xF5,
+        0x55, 0x55, 0xD5, 0xFF, 0x57, 0x55, 0x55, 0x55, 0x5F, 0x55, 0xF5, 0xF5, 0x57, 0x55, 0xF5, 0xF5,
+        0xF5, 0xFF, 0xFF, 0xFF, 0x55, 0x55, 0xF5, 0x5F, 0xFF, 0xF5, 0xFF, 0xFF, 0xFF, 0x7F, 0x55, 0xFF,
+        0xF5, 0x5F, 0xFF, 0xFF, 0xFF, 0x5F, 0x55, 0xFF, 0xF5, 0xFF, 0xFF, 0xFF, 0x53, 0x55, 0x55,
+    },
+    { // 306: (18, 33)
+        0xFF, 0xFF, 0x57, 0x55, 0x55, 0x55, 0x5F, 0xF5, 0x55, 0x5F, 0xF5, 0xFF, 0x7F, 0x55, 0x55, 0x55,
+        0x55, 0x5F, 0xF5, 0x55, 0xFF, 0x5F, 0x55, 0x55, 0x55, 0x57, 0x57, 0x5F, 0x55, 0x55, 0x5F, 0xF5,
+        0x55, 0x55, 0x55, 0xFF, 0x57, 0x55, 0x55, 0x55, 0x5F, 0x55, 0xF5, 0xF5, 0x55, 0x55, 0xF5, 0xF5,
+        0xF5, 0xFF, 0xFF, 0x7F, 0x55, 0x55, 0xF5, 0x5F, 0xFF, 0xF5, 0xFF, 0xFF, 0xFF, 0x5F, 0x55, 0xFF,
+        0xF5, 0x5F, 0xFF, 0xFF, 0xFF, 0x5F, 0x55, 0xFF, 0xF5, 0xFF, 0xFF, 0xFF, 0x4F, 0x55, 0x55,
+    },
+    { // 307: (19, 33)
+        0xFF, 0xFF, 0x55, 0x55, 0x55, 0x55, 0x5F, 0xF5, 0x55, 0x5F, 0xF5, 0xFF, 0x5F, 0x55, 0x55, 0x55,
+        0x55, 0x5F, 0xF5, 0x55, 0xFF, 0x5F, 0x55, 0x55, 0x55, 0x57, 0x57, 0x57, 0x55, 0x55, 0x57, 0x75,
+        0x55, 0x55, 0x55, 0xFD, 0x55, 0x55, 0x55, 0x55, 0x57, 0x55, 0x75, 0x75, 0x55, 0x55, 0x75, 0x75,
+        0xF5, 0xFF, 0x5F, 0x55, 0x55, 0x55, 0xF5, 0x55, 0x5F, 0xF5, 0xFF, 0x7F, 0x55, 0x55, 0x55, 0xFF,
+        0xF5, 0x5F, 0xFF, 0xFF, 0xFF, 0x5F, 0x55, 0xFF, 0xF5, 0xFF, 0xFF, 0xFF, 0x3F, 0x55, 0x55,
+    },
+    { // 308: (20, 33)
+        0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+        0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+        0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x57, 0x55, 0x75, 0x75, 0x55, 0x55, 0x75, 0x75,
+        0xF5, 0xFF, 0x57, 0x55, 0x55, 0x55, 0xF5, 0x55, 0x5F, 0xF5, 0xFF, 0x5F, 0x55, 0x55, 0x55, 0x7F,
+        0xF5, 0x5F, 0xFF, 0xFF, 0xFF, 0x5F, 0x55, 0xFF, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0x54, 0x55,
+    },
+    { // 309: (21, 33)
+        0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+        0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+        0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x75, 0x75, 0x55, 0x55, 0x75, 0x75,
+        0xF5, 0xFF, 0x55, 0x55, 0x55, 0x55, 0xF5, 0x55, 0x5F, 0xF5, 0xFF, 0x57, 0x55, 0x55, 0x55, 0x7F,
+        0xF5, 0x57, 0xFF, 0xFF, 0xFF, 0x5F, 0x55, 0xFF, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0x53, 0x55,
+    },
+    { // 310: (22, 33)
+        0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+        0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+        0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+        0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xBA, 0xAA, 0xAB, 0xFA, 0xAB, 0xAA, 0xAA, 0xAA, 0xAA, 0xBF,
+        0xFA, 0xAB, 0xFF, 0xFF, 0xFF, 0xAB, 0x6A, 0xFF, 0xF6, 0xFF, 0xFF, 0xFF, 0xFF, 0x4F, 0x55,
+    },
+    { // 311: (23, 33)
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5F, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0x55,
+    },
+    { // 312: (24, 33)
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0x7F, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0x57, 0xFF,
+        0xF7, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0x57, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x54,
+    },
+    { // 313: (25, 33)
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF5, 0x7F, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0x57, 0xFF,
+        0xF7, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0x55, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x53,
+    },
+    { // 314: (26, 33)
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0xF5, 0x7F, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0x57, 0xFF,
+        0xF7, 0x7F, 0xFF, 0xFF, 0xFF, 0x7F, 0x55, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x4F,
+    },
+    { // 315: (27, 33)
+        0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+        0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+        0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+        0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xBA, 0xAA, 0xAB, 0xFA, 0xAB, 0xAA, 0xAA, 0xAA, 0xAA, 0xBF,
+        0xFA, 0xAB, 0xFF, 0xFF, 0xFF, 0xAB, 0xAA, 0xFF, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F,
+    },
+};
+
+#endif /* USE_NEXTHOP_TABLE */
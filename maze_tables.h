@@ -0,0 +1,42 @@
+/*********************************************************************************************************
+**--------------File Info---------------------------------------------------------------------------------
+** File name:           maze_tables.h
+** Descriptions:        Precomputed ghost routes for the static maze
+**                      GENERATED by tools/gen_maze_tables.py from game_map in game.c - do not edit.
+** Correlated files:    maze_tables.c, functions.h, blinky.c
+**--------------------------------------------------------------------------------------------------------
+*********************************************************************************************************/
+
+#ifndef __MAZE_TABLES_H
+#define __MAZE_TABLES_H
+
+#include <stdint.h>
+
+/* Flash usage:
+**   ghost cells               316
+**   maze_cell_index          2400 bytes
+**   nexthop_table           24964 bytes (USE_NEXTHOP_TABLE 1 only)
+**   static_fields            1580 bytes
+**   landmark_dist            2528 bytes (USE_LANDMARKS 1 only)
+**   ghost_exits              1200 bytes
+**   total flash, USE_NEXTHOP_TABLE 1 USE_LANDMARKS 1   32672 bytes
+**   total flash, USE_NEXTHOP_TABLE 1 USE_LANDMARKS 0   30144 bytes
+**   total flash, USE_NEXTHOP_TABLE 0 USE_LANDMARKS 1    7708 bytes
+**   total flash, USE_NEXTHOP_TABLE 0 USE_LANDMARKS 0    5180 bytes
+*/
+
+#define MAZE_CELLS          316       // Cells reachable by a ghost
+#define MAZE_NO_CELL        0xFFFF    // maze_cell_index value for walls and unreachable cells
+#define NEXTHOP_ROW_BYTES   79        // Bytes per source cell (4 targets per byte)
+#define NEXTHOP_TABLE_BYTES 24964     // Size of nexthop_table
+#define STATIC_FIELDS       5         // Fixed targets with a field in static_fields
+
+extern const uint16_t maze_cell_index[40][30];
+extern const uint8_t nexthop_table[MAZE_CELLS][NEXTHOP_ROW_BYTES];
+extern const uint8_t static_field_target[STATIC_FIELDS][2];
+extern const uint8_t static_fields[STATIC_FIELDS][MAZE_CELLS];
+extern const uint8_t landmark_cell[8][2];
+extern const uint8_t landmark_dist[MAZE_CELLS][8];
+extern const uint8_t ghost_exits[40][30];
+
+#endif /* __MAZE_TABLES_H */
@@ -13,10 +13,8 @@ void lose_life() {
 		find_lock = LOCK_ACQUIRED;
 		move_lock = LOCK_ACQUIRED;
     
-    // Reset Pacman and Blinky's positions on the map
+    // Reset Pacman's position on the map
     game_map[pacman_y][pacman_x] = EMPTY;
-    game_map[blinky_y][blinky_x] = EMPTY;
-		previous_cell = EMPTY;
     
     // Reset Pacman's position to starting coordinates
     pacman_x = 14;
@@ -30,13 +28,11 @@ void lose_life() {
         return;
     }
 		
-		// Reset Blinky's position to starting coordinates
-    blinky_x = 14;
-    blinky_y = 19;
-    game_map[blinky_y][blinky_x] = BLINKY;
+		// Send the ghosts back to the ghost house
+    ghosts_reset();
     
     // Redraw the game screen and update the pathfinding
-		find_path();
+		request_replan();
     draw_screen();
 		
 		find_lock = LOCK_RELEASED;
@@ -49,33 +45,42 @@ void lose_life() {
 }
 
 // Function to handle when Pacman eats a ghost
-void eat_ghost() {
-    // Disable the timer for ghost behavior
-    disable_timer(2);
-    reset_timer(2);
-    
+void eat_ghost(Ghost *ghost) {
     // Update score when ghost is eaten
     score += 100;
-    sprintf(s_str, "%d", score);
-    GUI_Text(180, 16, (uint8_t*)s_str, Black, Black);
-    GUI_Text(180, 16, (uint8_t*)s_str, White, Black);
+    render_post(RENDER_SCORE);  // The next frame shows it
     
-    // Reset Blinky's position to starting coordinates
-    blinky_x = 14;
-    blinky_y = 19;
-    game_map[blinky_y][blinky_x] = BLINKY;
+    // Only the eyes are left: they walk back to the ghost house down its baked distance field
+    ghost->mode = GHOST_EATEN;
     
     // Update pathfinding after eating ghost
-    find_path();
+    request_replan();
     
-    is_blinky_eaten = 1; 				// Mark Blinky as eaten
+    is_ghost_eaten = 1; 				// Mark a ghost as eaten
+}
+
+// Heading (DIR_*) and mouth of Pac-Man: the mouth opens and closes over four steps
+static int pacman_heading = DIR_LEFT;
+static int pacman_phase = 0;
+
+// Function to get the sprite (SPRITE_*) Pac-Man is drawn with
+int pacman_sprite() {
+    int frame = pacman_phase == 3 ? 1 : pacman_phase;  // Closed, half open, open, half open
+
+    return SPRITE_PACMAN + pacman_heading * PACMAN_FRAMES + frame;
+}
+
+// Function to turn Pac-Man towards dir and move his mouth on by one step
+static void pacman_step(int dir) {
+    pacman_heading = dir;
+    pacman_phase = (pacman_phase + 1) & 3;
 }
 
 // Function to handle Pacman's movement
 void move_pacman() {
-    // Calculate current pixel position based on Pacman's cell coordinates
-    int x_current = pacman_x * CELL_SIZE;
-    int y_current = pacman_y * CELL_SIZE;
+    // Pacman's current cell
+    int x_current = pacman_x;
+    int y_current = pacman_y;
     int x_updated, y_updated;
 
     // Handle different movement commands
@@ -91,17 +96,18 @@ void move_pacman() {
                 // Compute score based on new position
                 compute_score(pacman_x, pacman_y-1);
                 
-                // Update new pixel coordinates for display
-                x_updated = pacman_x * CELL_SIZE;
-                y_updated = (pacman_y-1) * CELL_SIZE;
+                // New cell, to redraw
+                x_updated = pacman_x;
+                y_updated = pacman_y-1;
                 
                 // Update game map with new Pacman position
                 game_map[pacman_y][pacman_x] = EMPTY;
                 game_map[pacman_y-1][pacman_x] = PACMAN;
                 
-                // Update screen with Pacman's movement
-                draw_circle(x_current+4, y_current+4, 4, Black);  // Clear old position
-                draw_circle(x_updated+4, y_updated+4, 4, Yellow);  // Draw new position
+                // Redraw both cells on the next frame
+                pacman_step(DIR_UP);
+                render_mark(x_current, y_current);  // Clear old position
+                render_mark(x_updated, y_updated);  // Draw new position
                 
                 // Update Pacman's coordinates
                 pacman_y--;
@@ -122,17 +128,18 @@ void move_pacman() {
                 // Compute score based on new position
                 compute_score(pacman_x, pacman_y+1);
                 
-                // Update new pixel coordinates for display
-                x_updated = pacman_x * CELL_SIZE;
-                y_updated = (pacman_y+1) * CELL_SIZE;
+                // New cell, to redraw
+                x_updated = pacman_x;
+                y_updated = pacman_y+1;
                 
                 // Update game map with new Pacman position
                 game_map[pacman_y][pacman_x] = EMPTY;
                 game_map[pacman_y+1][pacman_x] = PACMAN;
                 
-                // Update screen with Pacman's movement
-                draw_circle(x_current+4, y_current+4, 4, Black);  // Clear old position
-                draw_circle(x_updated+4, y_updated+4, 4, Yellow);  // Draw new position
+                // Redraw both cells on the next frame
+                pacman_step(DIR_DOWN);
+                render_mark(x_current, y_current);  // Clear old position
+                render_mark(x_updated, y_updated);  // Draw new position
                 
                 // Update Pacman's coordinates
                 pacman_y++;
@@ -148,16 +155,17 @@ void move_pacman() {
                 
                 // Teleport Pacman to the right side of the map
                 game_map[pacman_y][pacman_x] = EMPTY;
-                pacman_x = COLS - 3;  // Teleport to the right edge
-                x_updated = pacman_x * CELL_SIZE;
-                y_updated = pacman_y * CELL_SIZE;
+                pacman_x = TUNNEL_RIGHT_X;  // Teleport to the right edge
+                x_updated = pacman_x;
+                y_updated = pacman_y;
                 
                 // Update game map with new Pacman position
                 game_map[pacman_y][pacman_x] = PACMAN;
                 
-                // Update screen with Pacman's movement
-                draw_circle(x_current+4, y_current+4, 4, Black);  // Clear old position
-                draw_circle(x_updated+4, y_updated+4, 4, Yellow);  // Draw new position
+                // Redraw both cells on the next frame
+                pacman_step(DIR_LEFT);
+                render_mark(x_current, y_current);  // Clear old position
+                render_mark(x_updated, y_updated);  // Draw new position
                 
                 enable_timer(0);  // Re-enable timer for game processing
             }
@@ -171,17 +179,18 @@ void move_pacman() {
                 // Compute score based on new position
                 compute_score(pacman_x-1, pacman_y);
                 
-                // Update new pixel coordinates for display
-                x_updated = (pacman_x-1) * CELL_SIZE;
-                y_updated = pacman_y * CELL_SIZE;
+                // New cell, to redraw
+                x_updated = pacman_x-1;
+                y_updated = pacman_y;
                 
                 // Update game map with new Pacman position
                 game_map[pacman_y][pacman_x] = EMPTY;
                 game_map[pacman_y][pacman_x-1] = PACMAN;
                 
-                // Update screen with Pacman's movement
-                draw_circle(x_current+4, y_current+4, 4, Black);  // Clear old position
-                draw_circle(x_updated+4, y_updated+4, 4, Yellow);  // Draw new position
+                // Redraw both cells on the next frame
+                pacman_step(DIR_LEFT);
+                render_mark(x_current, y_current);  // Clear old position
+                render_mark(x_updated, y_updated);  // Draw new position
                 
                 // Update Pacman's coordinates
                 pacman_x--;
@@ -197,16 +206,17 @@ void move_pacman() {
                 
                 // Teleport Pacman to the left side of the map
 								game_map[pacman_y][pacman_x] = EMPTY;
-                pacman_x = 2;  // Teleport to the left edge
-                x_updated = pacman_x * CELL_SIZE;
-                y_updated = pacman_y * CELL_SIZE;
+                pacman_x = TUNNEL_LEFT_X;  // Teleport to the left edge
+                x_updated = pacman_x;
+                y_updated = pacman_y;
                 
                 // Update game map with new Pacman position
                 game_map[pacman_y][pacman_x] = PACMAN;
                 
-                // Update screen with Pacman's movement
-                draw_circle(x_current+4, y_current+4, 4, Black);  // Clear old position
-                draw_circle(x_updated+4, y_updated+4, 4, Yellow);  // Draw new position
+                // Redraw both cells on the next frame
+                pacman_step(DIR_RIGHT);
+                render_mark(x_current, y_current);  // Clear old position
+                render_mark(x_updated, y_updated);  // Draw new position
                 
                 enable_timer(0);  // Re-enable timer for game processing
             }
@@ -220,17 +230,18 @@ void move_pacman() {
                 // Compute score based on new position
                 compute_score(pacman_x+1, pacman_y);
                 
-                // Update new pixel coordinates for display
-                x_updated = (pacman_x+1) * CELL_SIZE;
-                y_updated = pacman_y * CELL_SIZE;
+                // New cell, to redraw
+                x_updated = pacman_x+1;
+                y_updated = pacman_y;
                 
                 // Update game map with new Pacman position
                 game_map[pacman_y][pacman_x] = EMPTY;
                 game_map[pacman_y][pacman_x+1] = PACMAN;
                 
-                // Update screen with Pacman's movement
-                draw_circle(x_current+4, y_current+4, 4, Black);  // Clear old position
-                draw_circle(x_updated+4, y_updated+4, 4, Yellow);  // Draw new position
+                // Redraw both cells on the next frame
+                pacman_step(DIR_RIGHT);
+                render_mark(x_current, y_current);  // Clear old position
+                render_mark(x_updated, y_updated);  // Draw new position
                 
                 // Update Pacman's coordinates
                 pacman_x++;
@@ -243,27 +254,10 @@ void move_pacman() {
             break;
     }
 
-    // Check for collision with Blinky
-    if (blinky_x == pacman_x && blinky_y == pacman_y && !eat_lock) {
-				eat_lock = LOCK_ACQUIRED;
-        previous_cell = EMPTY;  // Clear previous cell
-
-        // Handle Pacman's interaction with Blinky based on power mode
-        switch (is_power_mode) {
-            case PM_ON:
-                eat_ghost();  // Eat ghost if in power mode
-                break;
-            case PM_OFF:
-                lose_life();  // Lose life if not in power mode
-                break;
-            default:
-                is_power_mode = PM_OFF;  // Reset power mode
-                break;
-        }
-				
-				find_path();
-				
-				eat_lock = LOCK_RELEASED;
+    // Check for collision with the ghosts
+    Ghost *ghost = ghost_at(pacman_x, pacman_y, 0);
+    if (ghost) {
+        ghost_collision(ghost);
     }
     
     // Check for victory condition (all pills collected)
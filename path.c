@@ -0,0 +1,150 @@
+/*********************************************************************************************************
+**--------------File Info---------------------------------------------------------------------------------
+** File name:          path.c
+** Last modified Date:
+** Last Version:
+** Descriptions:       Packed paths: the start cell plus one 2-bit direction (DIR_*) per step, four steps per
+**                     byte. A PackedPath holds MAX_NODE cells in 132 bytes, where an array of PathStep with
+**                     int coordinates took 4000, so every ghost keeps its own and the planner one more. The
+**                     cells are never stored: a PathIter walks them from the start with ghost_move().
+**                     A path planned on the junction graph stores only the direction taken at its start and
+**                     at each junction (path_append_turn): the walker follows the corridors in between, so
+**                     the route is expanded one step at a time as the ghost moves.
+**--------------------------------------------------------------------------------------------------------
+*********************************************************************************************************/
+
+#include "functions.h"
+
+// Function to empty a path: no route (the start cell is kept)
+void path_clear(PackedPath *path) {
+    path->length = 0;
+    path->turns = 0;
+}
+
+// Function to start a path on (x, y), with no step yet
+void path_begin(PackedPath *path, int x, int y) {
+    path->start.x = x;
+    path->start.y = y;
+    path->length = 1;
+    path->turns = 0;
+}
+
+// Function to store the direction (DIR_*) of a step (the path length is left alone)
+void path_put(PackedPath *path, int step, int dir) {
+    int shift = (step & 3) * 2;
+    path->dirs[step >> 2] = (path->dirs[step >> 2] & ~(3 << shift)) | (dir << shift);
+}
+
+// Function to read the direction (DIR_*) of a step
+int path_get(const PackedPath *path, int step) {
+    return (path->dirs[step >> 2] >> ((step & 3) * 2)) & 3;
+}
+
+// Function to add a step at the end of a started path; returns 0 if the path is full (MAX_NODE cells)
+int path_append(PackedPath *path, int dir) {
+    if (path->length == 0 || path->length >= MAX_NODE) {
+        return 0;
+    }
+    path_put(path, path->length - 1, dir);
+    path->length++;
+    return 1;
+}
+
+// Function to add the direction taken at the next junction (or at the start) of a path made of corridors;
+// the caller sets the length once the route is complete. Returns 0 if the path is full.
+int path_append_turn(PackedPath *path, int dir) {
+    if (path->length == 0 || path->turns >= PATH_BYTES * 4) {
+        return 0;
+    }
+    path_put(path, path->turns++, dir);
+    return 1;
+}
+
+// Function to copy a path, only the bytes its steps use
+void path_copy(PackedPath *to, const PackedPath *from) {
+    int stored = from->turns ? from->turns : from->length - 1;  // Directions held in dirs
+
+    to->start = from->start;
+    to->length = from->length;
+    to->turns = from->turns;
+    if (from->length > 0 && stored > 0) {
+        memcpy(to->dirs, from->dirs, (stored + 3) / 4);  // One byte per four directions
+    }
+}
+
+// Function to get the way on along a corridor entered in direction dir: the exit of (x, y) other than
+// the way back, -1 if (x, y) is not a corridor cell (a junction, a dead end or a wall)
+static int corridor_exit(int x, int y, int dir) {
+    uint32_t exits = ghost_exits[y][x];
+    uint32_t other = exits & (exits - 1);  // Drop the lowest exit
+
+    if (other == 0 || (other & (other - 1)) != 0) {
+        return -1;  // Not exactly two exits
+    }
+    exits &= ~(1u << ((dir + 2) & 3));
+    if (exits & (exits - 1)) {
+        return -1;  // Not entered through one of its exits
+    }
+    return 31 - __CLZ(exits);
+}
+
+// Function to get the last cell of a path (walks the whole path: not meant for the game loop)
+PathStep path_destination(const PackedPath *path) {
+    PathIter it;
+
+    path_iter_begin(&it, path);
+    while (path_iter_next(&it) >= 0) {
+    }
+    return it.cell;
+}
+
+// Function to stand an iterator on the start of a path
+void path_iter_begin(PathIter *it, const PackedPath *path) {
+    it->path = path;
+    it->cell = path->start;
+    it->step = 0;
+    it->turn = 0;
+    it->dir = 0;
+}
+
+// Function to get the steps an iterator has left to walk
+int path_iter_left(const PathIter *it) {
+    return it->path->length > 0 ? it->path->length - 1 - it->step : 0;
+}
+
+// Function to take the next step: moves it->cell and returns the direction (DIR_*), -1 at the end of the path
+int path_iter_next(PathIter *it) {
+    int x = it->cell.x, y = it->cell.y, dir;
+
+    if (path_iter_left(it) <= 0) {
+        return -1;
+    }
+    if (!it->path->turns) {
+        dir = path_get(it->path, it->step);
+    } else {
+        // Inside a corridor there is a single way on; the start and the junctions read the next turn
+        dir = it->step > 0 ? corridor_exit(x, y, it->dir) : -1;
+        if (dir < 0) {
+            if (it->turn >= it->path->turns) {
+                return -1;  // Out of turns before the end: the route is broken
+            }
+            dir = path_get(it->path, it->turn++);
+        }
+    }
+    it->step++;
+    it->dir = dir;
+    ghost_move(&x, &y, dir);  // The tunnel is one step
+    it->cell.x = x;
+    it->cell.y = y;
+    return dir;
+}
+
+// Function to walk an iterator forward until it stands on (x, y); returns 0 (at the end) if the path never gets there
+int path_iter_seek(PathIter *it, int x, int y) {
+    while (it->cell.x != x || it->cell.y != y) {
+        if (path_iter_next(it) < 0) {
+            return 0;
+        }
+    }
+    return 1;
+}
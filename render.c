@@ -0,0 +1,161 @@
+/*********************************************************************************************************
+**--------------File Info---------------------------------------------------------------------------------
+** File name:          render.c
+** Last modified Date:
+** Last Version:
+** Descriptions:       Frame-based screen updates. Game logic never draws: it marks the cells it changes in
+**                     render_dirty (one bit per column, as the walk masks) and posts RENDER_* for the rest,
+**                     and render_frame() redraws each marked cell once from game_map, in raster order, as
+**                     one LCD window per horizontal run of marked cells. The RIT posts JOB_RENDER every
+**                     50 ms and the main loop draws the frame, so the timers cut into a long frame (a full
+**                     board) instead of waiting for it. Nothing else draws while a game runs: the LCD
+**                     window is not reentrant. A cell changed during a frame is marked again and drawn by
+**                     the next one.
+**--------------------------------------------------------------------------------------------------------
+*********************************************************************************************************/
+
+#include "functions.h"
+
+atomic_uint render_dirty[ROWS];        // Cells to redraw on the next frame, one bit per column
+atomic_uint render_pending = 0;        // One bit per RENDER_* waiting for the next frame
+uint32_t render_marks = 0;             // Cells marked since power-on
+uint32_t render_cells = 0;             // Cells redrawn since power-on
+uint32_t render_runs = 0;              // LCD windows opened for them
+uint32_t render_frames = 0;            // Frames that drew something
+uint32_t render_cycles = 0;            // Cycles spent in the last frame that drew something
+uint32_t render_cycles_max = 0;        // Worst frame since power-on
+
+// Function to mark a cell for the next frame (safe from interrupt handlers); a cell marked twice is drawn once
+void render_mark(int x, int y) {
+    if (x < 0 || x >= COLS || y < 0 || y >= ROWS) {
+        return;  // Off the board (a ghost not placed yet)
+    }
+    atomic_fetch_or(&render_dirty[y], 1u << x);
+    render_marks++;
+}
+
+// Function to post a screen update (RENDER_*) for the next frame
+void render_post(int what) {
+    atomic_fetch_or(&render_pending, 1u << what);
+}
+
+// Function to drop every update waiting for the next frame (the game screen is about to be replaced)
+void render_discard() {
+    int y;
+
+    atomic_store(&render_pending, 0);
+    for (y = 0; y < ROWS; y++) {
+        atomic_store(&render_dirty[y], 0);
+    }
+}
+
+// Function to redraw count cells of row y from column x in one LCD window, tile line by tile line
+static void render_run(int x, int y, int count) {
+    uint8_t tiles[COLS];  // Sprite of each cell of the run
+    int j, line;
+
+    for (j = 0; j < count; j++) {
+        tiles[j] = board_tile(x + j, y);
+    }
+    LCD_WindowBegin(x * CELL_SIZE, y * CELL_SIZE, count * CELL_SIZE, CELL_SIZE);
+    for (line = 0; line < SPRITE_SIZE; line++) {
+        for (j = 0; j < count; j++) {
+            LCD_WindowPixels(&sprite_atlas[tiles[j]][line * SPRITE_SIZE], SPRITE_SIZE);
+        }
+    }
+    LCD_WindowEnd();
+    render_cells += count;
+    render_runs++;
+}
+
+// Function to draw a screen that replaces the game (RENDER_PAUSE, RENDER_GAMEOVER or RENDER_VICTORY)
+static void render_screen(uint32_t what) {
+    int y;
+
+    for (y = 0; y < ROWS; y++) {
+        atomic_store(&render_dirty[y], 0);  // Nothing of the game shows on it
+    }
+    LCD_Clear(Black);
+    if (what & (1u << RENDER_GAMEOVER)) {
+        GUI_Text(90, 150, (uint8_t*)"GAMEOVER!", Red, Black);
+    } else if (what & (1u << RENDER_VICTORY)) {
+        draw_big_pacman(125, 100, 15, Black, Yellow);
+        GUI_Text(95, 150, (uint8_t*)"VICTORY", Yellow, Blue);
+    } else {
+        draw_start_menu();
+        GUI_Text(105, 160, (uint8_t *)"PAUSE", Black, White);
+    }
+}
+
+// Function to draw the game status received over CAN: countdown, lives (at most 5) and score
+static void render_status() {
+    char text[8];
+    int c;
+
+    sprintf(text, "%d", val_countdown);
+    GUI_Text(0, 16, (uint8_t*)"00", Black, Black);  // Clear previous countdown
+    GUI_Text(0, 16, (uint8_t*)text, White, Black);
+    for (c = 0; c < val_lives && c < 5; c++) {
+        draw_circle(58 + c * 15, 312, 5, Yellow);
+    }
+    sprintf(text, "%d", val_score);
+    GUI_Text(180, 16, (uint8_t*)text, White, Black);
+}
+
+// Function to draw what changed since the last frame (main loop, on JOB_RENDER from the RIT every 50 ms)
+void render_frame() {
+    uint32_t what = atomic_exchange(&render_pending, 0);
+    uint32_t start_cycles = DWT->CYCCNT;
+    uint32_t row;
+    int drawn = 0, x, y, end;
+
+    // A screen in place of the game, unless the game came back since (resumed in the same frame)
+    if ((what & ((1u << RENDER_PAUSE) | (1u << RENDER_GAMEOVER) | (1u << RENDER_VICTORY))) &&
+        !(what & (1u << RENDER_BOARD))) {
+        render_screen(what);
+        what = 0;
+        drawn = 1;
+    }
+
+    if (what & (1u << RENDER_BOARD)) {
+        for (y = 0; y < ROWS; y++) {
+            atomic_store(&render_dirty[y], 0);  // The board redraws every cell
+        }
+        draw_board();
+        drawn = 1;
+    }
+
+    for (y = 0; y < ROWS; y++) {
+        row = atomic_exchange(&render_dirty[y], 0);
+        while (row) {
+            x = 31 - __CLZ(row & -row);  // Leftmost marked cell
+            for (end = x + 1; end < COLS && (row & (1u << end)); end++) {
+            }
+            row &= ~((1u << end) - 1);   // The run x..end-1 is drawn
+            render_run(x, y, end - x);
+            drawn = 1;
+        }
+    }
+
+    if (what & (1u << RENDER_SCORE)) {
+        sprintf(s_str, "%d", score);
+        GUI_Text(180, 16, (uint8_t*)s_str, White, Black);
+        drawn = 1;
+    }
+    if ((what & (1u << RENDER_LIVES)) && lives_counter < 5) {
+        draw_circle(58 + lives_counter * 15, 312, 5, Black);  // Erase the life just lost
+        drawn = 1;
+    }
+    if (what & (1u << RENDER_STATUS)) {
+        render_status();
+        drawn = 1;
+    }
+
+    if (drawn) {
+        render_frames++;
+        render_cycles = DWT->CYCCNT - start_cycles;
+        if (render_cycles > render_cycles_max) {
+            render_cycles_max = render_cycles;
+        }
+    }
+}
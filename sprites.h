@@ -0,0 +1,37 @@
+/*********************************************************************************************************
+**--------------File Info---------------------------------------------------------------------------------
+** File name:           sprites.h
+** Descriptions:        RGB565 atlas of the 8x8 cell sprites
+**                      GENERATED by tools/gen_sprites.py from the shapes it defines - do not edit.
+** Correlated files:    sprites.c, functions.h, game.c
+**--------------------------------------------------------------------------------------------------------
+*********************************************************************************************************/
+
+#ifndef __SPRITES_H
+#define __SPRITES_H
+
+#include <stdint.h>
+
+/* Flash usage:
+**   sprites                    25
+**   sprite_atlas             3200 bytes
+*/
+
+#define SPRITE_SIZE         8         // Sprites are SPRITE_SIZE x SPRITE_SIZE pixels (CELL_SIZE)
+#define SPRITE_COUNT        25        // Tiles in sprite_atlas
+#define PACMAN_FRAMES       3         // Mouth frames per heading, closed to open
+#define SPRITE_EMPTY        0         // Black cell
+#define SPRITE_PILL         1         // Pill
+#define SPRITE_POWER_PILL   2         // Power pill
+#define SPRITE_DOOR         3         // Ghost house door
+#define SPRITE_EYES         4         // Eaten ghost (its eyes)
+#define SPRITE_FRIGHTENED   5         // Frightened ghost
+#define SPRITE_WALL         6         // Wall corner
+#define SPRITE_HOR_WALL     7         // Horizontal wall
+#define SPRITE_VER_WALL     8         // Vertical wall
+#define SPRITE_GHOST        9         // + ghost index (ghost_setup order)
+#define SPRITE_PACMAN       13        // + DIR_* * PACMAN_FRAMES + frame
+
+extern const uint16_t sprite_atlas[SPRITE_COUNT][SPRITE_SIZE * SPRITE_SIZE];
+
+#endif /* __SPRITES_H */
@@ -0,0 +1,310 @@
+/*********************************************************************************************************
+**--------------File Info---------------------------------------------------------------------------------
+** File name:           autoplay.c
+** Descriptions:        Headless soak run of the Pac-Man autopilot. It links the game sources with the LCD
+**                      calls stubbed out and Timers 0-2 emulated (init_timer/enable_timer/disable_timer/
+**                      reset_timer keep each timer's period and state), then plays whole games: Timer 0 runs
+**                      autopilot_tick() and move_pacman(), Timer 1 game_second(), Timer 2 the ghosts, the
+**                      RIT posts JOB_RENDER every 50 ms, and the main loop jobs_service() after every
+**                      interrupt (planning slices and frames), as on the board.
+**
+**                      Each game starts from a fresh game_map with its own power pill layout (the ADC seed
+**                      place_power_pills() reads). One CSV line is written per game (autoplay.csv by
+**                      default) and a summary gives the score, survival rate and decision cost. The same
+**                      games are then played by a Pac-Man who wanders at random, for comparison.
+**
+**                      Build and run from the repository root:
+**
+**                      gcc -std=gnu11 -O2 -Itools/pathbench -I. -ISource -ISource/GLCD -ISource/TouchPanel \
+**                          -ISource/timer tools/autoplay/autoplay.c autopilot.c blinky.c dstar.c flowfield.c \
+**                          game.c hpa.c jobs.c junctions.c path.c wavefront.c maze_tables.c music.c pacman.c \
+**                          render.c sprites.c -lm -o autoplay
+**                      ./autoplay [games] [autoplay.csv]
+**
+**                      Add -DNUM_GHOSTS=4 for all four ghosts.
+** Correlated files:    ../pathbench/LPC17xx.h, autopilot.c, functions.h
+**--------------------------------------------------------------------------------------------------------
+*********************************************************************************************************/
+
+#include "functions.h"
+#include <time.h>
+
+#define HOST_TIMERS 3                 // Timers 0-2 drive the game (Timer 3 only refreshes the display)
+#define TIMER_HZ 25000000.0           // Timer clock: init_timer() periods are in these ticks
+#define GAME_TICKS_MAX (120 * 25000000u)  // Safety stop: no game outlives its 60 s countdown by much
+#define FRAME_TICKS (25000000u / 20)  // The RIT asks for a frame every 50 ms
+
+// Peripherals and drivers the game sources call (LPC17xx.h)
+LPC_ADC_TypeDef host_adc;
+LPC_GPIO_TypeDef host_gpio;
+LPC_TIM_TypeDef host_tim;
+DWT_Type host_dwt;
+CoreDebug_Type host_core_debug;
+
+void LCD_Clear(uint16_t color) { (void)color; }
+void LCD_SetPoint(uint16_t x, uint16_t y, uint16_t color) { (void)x; (void)y; (void)color; }
+void LCD_DrawLine(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1, uint16_t color) {
+    (void)x0; (void)y0; (void)x1; (void)y1; (void)color;
+}
+void GUI_Text(uint16_t x, uint16_t y, uint8_t *str, uint16_t color, uint16_t bk_color) {
+    (void)x; (void)y; (void)str; (void)color; (void)bk_color;
+}
+void LCD_FillRect(uint16_t x, uint16_t y, uint16_t width, uint16_t height, uint16_t color) {
+    (void)x; (void)y; (void)width; (void)height; (void)color;
+}
+void LCD_WriteWindow(uint16_t x, uint16_t y, uint16_t width, uint16_t height, const uint16_t *pixels) {
+    (void)x; (void)y; (void)width; (void)height; (void)pixels;
+}
+void LCD_WindowBegin(uint16_t x, uint16_t y, uint16_t width, uint16_t height) {
+    (void)x; (void)y; (void)width; (void)height;
+}
+void LCD_WindowPixels(const uint16_t *pixels, uint16_t count) { (void)pixels; (void)count; }
+void LCD_WindowEnd(void) {}
+volatile uint8_t val_countdown = 0;  // Game status received over CAN (IRQ_CAN.c)
+volatile uint8_t val_lives = 0;
+volatile uint16_t val_score = 0;
+
+// Emulated timers: the period set by init_timer() on MR0, the ticks left before the next match
+static struct {
+    uint32_t period, left;
+    int enabled;
+} timers[HOST_TIMERS];
+
+uint32_t init_timer(uint8_t timer_num, uint32_t prescaler, uint8_t mr_num, uint8_t sr_num, uint32_t value) {
+    (void)prescaler; (void)sr_num;
+    if (timer_num < HOST_TIMERS && mr_num == 0) {
+        timers[timer_num].period = value;
+        if (timers[timer_num].left == 0 || timers[timer_num].left > value) {
+            timers[timer_num].left = value;
+        }
+    }
+    return 0;
+}
+void enable_timer(uint8_t timer_num) {
+    if (timer_num < HOST_TIMERS) {
+        timers[timer_num].enabled = 1;
+    }
+}
+void disable_timer(uint8_t timer_num) {
+    if (timer_num < HOST_TIMERS) {
+        timers[timer_num].enabled = 0;
+    }
+}
+void reset_timer(uint8_t timer_num) {
+    if (timer_num < HOST_TIMERS) {
+        timers[timer_num].left = timers[timer_num].period;
+    }
+}
+
+// Result of one game
+typedef struct {
+    int score, pills, caught, victory;
+    double seconds;                   // Game time until the end (caught, victory or countdown)
+    double ns_total, ns_max;          // Wall-clock time of the autopilot decisions
+    long decisions, expanded, expanded_max;
+} Game;
+
+static char start_map[ROWS][COLS];    // game_map as the firmware boots with it
+
+// Function to steer Pac-Man at random for the comparison games: keep going, turn at random at the crossings,
+// never back unless stuck
+static void wander_command(unsigned *seed) {
+    int options[4], count = 0, i, dir = -1;
+    const char *letters = "DRUL";
+
+    for (i = 0; i < 4; i++) {
+        if (command == letters[i]) {
+            dir = i;
+        }
+    }
+    for (i = 0; i < 4; i++) {
+        int x = pacman_x, y = pacman_y;
+        ghost_move(&x, &y, i);
+        if (i != ((dir + 2) & 3) && x >= 0 && x < COLS && y >= 0 && y < ROWS && (pacman_walk_mask[y] & (1u << x))) {
+            options[count++] = i;
+        }
+    }
+    *seed = *seed * 1103515245 + 12345;
+    if (count == 0) {
+        command = letters[(dir + 2) & 3];  // Dead end: the only way is back
+        return;
+    }
+    for (i = 0; i < count && options[i] != dir; i++) {
+    }
+    if (i == count || (*seed >> 16) % 3 == 0) {
+        command = letters[options[(*seed >> 16) % count]];
+    }
+}
+
+// Function to play one game to its end; seed picks the power pill layout
+static void play_game(unsigned seed, int use_autopilot, Game *game) {
+    unsigned wander_seed = seed;
+    uint32_t elapsed = 0, next_frame = 0;
+    struct timespec t0, t1;
+    double ns;
+    int i;
+
+    // The state the firmware powers up with, then the screen drawn when INT0 starts the game
+    memcpy(game_map, start_map, sizeof(game_map));
+    score = 0;
+    pills_counter = 0;
+    lives_counter = 1;
+    previous_score = 0;
+    countdown = 60;
+    start_counter = 0;
+    endgame = 0;
+    is_power_mode = PM_OFF;
+    is_ghost_eaten = 0;
+    command = 0;
+    find_lock = LOCK_RELEASED;
+    move_lock = LOCK_RELEASED;
+    eat_lock = LOCK_RELEASED;
+    host_adc.ADGDR = (seed & 0xFFF) << 4;
+    autopilot = use_autopilot;
+    draw_screen();
+    request_replan();
+
+    // Timers as the RIT leaves them once the tune is over
+    memset(timers, 0, sizeof(timers));
+    init_timer(0, 0, 0, 3, 0.25 * 25000000);
+    init_timer(1, 0, 0, 3, 1 * 25000000);
+    init_timer(2, 0, 0, 3, 0.25 * 25000000);
+    for (i = 0; i < HOST_TIMERS; i++) {
+        enable_timer(i);
+    }
+
+    memset(game, 0, sizeof(*game));
+    while (!endgame && elapsed < GAME_TICKS_MAX) {
+        int next = -1;
+        uint32_t step;
+
+        // Jump to the next match of a running timer
+        for (i = 0; i < HOST_TIMERS; i++) {
+            if (timers[i].enabled && (next < 0 || timers[i].left < timers[next].left)) {
+                next = i;
+            }
+        }
+        if (next < 0) {
+            break;  // Everything stopped
+        }
+        step = timers[next].left;
+        for (i = 0; i < HOST_TIMERS; i++) {
+            if (timers[i].enabled) {
+                timers[i].left -= step;
+            }
+        }
+        elapsed += step;
+        timers[next].left = timers[next].period;
+
+        switch (next) {
+            case 0:  // TIMER0: Pac-Man
+                if (use_autopilot) {
+                    clock_gettime(CLOCK_MONOTONIC, &t0);
+                    autopilot_tick();
+                    clock_gettime(CLOCK_MONOTONIC, &t1);
+                    ns = (t1.tv_sec - t0.tv_sec) * 1e9 + (t1.tv_nsec - t0.tv_nsec);
+                    game->ns_total += ns;
+                    game->ns_max = ns > game->ns_max ? ns : game->ns_max;
+                    game->decisions++;
+                    game->expanded += autopilot_expansions;
+                    if (autopilot_expansions > game->expanded_max) {
+                        game->expanded_max = autopilot_expansions;
+                    }
+                } else {
+                    wander_command(&wander_seed);
+                }
+                move_pacman();
+                break;
+            case 1:  // TIMER1: countdown and power mode
+                game_second();
+                break;
+            default:  // TIMER2: the ghosts
+                move_ghosts();
+                replan_tick();
+                job_post(JOB_TICK);
+                break;
+        }
+        while (elapsed >= next_frame) {  // The RIT (its 50 ms ticks between the timers' ones)
+            job_post(JOB_RENDER);
+            next_frame += FRAME_TICKS;
+        }
+        while (jobs_service()) {  // The main loop
+        }
+    }
+    render_discard();
+
+    game->score = score;
+    game->pills = pills_counter;
+    game->caught = lives_counter == 0;
+    game->victory = pills_counter == 246;
+    game->seconds = elapsed / TIMER_HZ;
+}
+
+// Function to play games in a row and print their summary
+static void play_games(int games, int use_autopilot, FILE *csv) {
+    long caught = 0, victories = 0, decisions = 0, expanded = 0, expanded_max = 0;
+    uint32_t marks = render_marks, cells = render_cells, runs = render_runs, frames = render_frames;
+    double score = 0, pills = 0, seconds = 0, ns_total = 0, ns_max = 0;
+    int g;
+
+    for (g = 0; g < games; g++) {
+        Game game;
+
+        play_game(g + 1, use_autopilot, &game);
+        if (csv) {
+            fprintf(csv, "%d,%d,%d,%d,%d,%.2f,%ld,%.0f,%ld\n", g + 1, game.score, game.pills, game.caught,
+                    game.victory, game.seconds, game.decisions, game.ns_max, game.expanded_max);
+        }
+        caught += game.caught;
+        victories += game.victory;
+        score += game.score;
+        pills += game.pills;
+        seconds += game.seconds;
+        decisions += game.decisions;
+        expanded += game.expanded;
+        expanded_max = game.expanded_max > expanded_max ? game.expanded_max : expanded_max;
+        ns_total += game.ns_total;
+        ns_max = game.ns_max > ns_max ? game.ns_max : ns_max;
+    }
+
+    printf("\n%s: %d games, %d ghosts\n", use_autopilot ? "autopilot" : "random wander", games, NUM_GHOSTS);
+    printf("score %.1f avg, pills %.1f avg, %.1f s played on average\n", score / games, pills / games,
+           seconds / games);
+    printf("survived the countdown: %ld (%.1f%%), caught: %ld, victories: %ld\n", games - caught - victories,
+           100.0 * (games - caught - victories) / games, caught, victories);
+    if (use_autopilot) {
+        printf("decisions: %ld, %.0f ns avg, %.0f ns worst; cells expanded %.1f avg, %ld worst (budget %d)\n",
+               decisions, ns_total / (decisions ? decisions : 1), ns_max,
+               (double)expanded / (decisions ? decisions : 1), expanded_max, AUTOPILOT_BUDGET);
+    }
+    printf("frames: %u drawn, %u cells marked, %u redrawn in %u LCD windows\n", render_frames - frames,
+           render_marks - marks, render_cells - cells, render_runs - runs);
+}
+
+int main(int argc, char **argv) {
+    int games = argc > 1 ? atoi(argv[1]) : 1000;
+    const char *csv_name = argc > 2 ? argv[2] : "autoplay.csv";
+    FILE *csv;
+
+    if (games <= 0) {
+        fprintf(stderr, "usage: %s [games] [autoplay.csv]\n", argv[0]);
+        return 1;
+    }
+    csv = fopen(csv_name, "w");
+    if (!csv) {
+        perror(csv_name);
+        return 1;
+    }
+
+    memcpy(start_map, game_map, sizeof(start_map));
+    junction_graph_init();
+    wavefront_init();
+    hpa_init();
+
+    fprintf(csv, "game,score,pills,caught,victory,seconds,decisions,ns_max,expanded_max\n");
+    play_games(games, 1, csv);
+    fclose(csv);
+    printf("per-game results: %s\n", csv_name);
+    play_games(games, 0, 0);
+    return 0;
+}
@@ -0,0 +1,331 @@
+#!/usr/bin/env python3
+"""
+Generates maze_tables.c / maze_tables.h from the game_map literal in game.c.
+
+The maze walls never change at runtime (only pills are eaten), so every ghost
+route can be precomputed on the host and stored in flash:
+
+  maze_cell_index  cell -> dense index of the cells a ghost can walk on
+  nexthop_table    2-bit direction of the first step of a shortest route,
+                   for every (source, target) pair of ghost cells (the tunnel
+                   is one step between its two ends, as for Pac-Man)
+  static_fields    steps from every ghost cell to each fixed target (the
+                   ghost house and the four corners, defined in functions.h),
+                   so ghosts heading there just walk downhill
+  landmark_dist    steps from every ghost cell to LANDMARK_COUNT landmarks
+                   spread over the maze, for the ALT lower bound of A*
+  ghost_exits      4-bit mask of the directions a ghost may leave each cell
+                   by, for the arcade steering
+
+Run it from the repository root after editing game_map:
+
+    python3 tools/gen_maze_tables.py
+"""
+
+import os
+import re
+import sys
+from collections import deque
+
+ROOT = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+
+# Directions in the order of the dx/dy tables in blinky.c (DIR_DOWN, DIR_RIGHT, DIR_UP, DIR_LEFT)
+DIRS = [(0, 1), (1, 0), (0, -1), (-1, 0)]
+
+WALLS = "#=|"
+TELEPORTS = "<>"
+GHOST = "B"
+TUNNEL_LEFT_X = 2        # Cell reached through '>' (TUNNEL_LEFT_X in functions.h)
+TUNNEL_RIGHT_GAP = 3     # Cell reached through '<' is COLS - 3 (TUNNEL_RIGHT_X in functions.h)
+FIELD_UNREACHABLE = 0xFF  # FIELD_UNREACHABLE in functions.h
+
+
+def read_define(text, name):
+    m = re.search(r"#define\s+%s\s+(\d+)" % name, text)
+    if not m:
+        sys.exit("functions.h: cannot find #define %s" % name)
+    return int(m.group(1))
+
+
+def load_header():
+    return open(os.path.join(ROOT, "functions.h"), encoding="latin-1").read()
+
+
+def load_map():
+    header = load_header()
+    cell = read_define(header, "CELL_SIZE")
+    cols = read_define(header, "SCREEN_WIDTH") // cell
+    rows = read_define(header, "SCREEN_HEIGHT") // cell
+
+    game = open(os.path.join(ROOT, "game.c"), encoding="latin-1").read()
+    m = re.search(r"char\s+game_map\s*\[ROWS\]\s*\[COLS\]\s*=\s*\{(.*?)\};", game, re.S)
+    if not m:
+        sys.exit("game.c: cannot find the game_map literal")
+    lines = re.findall(r'"([^"]*)"', m.group(1))
+    if len(lines) > rows or any(len(line) != cols for line in lines):
+        sys.exit("game.c: game_map rows must be exactly %d characters (at most %d rows)" % (cols, rows))
+    # Rows missing from the literal are zero-filled by the compiler: treat them as walls
+    lines += [WALLS[0] * cols] * (rows - len(lines))
+    return rows, cols, lines
+
+
+def step(cols, lines, x, y, d):
+    """Cell reached by one move, wrapping through the tunnel like ghost_move() in blinky.c."""
+    x, y = x + DIRS[d][0], y + DIRS[d][1]
+    if 0 <= y < len(lines) and 0 <= x < cols:
+        if d == 3 and lines[y][x] == "<":    # DIR_LEFT into the left opening
+            x = cols - TUNNEL_RIGHT_GAP
+        elif d == 1 and lines[y][x] == ">":  # DIR_RIGHT into the right opening
+            x = TUNNEL_LEFT_X
+    return x, y
+
+
+def ghost_cells(rows, cols, lines):
+    """Cells reachable by a ghost from its spawn point, in raster order."""
+    def walkable(x, y):
+        return 0 <= x < cols and 0 <= y < rows and lines[y][x] not in WALLS + TELEPORTS
+
+    spawn = [(x, y) for y in range(rows) for x in range(cols) if lines[y][x] == GHOST]
+    if len(spawn) != 1:
+        sys.exit("game.c: game_map must contain exactly one '%s'" % GHOST)
+
+    seen = {spawn[0]}
+    queue = deque(spawn)
+    while queue:
+        x, y = queue.popleft()
+        for d in range(4):
+            n = step(cols, lines, x, y, d)
+            if walkable(*n) and n not in seen:
+                seen.add(n)
+                queue.append(n)
+    return sorted(seen, key=lambda c: (c[1], c[0]))
+
+
+def neighbours(cell, index, cols, lines):
+    for d in range(4):
+        n = step(cols, lines, cell[0], cell[1], d)
+        if n in index:
+            yield d, n
+
+
+def bfs(target, index, cols, lines):
+    dist = {target: 0}
+    queue = deque([target])
+    while queue:
+        c = queue.popleft()
+        for _, n in neighbours(c, index, cols, lines):
+            if n not in dist:
+                dist[n] = dist[c] + 1
+                queue.append(n)
+    return dist
+
+
+def build_nexthop(cells, index, cols, lines):
+    n = len(cells)
+    row_bytes = (n + 3) // 4
+    table = [bytearray(row_bytes) for _ in range(n)]
+    for t, target in enumerate(cells):
+        dist = bfs(target, index, cols, lines)
+        for s, source in enumerate(cells):
+            if s == t:
+                continue
+            for d, nb in neighbours(source, index, cols, lines):
+                if dist[nb] == dist[source] - 1:
+                    table[s][t >> 2] |= d << ((t & 3) * 2)
+                    break
+    return table, row_bytes
+
+
+def fixed_targets(header, index):
+    """Targets that never move: the ghost house, then the four corners (HOME_* / CORNER_* in functions.h)."""
+    left, right = read_define(header, "CORNER_LEFT_X"), read_define(header, "CORNER_RIGHT_X")
+    top, bottom = read_define(header, "CORNER_TOP_Y"), read_define(header, "CORNER_BOTTOM_Y")
+    targets = [(read_define(header, "HOME_X"), read_define(header, "HOME_Y")),
+               (left, top), (right, top), (left, bottom), (right, bottom)]
+    for t in targets:
+        if t not in index:
+            sys.exit("functions.h: fixed target (%d, %d) is not a ghost cell" % t)
+    return targets
+
+
+def build_fields(targets, cells, index, cols, lines):
+    fields = []
+    for target in targets:
+        dist = bfs(target, index, cols, lines)
+        if max(dist.values()) >= FIELD_UNREACHABLE:
+            sys.exit("distance field to (%d, %d) does not fit in a uint8_t" % target)
+        fields.append(bytearray(dist.get(c, FIELD_UNREACHABLE) for c in cells))
+    return fields
+
+
+def pick_landmarks(count, home, cells, index, cols, lines):
+    """Farthest-point sampling: each landmark is the cell farthest from the ones already picked
+    (the first one farthest from the ghost house). Landmarks on the rim of the maze give the
+    tightest bounds for the routes that run past them."""
+    landmarks, fields = [], []
+    nearest = bfs(home, index, cols, lines)
+    for _ in range(count):
+        best = max(cells, key=lambda c: (nearest[c], -index[c]))  # First in raster order on ties
+        dist = bfs(best, index, cols, lines)
+        landmarks.append(best)
+        fields.append(dist)
+        nearest = {c: min(nearest[c], dist[c]) for c in cells} if len(landmarks) > 1 else dist
+    return landmarks, fields
+
+
+def c_bytes(data, indent="    ", per_line=16):
+    out = []
+    for i in range(0, len(data), per_line):
+        out.append(indent + ", ".join("0x%02X" % b for b in data[i:i + per_line]) + ",")
+    return "\n".join(out)
+
+
+BANNER = """/*********************************************************************************************************
+**--------------File Info---------------------------------------------------------------------------------
+** File name:           %s
+** Descriptions:        %s
+**                      GENERATED by tools/gen_maze_tables.py from game_map in game.c - do not edit.
+** Correlated files:    %s
+**--------------------------------------------------------------------------------------------------------
+*********************************************************************************************************/
+"""
+
+
+def main():
+    rows, cols, lines = load_map()
+    cells = ghost_cells(rows, cols, lines)
+    index = {c: i for i, c in enumerate(cells)}
+    if len(cells) >= 0xFFFF:
+        sys.exit("too many ghost cells for a uint16_t index")
+
+    nexthop, row_bytes = build_nexthop(cells, index, cols, lines)
+    header = load_header()
+    targets = fixed_targets(header, index)
+    fields = build_fields(targets, cells, index, cols, lines)
+    landmarks, landmark_fields = pick_landmarks(read_define(header, "LANDMARK_COUNT"), targets[0],
+                                                cells, index, cols, lines)
+    if any(max(d.values()) >= FIELD_UNREACHABLE for d in landmark_fields):
+        sys.exit("landmark distances do not fit in a uint8_t")
+
+    index_bytes = rows * cols * 2
+    nexthop_bytes = len(cells) * row_bytes
+    field_bytes = len(fields) * len(cells)
+    landmark_bytes = len(landmarks) * len(cells)
+    exits_bytes = rows * cols
+
+    report = [
+        "ghost cells            %6d" % len(cells),
+        "maze_cell_index        %6d bytes" % index_bytes,
+        "nexthop_table          %6d bytes (USE_NEXTHOP_TABLE 1 only)" % nexthop_bytes,
+        "static_fields          %6d bytes" % field_bytes,
+        "landmark_dist          %6d bytes (USE_LANDMARKS 1 only)" % landmark_bytes,
+        "ghost_exits            %6d bytes" % exits_bytes,
+    ]
+    # The next-hop table is compiled out of the runtime search builds, the landmarks out of USE_LANDMARKS 0
+    common_bytes = index_bytes + field_bytes + exits_bytes
+    for table in (1, 0):
+        for alt in (1, 0):
+            total = common_bytes + (nexthop_bytes if table else 0) + (landmark_bytes if alt else 0)
+            report.append("total flash, USE_NEXTHOP_TABLE %d USE_LANDMARKS %d  %6d bytes" % (table, alt, total))
+
+    h = [BANNER % ("maze_tables.h", "Precomputed ghost routes for the static maze", "maze_tables.c, functions.h, blinky.c"),
+         "#ifndef __MAZE_TABLES_H",
+         "#define __MAZE_TABLES_H",
+         "",
+         "#include <stdint.h>",
+         "",
+         "/* Flash usage:"]
+    h += ["**   " + line for line in report]
+    h += ["*/",
+          "",
+          "#define MAZE_CELLS          %d       // Cells reachable by a ghost" % len(cells),
+          "#define MAZE_NO_CELL        0xFFFF    // maze_cell_index value for walls and unreachable cells",
+          "#define NEXTHOP_ROW_BYTES   %d        // Bytes per source cell (4 targets per byte)" % row_bytes,
+          "#define NEXTHOP_TABLE_BYTES %d     // Size of nexthop_table" % nexthop_bytes,
+          "#define STATIC_FIELDS       %d         // Fixed targets with a field in static_fields" % len(fields),
+          "",
+          "extern const uint16_t maze_cell_index[%d][%d];" % (rows, cols),
+          "extern const uint8_t nexthop_table[MAZE_CELLS][NEXTHOP_ROW_BYTES];",
+          "extern const uint8_t static_field_target[STATIC_FIELDS][2];",
+          "extern const uint8_t static_fields[STATIC_FIELDS][MAZE_CELLS];",
+          "extern const uint8_t landmark_cell[%d][2];" % len(landmarks),
+          "extern const uint8_t landmark_dist[MAZE_CELLS][%d];" % len(landmarks),
+          "extern const uint8_t ghost_exits[%d][%d];" % (rows, cols),
+          "",
+          "#endif /* __MAZE_TABLES_H */",
+          ""]
+
+    c = [BANNER % ("maze_tables.c", "Precomputed ghost routes for the static maze", "maze_tables.h, functions.h, blinky.c"),
+         '#include "functions.h"',
+         "",
+         "// Dense index of every ghost cell (MAZE_NO_CELL for walls and cells outside the maze)",
+         "const uint16_t maze_cell_index[%d][%d] = {" % (rows, cols)]
+    for y in range(rows):
+        vals = ["%3d" % index[(x, y)] if (x, y) in index else "0xFFFF" for x in range(cols)]
+        c.append("    {" + ", ".join(vals) + "},")
+    c += ["};",
+          "",
+          "// Fixed targets (x, y): the ghost house, then the corners",
+          "const uint8_t static_field_target[STATIC_FIELDS][2] = {"]
+    c += ["    {%d, %d}," % t for t in targets]
+    c += ["};",
+          "",
+          "// Steps from every ghost cell (maze_cell_index order) to each fixed target",
+          "const uint8_t static_fields[STATIC_FIELDS][MAZE_CELLS] = {"]
+    for t, field in zip(targets, fields):
+        c.append("    { // (%d, %d)" % t)
+        c.append(c_bytes(field, indent="        "))
+        c.append("    },")
+    c += ["};",
+          "",
+          "#if USE_LANDMARKS",
+          "",
+          "// Landmarks (x, y), picked by farthest-point sampling from the ghost house",
+          "const uint8_t landmark_cell[%d][2] = {" % len(landmarks)]
+    c += ["    {%d, %d}," % l for l in landmarks]
+    c += ["};",
+          "",
+          "// Steps from every ghost cell (maze_cell_index order) to each landmark",
+          "const uint8_t landmark_dist[MAZE_CELLS][%d] = {" % len(landmarks)]
+    for s, cell in enumerate(cells):
+        c.append("    {%s}, // %d: (%d, %d)" % (", ".join("%3d" % d[cell] for d in landmark_fields), s, cell[0], cell[1]))
+    c += ["};",
+          "",
+          "#endif /* USE_LANDMARKS */",
+          "",
+          "// Directions a ghost may leave each cell by: bit DIR_* set if the step lands on a ghost cell",
+          "const uint8_t ghost_exits[%d][%d] = {" % (rows, cols)]
+    for y in range(rows):
+        vals = []
+        for x in range(cols):
+            mask = 0
+            if (x, y) in index:
+                for d, _ in neighbours((x, y), index, cols, lines):
+                    mask |= 1 << d
+            vals.append("%2d" % mask)
+        c.append("    {" + ", ".join(vals) + "},")
+    c += ["};",
+          "",
+          "#if USE_NEXTHOP_TABLE",
+          "",
+          "// First step (DIR_*) of a shortest route: nexthop_table[source][target >> 2] >> ((target & 3) * 2) & 3",
+          "const uint8_t nexthop_table[MAZE_CELLS][NEXTHOP_ROW_BYTES] = {"]
+    for s, row in enumerate(nexthop):
+        c.append("    { // %d: (%d, %d)" % (s, cells[s][0], cells[s][1]))
+        c.append(c_bytes(row, indent="        "))
+        c.append("    },")
+    c += ["};",
+          "",
+          "#endif /* USE_NEXTHOP_TABLE */",
+          ""]
+
+    with open(os.path.join(ROOT, "maze_tables.h"), "w", newline="\n") as f:
+        f.write("\n".join(h))
+    with open(os.path.join(ROOT, "maze_tables.c"), "w", newline="\n") as f:
+        f.write("\n".join(c))
+
+    print("\n".join(report))
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,195 @@
+#!/usr/bin/env python3
+"""
+Generates sprites.c / sprites.h: the RGB565 atlas of the 8x8 tiles the game
+draws on a maze cell, so moving an entity is one LCD_WriteWindow() burst of a
+tile from flash instead of rasterizing circles and lines, and the whole board
+is streamed tile line by tile line in a single window:
+
+  SPRITE_EMPTY        black cell
+  SPRITE_PILL         the 2x2 white pill
+  SPRITE_POWER_PILL   white disk of radius 3
+  SPRITE_DOOR         magenta bar of the ghost house door
+  SPRITE_EYES         an eaten ghost: its white eyes on black
+  SPRITE_FRIGHTENED   a frightened ghost: blue disk of radius 4
+  SPRITE_WALL         blue square outline of a wall corner
+  SPRITE_HOR_WALL     two blue horizontal lines
+  SPRITE_VER_WALL     two blue vertical lines
+  SPRITE_GHOST + g    ghost g (ghost_setup order in blinky.c) in its colour
+  SPRITE_PACMAN + d * PACMAN_FRAMES + f
+                      Pac-Man heading DIR_* d, mouth frame f (closed to open)
+
+The shapes are the ones draw_screen() used to draw, clipped to the cell.
+
+Run it from the repository root after changing a shape or a ghost colour:
+
+    python3 tools/gen_sprites.py
+"""
+
+import math
+import os
+import re
+import sys
+
+ROOT = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+
+TILE = 8                  # CELL_SIZE in functions.h
+CENTRE = 4                # Shapes are centred on pixel (4, 4) of the cell, as draw_circle(xpos + 4, ypos + 4, ...)
+PACMAN_MOUTH = [0, 25, 45]  # Half-angle of the mouth (degrees) of each frame
+
+# Directions in the order of DIR_* (DIR_DOWN, DIR_RIGHT, DIR_UP, DIR_LEFT); y grows downwards
+DIRS = [(0, 1), (1, 0), (0, -1), (-1, 0)]
+
+
+def rgb565(r, g, b):
+    return ((r >> 3) << 11) | ((g >> 2) << 5) | (b >> 3)
+
+
+def load_colours():
+    """Named colours of GLCD.h."""
+    text = open(os.path.join(ROOT, "Source", "GLCD", "GLCD.h"), encoding="latin-1").read()
+    return {name: int(value, 16) for name, value in re.findall(r"#define\s+(\w+)\s+(0x[0-9A-Fa-f]{4})\b", text)}
+
+
+def colour(expr, named):
+    expr = expr.strip()
+    m = re.match(r"RGB565CONVERT\(\s*(\d+)\s*,\s*(\d+)\s*,\s*(\d+)\s*\)$", expr)
+    if m:
+        return rgb565(*(int(v) for v in m.groups()))
+    if expr in named:
+        return named[expr]
+    sys.exit("cannot read the colour %r" % expr)
+
+
+def load_ghost_colours(named):
+    """Colour of each ghost in ghost_setup (blinky.c)."""
+    text = open(os.path.join(ROOT, "blinky.c"), encoding="latin-1").read()
+    m = re.search(r"ghost_setup\[\d+\]\s*=\s*\{(.*?)\n\};", text, re.S)
+    if not m:
+        sys.exit("blinky.c: cannot find ghost_setup")
+    entries = re.findall(r"\{[^{}]*?,[^{}]*?,[^{}]*?,\s*((?:RGB565CONVERT\([^)]*\))|\w+)\s*\}", m.group(1))
+    if not entries:
+        sys.exit("blinky.c: cannot read the ghost colours")
+    return [colour(e, named) for e in entries]
+
+
+def tile(paint):
+    """Tile of TILE x TILE pixels, row by row, from paint(x, y) (None: black)."""
+    return [paint(x, y) or 0 for y in range(TILE) for x in range(TILE)]
+
+
+def disk(r, fg, bg=0):
+    return tile(lambda x, y: fg if (x - CENTRE) ** 2 + (y - CENTRE) ** 2 <= r * r else bg)
+
+
+def pacman(direction, mouth, fg):
+    dx, dy = DIRS[direction]
+    limit = math.cos(math.radians(mouth))
+
+    def paint(x, y):
+        vx, vy = x - CENTRE, y - CENTRE
+        if vx * vx + vy * vy > 16:
+            return None
+        along = vx * dx + vy * dy
+        if mouth and along > 0 and along > limit * math.hypot(vx, vy):
+            return None  # Inside the mouth
+        return fg
+    return tile(paint)
+
+
+BANNER = """/*********************************************************************************************************
+**--------------File Info---------------------------------------------------------------------------------
+** File name:           %s
+** Descriptions:        %s
+**                      GENERATED by tools/gen_sprites.py from the shapes it defines - do not edit.
+** Correlated files:    %s
+**--------------------------------------------------------------------------------------------------------
+*********************************************************************************************************/
+"""
+
+
+def main():
+    named = load_colours()
+    ghosts = load_ghost_colours(named)
+    white, blue, magenta, yellow = (named[n] for n in ("White", "Blue", "Magenta", "Yellow"))
+
+    # (tile comment, pixels), and the #define of the first tile of each group
+    sprites = [
+        ("black cell", tile(lambda x, y: None)),
+        ("pill", tile(lambda x, y: white if x in (4, 5) and y in (4, 5) else None)),
+        ("power pill", disk(3, white)),
+        ("ghost house door", tile(lambda x, y: magenta if y == 5 else None)),
+        ("eaten ghost", disk(2, white)),
+        ("frightened ghost", disk(4, blue)),
+        ("wall corner", tile(lambda x, y: blue if 3 <= x <= 6 and 3 <= y <= 6 and (x in (3, 6) or y in (3, 6))
+                             else None)),
+        ("horizontal wall", tile(lambda x, y: blue if y in (3, 5) else None)),
+        ("vertical wall", tile(lambda x, y: blue if x in (3, 5) else None)),
+    ]
+    defines = [
+        ("SPRITE_EMPTY", 0, "Black cell"),
+        ("SPRITE_PILL", 1, "Pill"),
+        ("SPRITE_POWER_PILL", 2, "Power pill"),
+        ("SPRITE_DOOR", 3, "Ghost house door"),
+        ("SPRITE_EYES", 4, "Eaten ghost (its eyes)"),
+        ("SPRITE_FRIGHTENED", 5, "Frightened ghost"),
+        ("SPRITE_WALL", 6, "Wall corner"),
+        ("SPRITE_HOR_WALL", 7, "Horizontal wall"),
+        ("SPRITE_VER_WALL", 8, "Vertical wall"),
+        ("SPRITE_GHOST", len(sprites), "+ ghost index (ghost_setup order)"),
+    ]
+    for g, c in enumerate(ghosts):
+        sprites.append(("ghost %d" % g, disk(4, c)))
+    defines.append(("SPRITE_PACMAN", len(sprites), "+ DIR_* * PACMAN_FRAMES + frame"))
+    for d in range(len(DIRS)):
+        for f, mouth in enumerate(PACMAN_MOUTH):
+            sprites.append(("Pac-Man, DIR_* %d, frame %d" % (d, f), pacman(d, mouth, yellow)))
+
+    atlas_bytes = len(sprites) * TILE * TILE * 2
+    report = [
+        "sprites                %6d" % len(sprites),
+        "sprite_atlas           %6d bytes" % atlas_bytes,
+    ]
+
+    h = [BANNER % ("sprites.h", "RGB565 atlas of the 8x8 cell sprites", "sprites.c, functions.h, game.c"),
+         "#ifndef __SPRITES_H",
+         "#define __SPRITES_H",
+         "",
+         "#include <stdint.h>",
+         "",
+         "/* Flash usage:"]
+    h += ["**   " + line for line in report]
+    h += ["*/",
+          "",
+          "#define SPRITE_SIZE         %d         // Sprites are SPRITE_SIZE x SPRITE_SIZE pixels (CELL_SIZE)" % TILE,
+          "#define SPRITE_COUNT        %d        // Tiles in sprite_atlas" % len(sprites),
+          "#define PACMAN_FRAMES       %d         // Mouth frames per heading, closed to open" % len(PACMAN_MOUTH)]
+    h += ["#define %-19s %-9d // %s" % d for d in defines]
+    h += ["",
+          "extern const uint16_t sprite_atlas[SPRITE_COUNT][SPRITE_SIZE * SPRITE_SIZE];",
+          "",
+          "#endif /* __SPRITES_H */",
+          ""]
+
+    c = [BANNER % ("sprites.c", "RGB565 atlas of the 8x8 cell sprites", "sprites.h, functions.h, game.c"),
+         '#include "functions.h"',
+         "",
+         "// Pixels of each sprite, row by row (LCD_WriteWindow() order)",
+         "const uint16_t sprite_atlas[SPRITE_COUNT][SPRITE_SIZE * SPRITE_SIZE] = {"]
+    for i, (desc, pixels) in enumerate(sprites):
+        c.append("    { // %d: %s" % (i, desc))
+        for y in range(TILE):
+            c.append("        " + ", ".join("0x%04X" % p for p in pixels[y * TILE:(y + 1) * TILE]) + ",")
+        c.append("    },")
+    c += ["};",
+          ""]
+
+    with open(os.path.join(ROOT, "sprites.h"), "w", newline="\n") as f:
+        f.write("\n".join(h))
+    with open(os.path.join(ROOT, "sprites.c"), "w", newline="\n") as f:
+        f.write("\n".join(c))
+
+    print("\n".join(report))
+
+
+if __name__ == "__main__":
+    main()
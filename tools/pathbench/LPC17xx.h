@@ -0,0 +1,47 @@
+/*********************************************************************************************************
+**--------------File Info---------------------------------------------------------------------------------
+** File name:           LPC17xx.h
+** Descriptions:        Host stand-in for the device header, used by tools/pathbench and tools/autoplay. It
+**                      declares the few peripherals the game sources touch as plain structs so they compile
+**                      with gcc.
+** Correlated files:    pathbench.c, ../autoplay/autoplay.c
+**--------------------------------------------------------------------------------------------------------
+*********************************************************************************************************/
+
+#ifndef __HOST_LPC17XX_H
+#define __HOST_LPC17XX_H
+
+#include <stdint.h>
+
+typedef struct { volatile uint32_t ADGDR; } LPC_ADC_TypeDef;
+typedef struct { volatile uint32_t FIOSET, FIOCLR, FIOPIN, FIODIR; } LPC_GPIO_TypeDef;
+typedef struct { volatile uint32_t IR, TCR; } LPC_TIM_TypeDef;
+typedef struct { volatile uint32_t CTRL, CYCCNT; } DWT_Type;
+typedef struct { volatile uint32_t DEMCR; } CoreDebug_Type;
+
+extern LPC_ADC_TypeDef host_adc;
+extern LPC_GPIO_TypeDef host_gpio;
+extern LPC_TIM_TypeDef host_tim;
+extern DWT_Type host_dwt;
+extern CoreDebug_Type host_core_debug;
+
+#define LPC_ADC    (&host_adc)
+#define LPC_GPIO0  (&host_gpio)
+#define LPC_TIM0   (&host_tim)
+#define LPC_TIM1   (&host_tim)
+#define LPC_TIM2   (&host_tim)
+#define LPC_TIM3   (&host_tim)
+#define DWT        (&host_dwt)
+#define CoreDebug  (&host_core_debug)
+
+#define DWT_CTRL_CYCCNTENA_Msk      (1u << 0)
+#define CoreDebug_DEMCR_TRCENA_Msk  (1u << 24)
+
+// Single-threaded on the host: there is nothing to mask
+#define __disable_irq()   ((void)0)
+#define __enable_irq()    ((void)0)
+#define __get_PRIMASK()   0u
+#define __set_PRIMASK(x)  ((void)(x))
+#define __CLZ(x)          ((uint32_t)__builtin_clz(x))
+
+#endif /* __HOST_LPC17XX_H */
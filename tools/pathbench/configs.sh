@@ -0,0 +1,53 @@
+#!/bin/sh
+#*********************************************************************************************************
+#*--------------File Info---------------------------------------------------------------------------------
+#* File name:           configs.sh
+#* Descriptions:        Builds and runs pathbench once per planner configuration, so every planner compiled
+#*                      out of the default build (runtime A*, junction graph, HPA*, D* Lite, distance field,
+#*                      landmarks) keeps being checked against the BFS. The switches of functions.h are
+#*                      overridden with -D; each configuration is run with one ghost and with four.
+#*
+#*                      Run from the repository root: sh tools/pathbench/configs.sh [build directory]
+#*                      Exits with status 1 if a configuration fails to build or its run fails.
+#* Correlated files:    pathbench.c, functions.h
+#*--------------------------------------------------------------------------------------------------------
+#*********************************************************************************************************
+
+OUT=${1:-pathbench_configs}
+SOURCES="tools/pathbench/pathbench.c blinky.c dstar.c flowfield.c game.c hpa.c jobs.c junctions.c path.c \
+wavefront.c maze_tables.c music.c pacman.c render.c sprites.c"
+FLAGS="-std=gnu11 -O2 -Wall -Wextra -Itools/pathbench -I. -ISource -ISource/GLCD -ISource/TouchPanel -ISource/timer"
+FAILED=0
+
+mkdir -p "$OUT" || exit 1
+
+# Name, then the switches that differ from functions.h
+while read -r NAME DEFINES; do
+    for GHOSTS in 1 4; do
+        BIN="$OUT/pathbench_${NAME}_$GHOSTS"
+        echo "== $NAME, $GHOSTS ghosts: $DEFINES"
+        if ! gcc $FLAGS $DEFINES -DNUM_GHOSTS=$GHOSTS $SOURCES -lm -o "$BIN"; then
+            echo "== $NAME, $GHOSTS ghosts: build FAILED"
+            FAILED=1
+            continue
+        fi
+        if ! "$BIN" "$BIN.csv" > "$BIN.txt"; then
+            echo "== $NAME, $GHOSTS ghosts: run FAILED (see $BIN.txt)"
+            FAILED=1
+        fi
+    done
+done <<EOF
+table -DUSE_NEXTHOP_TABLE=1 -DUSE_DSTAR_LITE=1
+table_field -DUSE_NEXTHOP_TABLE=1 -DUSE_DSTAR_LITE=0
+junction -DUSE_NEXTHOP_TABLE=0 -DUSE_JUNCTION_GRAPH=1 -DUSE_HPA=0 -DUSE_DSTAR_LITE=1
+junction_field -DUSE_NEXTHOP_TABLE=0 -DUSE_JUNCTION_GRAPH=1 -DUSE_HPA=0 -DUSE_DSTAR_LITE=0
+hpa -DUSE_NEXTHOP_TABLE=0 -DUSE_JUNCTION_GRAPH=1 -DUSE_HPA=1 -DUSE_DSTAR_LITE=1
+astar -DUSE_NEXTHOP_TABLE=0 -DUSE_JUNCTION_GRAPH=0 -DUSE_HPA=0 -DUSE_LANDMARKS=1
+astar_manhattan -DUSE_NEXTHOP_TABLE=0 -DUSE_JUNCTION_GRAPH=0 -DUSE_HPA=0 -DUSE_LANDMARKS=0
+EOF
+
+if [ $FAILED -ne 0 ]; then
+    echo "pathbench configurations: FAILED"
+    exit 1
+fi
+echo "pathbench configurations: all passed"
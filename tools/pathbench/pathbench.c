@@ -0,0 +1,670 @@
+/*********************************************************************************************************
+**--------------File Info---------------------------------------------------------------------------------
+** File name:           pathbench.c
+** Descriptions:        Host benchmark and regression run of Blinky's pathfinding. It links the game sources
+**                      with the LCD and timer calls stubbed out, runs find_path() from every ghost cell to
+**                      every ghost cell in both power modes and writes one CSV line per query (expanded
+**                      nodes, peak open_list_counter, path length, overflow hits, wall-clock ns) plus a
+**                      summary table. Every route is also checked against a BFS of the maze. With the
+**                      next-hop table compiled out, a third query set runs the cell A* of blinky.c on every
+**                      pair (astar_route()), whatever planner find_path() would pick, so its expansions and
+**                      open_list peaks are measured; peaks are only reported for queries where it ran.
+**                      The chase planner answers the power mode queries (the target is Pac-Man), so the
+**                      junction graph gets its own query set too: junction_begin() and junction_search() on
+**                      every pair, with no budget.
+**
+**                      Build and run from the repository root (the planner is picked by the switches in
+**                      functions.h, exactly as on the board):
+**
+**                      gcc -std=gnu11 -O2 -Itools/pathbench -I. -ISource -ISource/GLCD -ISource/TouchPanel \
+**                          -ISource/timer tools/pathbench/pathbench.c blinky.c dstar.c flowfield.c game.c \
+**                          hpa.c jobs.c junctions.c path.c wavefront.c maze_tables.c music.c pacman.c \
+**                          render.c sprites.c -lm -o pathbench
+**                      ./pathbench [pathbench.csv]
+**
+**                      D* Lite keeps its search between calls, so its numbers are those of a Pac-Man that
+**                      jumps from target to target in the order of the run (targets in raster order).
+**
+**                      A heuristic run checks, over every (source, target) pair, that neither the Manhattan
+**                      bound (ghost_distance) nor the search heuristic (ghost_heuristic, landmarks included
+**                      when USE_LANDMARKS is 1) ever overestimates the BFS distance, and counts the nodes the
+**                      cell A* of blinky.c expands with the heuristic compiled in: build it with
+**                      -DUSE_LANDMARKS=0 as well to compare the two (tools/pathbench/configs.sh does).
+**
+**                      A wavefront run times the bit-parallel BFS (wavefront.c) against the cell A* and the
+**                      queue BFS, over every pair, and checks its distances against the BFS.
+**
+**                      An HPA* run walks the route hpa.c plans for every pair, checks that it reaches the
+**                      target, and reports how much longer than the shortest it is and what it costs.
+**
+**                      A chase run follows: the ghosts (add -DNUM_GHOSTS=4 for all four) chase a wandering
+**                      Pac-Man tick by tick through the real move_ghosts() and jobs_service(), and the worst
+**                      planning cost of one tick is reported. It is played three times: walking the planned
+**                      paths replanned on every tick, then as the replan governor decides, then with the
+**                      arcade steering.
+** Correlated files:    LPC17xx.h, blinky.c, functions.h
+**--------------------------------------------------------------------------------------------------------
+*********************************************************************************************************/
+
+#include "functions.h"
+#include <time.h>
+
+// Peripherals and drivers the game sources call (LPC17xx.h)
+LPC_ADC_TypeDef host_adc;
+LPC_GPIO_TypeDef host_gpio;
+LPC_TIM_TypeDef host_tim;
+DWT_Type host_dwt;
+CoreDebug_Type host_core_debug;
+
+void LCD_Clear(uint16_t color) { (void)color; }
+void LCD_SetPoint(uint16_t x, uint16_t y, uint16_t color) { (void)x; (void)y; (void)color; }
+void LCD_DrawLine(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1, uint16_t color) {
+    (void)x0; (void)y0; (void)x1; (void)y1; (void)color;
+}
+void GUI_Text(uint16_t x, uint16_t y, uint8_t *str, uint16_t color, uint16_t bk_color) {
+    (void)x; (void)y; (void)str; (void)color; (void)bk_color;
+}
+void LCD_FillRect(uint16_t x, uint16_t y, uint16_t width, uint16_t height, uint16_t color) {
+    (void)x; (void)y; (void)width; (void)height; (void)color;
+}
+void LCD_WriteWindow(uint16_t x, uint16_t y, uint16_t width, uint16_t height, const uint16_t *pixels) {
+    (void)x; (void)y; (void)width; (void)height; (void)pixels;
+}
+void LCD_WindowBegin(uint16_t x, uint16_t y, uint16_t width, uint16_t height) {
+    (void)x; (void)y; (void)width; (void)height;
+}
+void LCD_WindowPixels(const uint16_t *pixels, uint16_t count) { (void)pixels; (void)count; }
+void LCD_WindowEnd(void) {}
+volatile uint8_t val_countdown = 0;  // Game status received over CAN (IRQ_CAN.c)
+volatile uint8_t val_lives = 0;
+volatile uint16_t val_score = 0;
+uint32_t init_timer(uint8_t timer_num, uint32_t prescaler, uint8_t mr_num, uint8_t sr_num, uint32_t value) {
+    (void)timer_num; (void)prescaler; (void)mr_num; (void)sr_num; (void)value;
+    return 0;
+}
+void enable_timer(uint8_t timer_num) { (void)timer_num; }
+void disable_timer(uint8_t timer_num) { (void)timer_num; }
+void reset_timer(uint8_t timer_num) { (void)timer_num; }
+
+// Ghost cells in raster order, and the BFS used as the reference
+static PathStep cells[MAX_NODE];
+static int cell_count = 0;
+static int ref_dist[ROWS][COLS];
+static int ref_x = -1, ref_y = -1;   // Target of ref_dist (-1: not computed)
+
+#define RUN_ASTAR 2   // Summary of the cell A* queries, after PM_OFF and PM_ON
+#define RUN_JUNCTION 3  // Summary of the junction graph queries
+
+// Totals of one power mode (or of the cell A* queries)
+typedef struct {
+    long queries, routes, wrong;
+    long expanded, expanded_max;
+    long searched;       // Queries that ran the cell A*: the only ones with an open_list peak
+    long peak, peak_max;
+    long peak_zero;      // Cell A* searches that reported an open_list peak of 0 (counted as wrong)
+    long length;
+    long overflow;
+    double ns, ns_max;
+} Summary;
+
+// Function to fill ref_dist with the number of steps from every cell to (tx, ty) (-1: unreachable)
+static void reference_bfs(int tx, int ty) {
+    static uint16_t queue[ROWS * COLS];
+    int head = 0, tail = 0, x, y, i;
+
+    if (tx == ref_x && ty == ref_y) {
+        return;
+    }
+    memset(ref_dist, 0xFF, sizeof(ref_dist));
+    ref_dist[ty][tx] = 0;
+    queue[tail++] = ty * COLS + tx;
+    while (head < tail) {
+        x = queue[head] % COLS;
+        y = queue[head] / COLS;
+        head++;
+        for (i = 0; i < 4; i++) {
+            int new_x = x, new_y = y;
+            ghost_move(&new_x, &new_y, i);
+            if (is_ghost_cell(new_x, new_y) && ref_dist[new_y][new_x] < 0) {
+                ref_dist[new_y][new_x] = ref_dist[y][x] + 1;
+                queue[tail++] = new_y * COLS + new_x;
+            }
+        }
+    }
+    ref_x = tx;
+    ref_y = ty;
+}
+
+// Function to list the cells a ghost can reach from its spawn point
+static void collect_cells() {
+    int x, y;
+
+    for (y = 0; y < ROWS; y++) {
+        for (x = 0; x < COLS; x++) {
+            if (game_map[y][x] == BLINKY) {
+                reference_bfs(x, y);  // Distances are symmetric: reachable from it = reaches it
+            }
+        }
+    }
+    for (y = 0; y < ROWS; y++) {
+        for (x = 0; x < COLS; x++) {
+            if (ref_dist[y][x] >= 0 && cell_count < MAX_NODE) {
+                cells[cell_count].x = x;
+                cells[cell_count].y = y;
+                cell_count++;
+            }
+        }
+    }
+}
+
+// Function to check a path: it must start on (sx, sy), stay on ghost cells, end on the destination and be
+// as short as the BFS route (ref_dist toward the destination). Returns 1 if it does.
+static int path_is_shortest(const PackedPath *path, int sx, int sy) {
+    PathIter it;
+
+    if (ref_dist[sy][sx] < 0) {
+        return path->length == 0;  // No route exists: none must be found
+    }
+    if (path->length == 0 || path->start.x != sx || path->start.y != sy || path->length - 1 != ref_dist[sy][sx]) {
+        return 0;
+    }
+    // Walk it as the mover does (a junction graph route expands its corridors on the way)
+    path_iter_begin(&it, path);
+    while (path_iter_left(&it) > 0) {
+        if (path_iter_next(&it) < 0 || !is_ghost_cell(it.cell.x, it.cell.y)) {
+            return 0;
+        }
+    }
+    return it.cell.x == dest_x && it.cell.y == dest_y;
+}
+
+// Function to write the CSV line of a query and add it to its summary. The open_list peak only means something
+// when the cell A* ran (astar_expansions set), and such a search always holds the start node at least once.
+static void query_done(FILE *csv, Summary *sum, const char *run, PathStep source, PathStep target, long expanded,
+                       long length, int overflows, double ns, long ok) {
+    int searched = astar_expansions > 0;
+    char peak[16] = "";
+
+    if (searched) {
+        snprintf(peak, sizeof(peak), "%d", open_list_peak);
+        sum->searched++;
+        sum->peak += open_list_peak;
+        sum->peak_max = open_list_peak > sum->peak_max ? open_list_peak : sum->peak_max;
+        if (open_list_peak == 0) {
+            sum->peak_zero++;
+            ok = 0;
+        }
+    }
+
+    fprintf(csv, "%s,%d,%d,%d,%d,%d,%d,%ld,%s,%ld,%d,%d,%.0f,%ld\n", run, source.x, source.y, target.x, target.y,
+            dest_x, dest_y, expanded, peak, length, ref_dist[source.y][source.x], overflows, ns, ok);
+
+    sum->queries++;
+    sum->routes += length >= 0;
+    sum->wrong += !ok;
+    sum->expanded += expanded;
+    sum->expanded_max = expanded > sum->expanded_max ? expanded : sum->expanded_max;
+    sum->length += length > 0 ? length : 0;
+    sum->overflow += overflows;
+    sum->ns += ns;
+    sum->ns_max = ns > sum->ns_max ? ns : sum->ns_max;
+}
+
+// Function to run one query (Blinky's path) and write its CSV line
+static void run_query(FILE *csv, Summary *sum, int power, PathStep source, PathStep target) {
+    Ghost *blinky = &ghosts[GHOST_BLINKY];
+    struct timespec t0, t1;
+    int overflow_before = overflow;
+    long expanded, length, ok;
+    double ns;
+
+    blinky->x = source.x;
+    blinky->y = source.y;
+    blinky->mode = power == PM_ON ? GHOST_FRIGHTENED : GHOST_CHASE;
+    pacman_x = target.x;
+    pacman_y = target.y;
+    is_power_mode = power;
+    astar_expansions = 0;
+    open_list_peak = 0;
+    junction_expansions = 0;
+    flow_field_expansions = 0;
+#if !USE_NEXTHOP_TABLE && USE_DSTAR_LITE
+    dstar_expansions = 0;
+#endif
+
+    clock_gettime(CLOCK_MONOTONIC, &t0);
+    ghost_find_path(blinky);
+    clock_gettime(CLOCK_MONOTONIC, &t1);
+    ns = (t1.tv_sec - t0.tv_sec) * 1e9 + (t1.tv_nsec - t0.tv_nsec);
+
+    expanded = astar_expansions + junction_expansions + flow_field_expansions;
+#if !USE_NEXTHOP_TABLE && USE_DSTAR_LITE
+    expanded += dstar_expansions;
+#endif
+    length = blinky->path.length > 0 ? blinky->path.length - 1 : -1;
+    reference_bfs(dest_x, dest_y);
+    ok = path_is_shortest(&blinky->path, source.x, source.y);
+
+    query_done(csv, sum, power == PM_ON ? "on" : "off", source, target, expanded, length, overflow - overflow_before,
+               ns, ok);
+}
+
+#if !USE_NEXTHOP_TABLE
+// Function to run one query through the cell A* of blinky.c, whatever planner find_path() uses for the target,
+// and write its CSV line
+static void run_astar_query(FILE *csv, Summary *sum, PathStep source, PathStep target) {
+    static PackedPath path;
+    struct timespec t0, t1;
+    int overflow_before = overflow;
+    long length, ok;
+    double ns;
+
+    astar_expansions = 0;
+    open_list_peak = 0;
+    clock_gettime(CLOCK_MONOTONIC, &t0);
+    length = astar_route(source.x, source.y, target.x, target.y, &path);
+    clock_gettime(CLOCK_MONOTONIC, &t1);
+    ns = (t1.tv_sec - t0.tv_sec) * 1e9 + (t1.tv_nsec - t0.tv_nsec);
+
+    reference_bfs(target.x, target.y);
+    ok = path_is_shortest(&path, source.x, source.y);
+
+    query_done(csv, sum, "astar", source, target, astar_expansions, length, overflow - overflow_before, ns, ok);
+}
+#endif
+
+// Function to run one query through the junction graph search (junction_begin, then junction_search with no
+// budget), whatever planner find_path() uses for the target, and write its CSV line
+static void run_junction_query(FILE *csv, Summary *sum, PathStep source, PathStep target) {
+    static PackedPath path;
+    struct timespec t0, t1;
+    int overflow_before = overflow;
+    long length, ok;
+    double ns;
+
+    astar_expansions = 0;  // No open_list peak for this run
+    dest_x = target.x;     // Where path_is_shortest() expects the walk to end
+    dest_y = target.y;
+    clock_gettime(CLOCK_MONOTONIC, &t0);
+    junction_begin(source.x, source.y, target.x, target.y);
+    junction_search(PLAN_UNBOUNDED, &path);
+    clock_gettime(CLOCK_MONOTONIC, &t1);
+    ns = (t1.tv_sec - t0.tv_sec) * 1e9 + (t1.tv_nsec - t0.tv_nsec);
+    length = path.length > 0 ? path.length - 1 : -1;
+
+    reference_bfs(target.x, target.y);
+    ok = path_is_shortest(&path, source.x, source.y);
+
+    query_done(csv, sum, "junction", source, target, junction_expansions, length, overflow - overflow_before, ns,
+               ok);
+}
+
+// Function to print one line of the summary table
+static void print_summary(const char *name, const Summary *sum) {
+    long n = sum->queries ? sum->queries : 1;
+    char peak_avg[16] = "-", peak_max[16] = "-";
+
+    // Peaks over the queries that ran the cell A*, "-" if none did (the other planners have no open_list)
+    if (sum->searched > 0) {
+        snprintf(peak_avg, sizeof(peak_avg), "%.1f", (double)sum->peak / sum->searched);
+        snprintf(peak_max, sizeof(peak_max), "%ld", sum->peak_max);
+    }
+    printf("%-8s %8ld %8ld %6ld %9.1f %6ld %9s %6s %8.1f %8ld %9.0f %9.0f\n", name, sum->queries,
+           sum->routes, sum->wrong, (double)sum->expanded / n, sum->expanded_max, peak_avg, peak_max,
+           (double)sum->length / (sum->routes ? sum->routes : 1), sum->overflow, sum->ns / n, sum->ns_max);
+}
+
+// Function to check the Manhattan bound and the search heuristic over every pair, and count the cells the cell
+// A* of blinky.c expands with the heuristic compiled in (USE_LANDMARKS picks it); returns the number of pairs
+// where a bound overestimates the real distance
+static long heuristic_run() {
+    long pairs = 0, over = 0;
+    double gap_md = 0, gap_h = 0;
+#if !USE_NEXTHOP_TABLE
+    static PackedPath path;
+    long expanded = 0, expanded_max = 0;
+#endif
+    int s, t;
+
+    for (t = 0; t < cell_count; t++) {
+        int tx = cells[t].x, ty = cells[t].y;
+
+        reference_bfs(tx, ty);
+        for (s = 0; s < cell_count; s++) {
+            int sx = cells[s].x, sy = cells[s].y, d = ref_dist[sy][sx];
+            int md = ghost_distance(sx, sy, tx, ty), h = ghost_heuristic(sx, sy, tx, ty);
+
+            over += md > d || h > d;
+            gap_md += d - md;
+            gap_h += d - h;
+#if !USE_NEXTHOP_TABLE
+            astar_route(sx, sy, tx, ty, &path);
+            expanded += astar_expansions;
+            expanded_max = astar_expansions > expanded_max ? astar_expansions : expanded_max;
+#endif
+            pairs++;
+        }
+    }
+
+    printf("\nheuristic: %ld pairs, %d landmarks%s\n", pairs, LANDMARK_COUNT, USE_LANDMARKS ? "" : " (USE_LANDMARKS 0)");
+    printf("%-10s %12s\n", "bound", "avg_under");
+    printf("%-10s %12.2f\n", "manhattan", gap_md / pairs);
+    printf("%-10s %12.2f\n", "search", gap_h / pairs);
+#if !USE_NEXTHOP_TABLE
+    printf("cell A* (blinky.c) with the %s bound: %.1f cells expanded on average, %ld at worst\n",
+           USE_LANDMARKS ? "search" : "manhattan", (double)expanded / pairs, expanded_max);
+#else
+    printf("cell A* not compiled (USE_NEXTHOP_TABLE 1): expansions not measured\n");
+#endif
+    printf("overestimates: %ld\n", over);
+    return over;
+}
+
+// Function to time the bit-parallel wavefront against the cell A* of blinky.c (all pairs, when it is compiled)
+// and the queue BFS (full fields); returns the number of distances that differ from the BFS
+static long wavefront_run() {
+    static uint8_t field[ROWS][COLS];
+#if !USE_NEXTHOP_TABLE
+    static PackedPath path;
+#endif
+    struct timespec t0, t1;
+    double ns_wave = 0, ns_astar = 0, ns_field = 0, ns_bfs = 0;
+    long pairs = 0, wrong = 0;
+    int s, t;
+
+    for (t = 0; t < cell_count; t++) {
+        int tx = cells[t].x, ty = cells[t].y;
+
+        ref_x = -1;  // Force the BFS to run, it is timed here
+        clock_gettime(CLOCK_MONOTONIC, &t0);
+        reference_bfs(tx, ty);
+        clock_gettime(CLOCK_MONOTONIC, &t1);
+        ns_bfs += (t1.tv_sec - t0.tv_sec) * 1e9 + (t1.tv_nsec - t0.tv_nsec);
+
+        clock_gettime(CLOCK_MONOTONIC, &t0);
+        wave_field(ghost_walk_mask, tx, ty, field);
+        clock_gettime(CLOCK_MONOTONIC, &t1);
+        ns_field += (t1.tv_sec - t0.tv_sec) * 1e9 + (t1.tv_nsec - t0.tv_nsec);
+
+        for (s = 0; s < cell_count; s++) {
+            int sx = cells[s].x, sy = cells[s].y, d;
+
+            clock_gettime(CLOCK_MONOTONIC, &t0);
+            d = wave_distance(ghost_walk_mask, sx, sy, tx, ty);
+            clock_gettime(CLOCK_MONOTONIC, &t1);
+            ns_wave += (t1.tv_sec - t0.tv_sec) * 1e9 + (t1.tv_nsec - t0.tv_nsec);
+
+#if !USE_NEXTHOP_TABLE
+            clock_gettime(CLOCK_MONOTONIC, &t0);
+            astar_route(sx, sy, tx, ty, &path);
+            clock_gettime(CLOCK_MONOTONIC, &t1);
+            ns_astar += (t1.tv_sec - t0.tv_sec) * 1e9 + (t1.tv_nsec - t0.tv_nsec);
+#endif
+
+            wrong += d != ref_dist[sy][sx] || field[sy][sx] != ref_dist[sy][sx];
+            pairs++;
+        }
+    }
+
+    printf("\nwavefront: %ld pairs, %d fields\n", pairs, cell_count);
+#if !USE_NEXTHOP_TABLE
+    printf("distance (s, t): wavefront %.0f ns, cell A* %.0f ns (route included)\n", ns_wave / pairs, ns_astar / pairs);
+#else
+    printf("distance (s, t): wavefront %.0f ns (cell A* not compiled)\n", ns_wave / pairs);
+    (void)ns_astar;
+#endif
+    printf("full field:      wavefront %.0f ns, queue BFS %.0f ns\n", ns_field / cell_count, ns_bfs / cell_count);
+    printf("distances differing from the BFS: %ld\n", wrong);
+    return wrong;
+}
+
+// Function to walk the HPA* route of every pair; returns the number of pairs whose route is missing, leaves
+// the walkable cells or stops short of the target. Routes may be longer than the shortest: the excess is reported.
+static long hpa_run() {
+    struct timespec t0, t1;
+    double ns_hpa = 0, ns_astar = 0;
+    long pairs = 0, failed = 0, longer = 0, extra = 0, exp_sum = 0, exp_max = 0, cells_sum = 0, cells_max = 0;
+    long astar_sum = 0, extra_max = 0;
+    double ratio_max = 1.0;
+#if !USE_NEXTHOP_TABLE
+    static PackedPath path;
+#endif
+    int s, t;
+
+    if (hpa_overflow) {
+        printf("\nhpa*: abstract graph overflow (MAX_HPA_NODES %d, HPA_MAX_EDGES %d)\n", MAX_HPA_NODES, HPA_MAX_EDGES);
+        return 1;
+    }
+
+    for (t = 0; t < cell_count; t++) {
+        int tx = cells[t].x, ty = cells[t].y;
+
+        reference_bfs(tx, ty);
+        for (s = 0; s < cell_count; s++) {
+            int sx = cells[s].x, sy = cells[s].y, x = sx, y = sy, len = 0, dir, found;
+
+            // Search and refinement are timed together, as hpa_resume() runs them
+            clock_gettime(CLOCK_MONOTONIC, &t0);
+            found = hpa_plan(sx, sy, tx, ty);
+            while (found && (dir = hpa_route_direction(x, y)) >= 0 && len < MAX_NODE) {
+                ghost_move(&x, &y, dir);
+                if (!is_ghost_cell(x, y)) {
+                    break;
+                }
+                len++;
+            }
+            clock_gettime(CLOCK_MONOTONIC, &t1);
+            ns_hpa += (t1.tv_sec - t0.tv_sec) * 1e9 + (t1.tv_nsec - t0.tv_nsec);
+
+#if !USE_NEXTHOP_TABLE
+            clock_gettime(CLOCK_MONOTONIC, &t0);
+            astar_route(sx, sy, tx, ty, &path);
+            clock_gettime(CLOCK_MONOTONIC, &t1);
+            ns_astar += (t1.tv_sec - t0.tv_sec) * 1e9 + (t1.tv_nsec - t0.tv_nsec);
+            astar_sum += astar_expansions;
+#endif
+
+            if (!found || x != tx || y != ty) {
+                failed++;
+            } else if (len > ref_dist[sy][sx]) {
+                longer++;
+                extra += len - ref_dist[sy][sx];
+                extra_max = len - ref_dist[sy][sx] > extra_max ? len - ref_dist[sy][sx] : extra_max;
+                ratio_max = (double)len / ref_dist[sy][sx] > ratio_max ? (double)len / ref_dist[sy][sx] : ratio_max;
+            }
+            exp_sum += hpa_expansions;
+            exp_max = hpa_expansions > exp_max ? hpa_expansions : exp_max;
+            cells_sum += hpa_cells;
+            cells_max = hpa_cells > cells_max ? hpa_cells : cells_max;
+            pairs++;
+        }
+    }
+
+    printf("\nhpa*: %ld pairs, %dx%d clusters of %d cells, %d entrances\n", pairs,
+           (COLS + HPA_CLUSTER - 1) / HPA_CLUSTER, (ROWS + HPA_CLUSTER - 1) / HPA_CLUSTER, HPA_CLUSTER, hpa_node_count);
+    printf("entrances expanded: %.1f avg, %ld max; cluster cells visited: %.1f avg, %ld max\n",
+           (double)exp_sum / pairs, exp_max, (double)cells_sum / pairs, cells_max);
+#if !USE_NEXTHOP_TABLE
+    printf("time per route: hpa* %.0f ns (search and refinement), cell A* %.0f ns (%.1f cells expanded)\n",
+           ns_hpa / pairs, ns_astar / pairs, (double)astar_sum / pairs);
+#else
+    printf("time per route: hpa* %.0f ns (search and refinement; cell A* not compiled)\n", ns_hpa / pairs);
+    (void)ns_astar;
+    (void)astar_sum;
+#endif
+    printf("routes longer than the shortest: %ld (%.2f extra steps on average, %ld at worst, %.2f times the shortest "
+           "at worst), failed: %ld\n", longer, longer ? (double)extra / longer : 0.0, extra_max, ratio_max, failed);
+    return failed;
+}
+
+// Function to move Pac-Man one cell: he keeps his heading and turns at random at the crossings (never back,
+// unless stuck)
+static void wander_pacman(unsigned *seed, int *dir) {
+    int options[4], count = 0, i, x = pacman_x, y = pacman_y;
+
+    for (i = 0; i < 4; i++) {
+        if (i != ((*dir + 2) & 3) && ghost_can_move(x, y, i)) {
+            options[count++] = i;
+        }
+    }
+    *seed = *seed * 1103515245 + 12345;
+    if (count == 0) {
+        *dir = (*dir + 2) & 3;
+    } else if (!ghost_can_move(x, y, *dir) || (*seed >> 16) % 3 == 0) {
+        *dir = options[(*seed >> 16) % count];
+    }
+    ghost_move(&x, &y, *dir);
+    pacman_x = x;
+    pacman_y = y;
+    command = "DRUL"[*dir];
+}
+
+// Function to let the ghosts chase a wandering Pac-Man for ticks TIMER2 ticks and print the planning cost of a tick
+static void chase_run(int ticks) {
+    unsigned seed = 12345;
+    int tick, dir = DIR_RIGHT, caught = 0, waiting = 0;
+    double ns, ns_total = 0, ns_max = 0;
+    struct timespec t0, t1;
+    uint32_t searches;
+#if !USE_NEXTHOP_TABLE && USE_DSTAR_LITE
+    uint32_t restarts;
+#endif
+
+    ghosts_reset();
+    is_power_mode = PM_OFF;
+    pacman_x = 14;
+    pacman_y = 28;
+    find_path();
+    searches = plan_searches;
+#if !USE_NEXTHOP_TABLE && USE_DSTAR_LITE
+    restarts = dstar_restarts;
+#endif
+    replans_triggered = 0;
+    replans_skipped = 0;
+
+    for (tick = 0; tick < ticks; tick++) {
+        // Pac-Man rests one tick in four, or a ghost on his trail could never catch up
+        if (tick % 4 != 3) {
+            wander_pacman(&seed, &dir);
+        }
+        lives_counter = 3;  // Never game over
+
+        // TIMER2 (the steering runs there), then the main loop until the tick's budget is spent
+        clock_gettime(CLOCK_MONOTONIC, &t0);
+        move_ghosts();
+        if (lives_counter < 3) {
+            caught++;  // lose_life() took a life and sent everybody back to the start
+        }
+        replan_tick();
+        job_post(JOB_TICK);
+        while (jobs_service()) {
+        }
+        clock_gettime(CLOCK_MONOTONIC, &t1);
+        ns = (t1.tv_sec - t0.tv_sec) * 1e9 + (t1.tv_nsec - t0.tv_nsec);
+        ns_total += ns;
+        ns_max = ns > ns_max ? ns : ns_max;
+        waiting += plan_busy();  // Budget spent before every ghost got its new path
+    }
+
+    printf("\nchase (%s): %d ghosts, %d ticks, %d slices of %d expansions per tick\n",
+           arcade_steering ? "arcade steering" : replan_governor ? "planned paths, replan governor" :
+           "planned paths, replan every tick", NUM_GHOSTS, ticks, PLAN_TICK_SLICES, PLAN_BUDGET);
+    printf("ghost AI per tick: avg %.0f ns, worst %.0f ns; ticks ending with ghosts still waiting: %d; "
+           "Pac-Man caught %d times\n", ns_total / ticks, ns_max, waiting, caught);
+    printf("searches: %u", plan_searches - searches);
+    if (replan_governor && !arcade_steering) {
+        printf("; governor: %u replans triggered, %u skipped", replans_triggered, replans_skipped);
+    }
+#if !USE_NEXTHOP_TABLE && USE_DSTAR_LITE
+    printf("; D* Lite restarts: %u", dstar_restarts - restarts);
+#endif
+    printf("\n");
+}
+
+int main(int argc, char **argv) {
+    const char *csv_name = argc > 1 ? argv[1] : "pathbench.csv";
+    Summary sum[4];
+    FILE *csv;
+    long inadmissible, wave_wrong, hpa_failed;
+    int power, s, t;
+
+    csv = fopen(csv_name, "w");
+    if (!csv) {
+        perror(csv_name);
+        return 1;
+    }
+
+    junction_graph_init();
+    wavefront_init();
+    hpa_init();
+    ghosts_init();
+    collect_cells();
+
+#if USE_NEXTHOP_TABLE
+    printf("planner: next-hop table\n");
+#else
+    printf("planner: chase %s, corners %s\n", USE_DSTAR_LITE ? "D* Lite" : "distance field",
+           USE_HPA && !hpa_overflow ? "HPA*" : USE_JUNCTION_GRAPH && !junction_overflow ? "junction graph" : "cell A*");
+#endif
+    printf("ghost cells: %d, queries per power mode: %d\n\n", cell_count, cell_count * cell_count);
+
+    fprintf(csv, "run,sx,sy,tx,ty,dest_x,dest_y,expanded,open_peak,path_len,bfs_len,overflow,ns,ok\n");
+    memset(sum, 0, sizeof(sum));
+    for (power = PM_OFF; power <= PM_ON; power++) {
+        for (t = 0; t < cell_count; t++) {
+            for (s = 0; s < cell_count; s++) {
+                run_query(csv, &sum[power], power, cells[s], cells[t]);
+            }
+        }
+    }
+#if !USE_NEXTHOP_TABLE
+    // The chase runs D* Lite or the distance field and the other targets the junction graph or HPA*: the cell
+    // A* only runs when those are compiled out or overflow, so it gets its own queries
+    for (t = 0; t < cell_count; t++) {
+        for (s = 0; s < cell_count; s++) {
+            run_astar_query(csv, &sum[RUN_ASTAR], cells[s], cells[t]);
+        }
+    }
+#endif
+    // The junction graph only plans the targets other than Pac-Man: check it on every pair too
+    if (!junction_overflow) {
+        for (t = 0; t < cell_count; t++) {
+            for (s = 0; s < cell_count; s++) {
+                run_junction_query(csv, &sum[RUN_JUNCTION], cells[s], cells[t]);
+            }
+        }
+    }
+    fclose(csv);
+
+    printf("%-8s %8s %8s %6s %9s %6s %9s %6s %8s %8s %9s %9s\n", "run", "queries", "routes", "wrong",
+           "exp_avg", "max", "peak_avg", "max", "len_avg", "overflow", "ns_avg", "ns_max");
+    print_summary("off", &sum[PM_OFF]);
+    print_summary("on", &sum[PM_ON]);
+#if !USE_NEXTHOP_TABLE
+    print_summary("astar", &sum[RUN_ASTAR]);
+    if (sum[RUN_ASTAR].peak_zero > 0) {
+        printf("cell A* searches with no open_list peak: %ld\n", sum[RUN_ASTAR].peak_zero);
+    }
+#endif
+    if (junction_overflow) {
+        printf("junction: graph overflow (MAX_JUNCTIONS %d), not run\n", MAX_JUNCTIONS);
+    } else {
+        print_summary("junction", &sum[RUN_JUNCTION]);
+    }
+    printf("\nper-query results: %s\n", csv_name);
+
+    inadmissible = heuristic_run();
+    wave_wrong = wavefront_run();
+    hpa_failed = hpa_run();
+    arcade_steering = 0;
+    replan_governor = 0;
+    chase_run(20000);
+    replan_governor = 1;  // The same game with the replan governor...
+    chase_run(20000);
+    arcade_steering = 1;  // ...and with the O(1) steering, for comparison
+    chase_run(20000);
+
+    // Non-zero if any route, bound or distance is wrong
+    return sum[PM_OFF].wrong + sum[PM_ON].wrong + sum[RUN_ASTAR].wrong + sum[RUN_JUNCTION].wrong + junction_overflow +
+           inadmissible + wave_wrong + hpa_failed ? 1 : 0;
+}
@@ -0,0 +1,178 @@
+/*********************************************************************************************************
+**--------------File Info---------------------------------------------------------------------------------
+** File name:          wavefront.c
+** Last modified Date:
+** Last Version:
+** Descriptions:       Bit-parallel BFS over the maze. A row of game_map is 30 columns, so the walkable cells
+**                     are kept as one uint32_t mask per row and a whole row of the frontier advances with a
+**                     few shifts, ANDs and ORs. The frontier of each step holds exactly the cells at the
+**                     next distance, so callers read the distances layer by layer.
+**--------------------------------------------------------------------------------------------------------
+*********************************************************************************************************/
+
+#include "functions.h"
+
+#define WAVE_BIT(x) (1u << (x))
+
+// Walkable cells, one bit per column (built once at startup)
+uint32_t ghost_walk_mask[ROWS];          // Ghost cells (the ghost house and its door included)
+uint32_t pacman_walk_mask[ROWS];         // Cells Pac-Man can walk on (the door excluded)
+static int wave_tunnel = 0;              // Set if both tunnel openings are in the maze
+
+// Function to build the walkable masks from game_map (walls never change at runtime)
+void wavefront_init() {
+    int x, y;
+
+    for (y = 0; y < ROWS; y++) {
+        ghost_walk_mask[y] = 0;
+        pacman_walk_mask[y] = 0;
+        for (x = 0; x < COLS; x++) {
+            if (is_ghost_cell(x, y)) {
+                ghost_walk_mask[y] |= WAVE_BIT(x);
+                if (game_map[y][x] != DOOR) {
+                    pacman_walk_mask[y] |= WAVE_BIT(x);
+                }
+            }
+        }
+    }
+    wave_tunnel = game_map[TUNNEL_ROW][TUNNEL_LEFT_X - 1] == TELEPORT_LEFT &&
+                  game_map[TUNNEL_ROW][TUNNEL_RIGHT_X + 1] == TELEPORT_RIGHT;
+}
+
+// Function to start a wave from (x, y) over the walkable cells in walk; the frontier is layer 0
+void wave_begin(Wavefront *wave, const uint32_t *walk, int x, int y) {
+    memset(wave->frontier, 0, sizeof(wave->frontier));
+    memset(wave->visited, 0, sizeof(wave->visited));
+    wave->walk = walk;
+    wave->layer = 0;
+    wave->lo = 1;  // Empty frontier until the start is known to be walkable
+    wave->hi = 0;
+
+    if (x >= 0 && x < COLS && y >= 0 && y < ROWS && (walk[y] & WAVE_BIT(x))) {
+        wave->frontier[y] = WAVE_BIT(x);
+        wave->visited[y] = WAVE_BIT(x);
+        wave->lo = y;
+        wave->hi = y;
+    }
+}
+
+// Function to advance the wave by one step; returns 0 once there is nothing left to reach
+int wave_step(Wavefront *wave) {
+    int lo = wave->lo > 0 ? wave->lo - 1 : 0;
+    int hi = wave->hi < ROWS - 1 ? wave->hi + 1 : ROWS - 1;
+    int new_lo = ROWS, new_hi = -1;
+    uint32_t above = 0, wrap = 0;
+    int y;
+
+    if (wave->lo > wave->hi) {
+        return 0;  // Already exhausted
+    }
+
+    // The two ends of the tunnel are one step apart
+    if (wave_tunnel && TUNNEL_ROW >= wave->lo && TUNNEL_ROW <= wave->hi) {
+        uint32_t row = wave->frontier[TUNNEL_ROW];
+        if (row & WAVE_BIT(TUNNEL_LEFT_X)) {
+            wrap |= WAVE_BIT(TUNNEL_RIGHT_X);
+        }
+        if (row & WAVE_BIT(TUNNEL_RIGHT_X)) {
+            wrap |= WAVE_BIT(TUNNEL_LEFT_X);
+        }
+    }
+
+    // Rows top to bottom: the row below still holds the old frontier when it is read
+    for (y = lo; y <= hi; y++) {
+        uint32_t row = wave->frontier[y];
+        uint32_t below = y + 1 < ROWS ? wave->frontier[y + 1] : 0;
+        uint32_t next = row | (row << 1) | (row >> 1) | above | below;
+
+        if (y == TUNNEL_ROW) {
+            next |= wrap;
+        }
+        next &= wave->walk[y] & ~wave->visited[y];
+
+        above = row;
+        wave->frontier[y] = next;
+        wave->visited[y] |= next;
+        if (next) {
+            if (y < new_lo) {
+                new_lo = y;
+            }
+            new_hi = y;
+        }
+    }
+
+    wave->layer++;
+    wave->lo = new_lo;
+    wave->hi = new_hi;
+    return new_lo <= new_hi;
+}
+
+// Function to get the steps from (sx, sy) to (tx, ty) over walk, -1 if there is no route
+int wave_distance(const uint32_t *walk, int sx, int sy, int tx, int ty) {
+    Wavefront wave;
+
+    if (tx < 0 || tx >= COLS || ty < 0 || ty >= ROWS) {
+        return -1;
+    }
+    wave_begin(&wave, walk, sx, sy);
+    while (wave.lo <= wave.hi) {
+        if (wave.frontier[ty] & WAVE_BIT(tx)) {
+            return wave.layer;
+        }
+        wave_step(&wave);
+    }
+    return -1;
+}
+
+// Function to write the distance of the current layer into every cell of its frontier; returns the cells written
+int wave_write_layer(const Wavefront *wave, uint8_t field[ROWS][COLS]) {
+    int cells = 0, x, y;
+
+    for (y = wave->lo; y <= wave->hi; y++) {
+        uint32_t row = wave->frontier[y];
+
+        // One write per cell of the layer, highest column first
+        while (row) {
+            x = 31 - __CLZ(row);
+            row &= ~WAVE_BIT(x);
+            field[y][x] = wave->layer;
+            cells++;
+        }
+    }
+    return cells;
+}
+
+// Function to write the steps from (x, y) to every cell into field (FIELD_UNREACHABLE where there is
+// no route, or the route is longer than FIELD_UNREACHABLE - 1 steps); returns the cells reached
+int wave_field(const uint32_t *walk, int x, int y, uint8_t field[ROWS][COLS]) {
+    Wavefront wave;
+    int cells = 0;
+
+    memset(field, FIELD_UNREACHABLE, ROWS * COLS);
+    wave_begin(&wave, walk, x, y);
+    while (wave.lo <= wave.hi && wave.layer < FIELD_UNREACHABLE) {
+        cells += wave_write_layer(&wave, field);
+        wave_step(&wave);
+    }
+    return cells;
+}
+
+// Function to find the nearest cell of targets reachable from (x, y) over walk (lowest column of the
+// topmost row on ties); returns its distance and stores it in (*tx, *ty), -1 if none can be reached
+int wave_nearest(const uint32_t *walk, int x, int y, const uint32_t *targets, int *tx, int *ty) {
+    Wavefront wave;
+
+    wave_begin(&wave, walk, x, y);
+    while (wave.lo <= wave.hi) {
+        for (y = wave.lo; y <= wave.hi; y++) {
+            uint32_t hit = wave.frontier[y] & targets[y];
+            if (hit) {
+                *tx = 31 - __CLZ(hit & -hit);  // Lowest set bit
+                *ty = y;
+                return wave.layer;
+            }
+        }
+        wave_step(&wave);
+    }
+    return -1;
+}